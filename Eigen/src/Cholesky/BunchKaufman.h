@@ -0,0 +1,456 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef EIGEN_BUNCHKAUFMAN_H
+#define EIGEN_BUNCHKAUFMAN_H
+
+namespace Eigen {
+
+/** \ingroup Cholesky_Module
+  *
+  * \class BunchKaufman
+  *
+  * \brief LDLT decomposition of a selfadjoint indefinite matrix with Bunch-Kaufman pivoting
+  *
+  * \param MatrixType the type of the matrix of which to compute the decomposition
+  * \param UpLo the triangular part that will be used for the decompositon: Lower (default) or Upper.
+  *             The other triangular part won't be read.
+  *
+  * Perform a decomposition \f$ A = P^TLDL^*P \f$ of a selfadjoint matrix \f$ A \f$, where P is a permutation
+  * matrix, L is lower triangular with a unit diagonal and D is a block diagonal matrix with blocks of size 1 or 2.
+  *
+  * Unlike class LDLT, whose diagonal pivoting is only stable for semidefinite matrices, the partial pivoting of
+  * Bunch and Kaufman bounds the growth of the coefficients of L for any invertible matrix, choosing a 2x2 pivot
+  * whenever no diagonal coefficient is large enough compared to the rest of its column.
+  * Large matrices are decomposed by panels, as in LAPACK's xSYTRF, so that most of the work is done by the
+  * selfadjoint rank-k product updating the remaining matrix.
+  *
+  * \sa class LDLT, class PartialPivLU
+  */
+template<typename _MatrixType, int _UpLo> class BunchKaufman
+{
+  public:
+    typedef _MatrixType MatrixType;
+    enum {
+      RowsAtCompileTime = MatrixType::RowsAtCompileTime,
+      ColsAtCompileTime = MatrixType::ColsAtCompileTime,
+      Options = MatrixType::Options & ~RowMajorBit, // these are the options for the TmpMatrixType, we need a ColMajor matrix here!
+      MaxRowsAtCompileTime = MatrixType::MaxRowsAtCompileTime,
+      MaxColsAtCompileTime = MatrixType::MaxColsAtCompileTime,
+      UpLo = _UpLo
+    };
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename NumTraits<typename MatrixType::Scalar>::Real RealScalar;
+    typedef typename MatrixType::Index Index;
+    typedef Matrix<Scalar, RowsAtCompileTime, 1, Options, MaxRowsAtCompileTime, 1> TmpMatrixType;
+
+    typedef Transpositions<RowsAtCompileTime, MaxRowsAtCompileTime> TranspositionType;
+
+    typedef internal::LDLT_Traits<MatrixType,UpLo> Traits;
+
+    /** \brief Default Constructor.
+      *
+      * The default constructor is useful in cases in which the user intends to
+      * perform decompositions via BunchKaufman::compute(const MatrixType&).
+      */
+    BunchKaufman() : m_matrix(), m_transpositions(), m_subdiagonal(), m_isInitialized(false) {}
+
+    /** \brief Default Constructor with memory preallocation
+      *
+      * Like the default constructor but with preallocation of the internal data
+      * according to the specified problem \a size.
+      * \sa BunchKaufman()
+      */
+    BunchKaufman(Index size)
+      : m_matrix(size, size),
+        m_transpositions(size),
+        m_subdiagonal(size),
+        m_isInitialized(false)
+    {}
+
+    /** \brief Constructor with decomposition
+      *
+      * This calculates the decomposition for the input \a matrix.
+      * \sa BunchKaufman(Index size)
+      */
+    BunchKaufman(const MatrixType& matrix)
+      : m_matrix(matrix.rows(), matrix.cols()),
+        m_transpositions(matrix.rows()),
+        m_subdiagonal(matrix.rows()),
+        m_isInitialized(false)
+    {
+      compute(matrix);
+    }
+
+    /** \returns a view of the upper triangular matrix U */
+    inline typename Traits::MatrixU matrixU() const
+    {
+      eigen_assert(m_isInitialized && "BunchKaufman is not initialized.");
+      return Traits::getU(m_matrix);
+    }
+
+    /** \returns a view of the lower triangular matrix L */
+    inline typename Traits::MatrixL matrixL() const
+    {
+      eigen_assert(m_isInitialized && "BunchKaufman is not initialized.");
+      return Traits::getL(m_matrix);
+    }
+
+    /** \returns the permutation matrix P as a transposition sequence.
+      */
+    inline const TranspositionType& transpositionsP() const
+    {
+      eigen_assert(m_isInitialized && "BunchKaufman is not initialized.");
+      return m_transpositions;
+    }
+
+    /** \returns the diagonal coefficients of the block diagonal matrix D */
+    inline Diagonal<const MatrixType> vectorD() const
+    {
+      eigen_assert(m_isInitialized && "BunchKaufman is not initialized.");
+      return m_matrix.diagonal();
+    }
+
+    /** \returns the subdiagonal coefficients of the block diagonal matrix D. They are zero but at
+      * the bottom left corners of the 2x2 blocks, and the superdiagonal is their conjugate. */
+    inline const TmpMatrixType& subdiagonalD() const
+    {
+      eigen_assert(m_isInitialized && "BunchKaufman is not initialized.");
+      return m_subdiagonal;
+    }
+
+    /** \returns a solution x of \f$ A x = b \f$ using the current decomposition of A.
+      *
+      * \note_about_checking_solutions
+      *
+      * This method solves \f$ A x = b \f$ using the decomposition \f$ A = P^T L D L^* P \f$
+      * by solving the systems \f$ P^T y_1 = b \f$, \f$ L y_2 = y_1 \f$, \f$ D y_3 = y_2 \f$,
+      * \f$ L^* y_4 = y_3 \f$ and \f$ P x = y_4 \f$ in succession. The 1x1 blocks of D which are
+      * negligible are treated as zeros, as in LDLT::solve().
+      *
+      * \sa LDLT::solve()
+      */
+    template<typename Rhs>
+    inline const internal::solve_retval<BunchKaufman, Rhs>
+    solve(const MatrixBase<Rhs>& b) const
+    {
+      eigen_assert(m_isInitialized && "BunchKaufman is not initialized.");
+      eigen_assert(m_matrix.rows()==b.rows()
+                && "BunchKaufman::solve(): invalid number of rows of the right hand side matrix b");
+      return internal::solve_retval<BunchKaufman, Rhs>(*this, b.derived());
+    }
+
+    BunchKaufman& compute(const MatrixType& matrix);
+
+    /** \returns the internal decomposition matrix: the strict lower part holds L, and the diagonal
+      * holds the diagonal of D. The subdiagonal of D is stored apart, see subdiagonalD().
+      */
+    inline const MatrixType& matrixLDLT() const
+    {
+      eigen_assert(m_isInitialized && "BunchKaufman is not initialized.");
+      return m_matrix;
+    }
+
+    MatrixType reconstructedMatrix() const;
+
+    inline Index rows() const { return m_matrix.rows(); }
+    inline Index cols() const { return m_matrix.cols(); }
+
+    /** \brief Reports whether previous computation was successful.
+      *
+      * \returns \c Success
+      */
+    ComputationInfo info() const
+    {
+      eigen_assert(m_isInitialized && "BunchKaufman is not initialized.");
+      return Success;
+    }
+
+  protected:
+    MatrixType m_matrix;
+    TranspositionType m_transpositions;
+    TmpMatrixType m_subdiagonal;
+    bool m_isInitialized;
+};
+
+namespace internal {
+
+template<int UpLo> struct bunch_kaufman_inplace;
+
+template<> struct bunch_kaufman_inplace<Lower>
+{
+  /** \internal Factorizes the columns \a k0 to at most \a k0 + \a blockSize - 1 of \a mat, as in LAPACK's xLAHEF.
+    * The columns of the panel are updated from the previous ones only, which are kept together with the
+    * corresponding columns of L D in \a W, so that the remaining matrix can be updated in one product.
+    * \returns the number of factorized columns
+    */
+  template<typename MatrixType, typename TranspositionType, typename VectorType, typename Workspace>
+  static typename MatrixType::Index panel(MatrixType& mat, typename MatrixType::Index k0, typename MatrixType::Index blockSize,
+                                          TranspositionType& transpositions, VectorType& subdiag, Workspace& W)
+  {
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::RealScalar RealScalar;
+    typedef typename MatrixType::Index Index;
+    const Index size = mat.rows();
+    // this value of alpha minimizes the bound of the growth of the coefficients
+    const RealScalar alpha = (RealScalar(1) + sqrt(RealScalar(17))) / RealScalar(8);
+
+    Index k = k0;
+    while(k < size && (k-k0 < blockSize-1 || blockSize >= size-k0))
+    {
+      // the column k of the updated matrix is W.col(r)
+      Index r = k - k0;
+      Index rs = size - k;
+      W.col(r).segment(r,rs) = mat.col(k).tail(rs);
+      if(r>0)
+        W.col(r).segment(r,rs).noalias() -= mat.block(k,k0,rs,r) * W.row(r).head(r).adjoint();
+      W.coeffRef(r,r) = real(W.coeff(r,r));
+
+      RealScalar absakk = abs(real(W.coeff(r,r)));
+      RealScalar colmax(0);
+      Index imax = k;
+      if(rs>1)
+      {
+        colmax = W.col(r).segment(r+1,rs-1).cwiseAbs().maxCoeff(&imax);
+        imax += k+1;
+      }
+
+      Index kstep = 1, kp = k;
+      if(absakk < alpha*colmax)
+      {
+        // the column imax of the updated matrix is W.col(r+1)
+        Index ri = imax - k0;
+        W.col(r+1).segment(r,imax-k) = mat.row(imax).segment(k,imax-k).adjoint();
+        W.col(r+1).segment(ri,size-imax) = mat.col(imax).tail(size-imax);
+        if(r>0)
+          W.col(r+1).segment(r,rs).noalias() -= mat.block(k,k0,rs,r) * W.row(ri).head(r).adjoint();
+        W.coeffRef(ri,r+1) = real(W.coeff(ri,r+1));
+
+        RealScalar rowmax = W.col(r+1).segment(r,imax-k).cwiseAbs().maxCoeff();
+        if(imax<size-1)
+          rowmax = (std::max)(rowmax, W.col(r+1).segment(ri+1,size-imax-1).cwiseAbs().maxCoeff());
+
+        if(absakk >= alpha*colmax*(colmax/rowmax))
+        {
+          // no interchange, use a 1x1 pivot
+        }
+        else if(abs(real(W.coeff(ri,r+1))) >= alpha*rowmax)
+        {
+          // interchange k and imax, use a 1x1 pivot
+          kp = imax;
+          W.col(r).segment(r,rs) = W.col(r+1).segment(r,rs);
+        }
+        else
+        {
+          // interchange k+1 and imax, use a 2x2 pivot
+          kp = imax;
+          kstep = 2;
+        }
+      }
+
+      Index kk = k + kstep - 1;
+      if(kp != kk)
+      {
+        // copy the non-updated column kk to the column kp, its updated values are in W
+        Index s = size-kp-1;
+        mat.coeffRef(kp,kp) = mat.coeff(kk,kk);
+        mat.row(kp).segment(kk+1,kp-kk-1) = mat.col(kk).segment(kk+1,kp-kk-1).adjoint();
+        mat.col(kp).tail(s) = mat.col(kk).tail(s);
+        // interchange the rows kk and kp of the previous columns of L and of W
+        mat.row(kk).head(kk).swap(mat.row(kp).head(kk));
+        W.row(kk-k0).head(kk-k0+1).swap(W.row(kp-k0).head(kk-k0+1));
+      }
+
+      if(kstep==1)
+      {
+        // L.col(k) = W.col(r) / D(k,k)
+        mat.col(k).tail(rs) = W.col(r).segment(r,rs);
+        RealScalar d = real(mat.coeff(k,k));
+        if(rs>1 && d!=RealScalar(0))
+          mat.col(k).tail(rs-1) /= d;
+        transpositions.coeffRef(k) = kp;
+        subdiag.coeffRef(k) = Scalar(0);
+      }
+      else
+      {
+        // [L.col(k) L.col(k+1)] = [W.col(r) W.col(r+1)] * D(k:k+1,k:k+1)^-1
+        Scalar d21 = W.coeff(r+1,r);
+        Scalar d11 = W.coeff(r+1,r+1) / d21;
+        Scalar d22 = W.coeff(r,r) / conj(d21);
+        RealScalar t = RealScalar(1) / (real(d11*d22) - RealScalar(1));
+        d21 = t / d21;
+        if(rs>2)
+        {
+          mat.col(k).tail(rs-2) = conj(d21) * (d11 * W.col(r).segment(r+2,rs-2) - W.col(r+1).segment(r+2,rs-2));
+          mat.col(k+1).tail(rs-2) = d21 * (d22 * W.col(r+1).segment(r+2,rs-2) - W.col(r).segment(r+2,rs-2));
+        }
+        mat.coeffRef(k,k) = W.coeff(r,r);
+        mat.coeffRef(k+1,k+1) = W.coeff(r+1,r+1);
+        mat.coeffRef(k+1,k) = Scalar(0);
+        transpositions.coeffRef(k) = k;
+        transpositions.coeffRef(k+1) = kp;
+        subdiag.coeffRef(k) = W.coeff(r+1,r);
+        subdiag.coeffRef(k+1) = Scalar(0);
+      }
+
+      k += kstep;
+    }
+    return k - k0;
+  }
+
+  template<typename MatrixType, typename TranspositionType, typename VectorType>
+  static void blocked(MatrixType& mat, TranspositionType& transpositions, VectorType& subdiag)
+  {
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::Index Index;
+    eigen_assert(mat.rows()==mat.cols());
+    const Index size = mat.rows();
+
+    Index blockSize = size;
+    if(size>=32)
+    {
+      blockSize = size/8;
+      blockSize = (blockSize/16)*16;
+      blockSize = (std::min)((std::max)(blockSize,Index(8)), Index(128));
+    }
+    Matrix<Scalar,Dynamic,Dynamic> W(size, blockSize);
+
+    for(Index k = 0; k < size; )
+    {
+      Index bs = panel(mat, k, blockSize, transpositions, subdiag, W);
+      Index rs = size - k - bs;
+      if(rs>0)
+        mat.block(k+bs,k+bs,rs,rs).template triangularView<Lower>()
+          -= mat.block(k+bs,k,rs,bs) * W.block(bs,0,rs,bs).adjoint(); // bottleneck
+      k += bs;
+    }
+  }
+};
+
+template<> struct bunch_kaufman_inplace<Upper>
+{
+  template<typename MatrixType, typename TranspositionType, typename VectorType>
+  static EIGEN_STRONG_INLINE void blocked(MatrixType& mat, TranspositionType& transpositions, VectorType& subdiag)
+  {
+    Transpose<MatrixType> matt(mat);
+    bunch_kaufman_inplace<Lower>::blocked(matt, transpositions, subdiag);
+    // the transposed lower triangular part is the conjugate of the matrix
+    subdiag = subdiag.conjugate();
+  }
+};
+
+} // end namespace internal
+
+/** Compute / recompute the decomposition A = P^T L D L^* P of \a matrix
+  */
+template<typename MatrixType, int _UpLo>
+BunchKaufman<MatrixType,_UpLo>& BunchKaufman<MatrixType,_UpLo>::compute(const MatrixType& a)
+{
+  eigen_assert(a.rows()==a.cols());
+  const Index size = a.rows();
+
+  m_matrix = a;
+
+  m_transpositions.resize(size);
+  m_subdiagonal.resize(size);
+  m_isInitialized = false;
+
+  internal::bunch_kaufman_inplace<UpLo>::blocked(m_matrix, m_transpositions, m_subdiagonal);
+
+  m_isInitialized = true;
+  return *this;
+}
+
+namespace internal {
+template<typename _MatrixType, int _UpLo, typename Rhs>
+struct solve_retval<BunchKaufman<_MatrixType,_UpLo>, Rhs>
+  : solve_retval_base<BunchKaufman<_MatrixType,_UpLo>, Rhs>
+{
+  typedef BunchKaufman<_MatrixType,_UpLo> BunchKaufmanType;
+  EIGEN_MAKE_SOLVE_HELPERS(BunchKaufmanType,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    eigen_assert(rhs().rows() == dec().matrixLDLT().rows());
+    // dst = P b
+    dst = dec().transpositionsP() * rhs();
+
+    // dst = L^-1 (P b)
+    dec().matrixL().solveInPlace(dst);
+
+    // dst = D^-1 (L^-1 P b), using the pseudo-inverse of the 1x1 blocks as in LDLT
+    using std::abs;
+    using std::max;
+    typedef typename BunchKaufmanType::MatrixType MatrixType;
+    typedef typename BunchKaufmanType::Scalar Scalar;
+    typedef typename BunchKaufmanType::RealScalar RealScalar;
+    const Diagonal<const MatrixType> vectorD = dec().vectorD();
+    const typename BunchKaufmanType::TmpMatrixType& subdiagD = dec().subdiagonalD();
+    RealScalar tolerance = (max)(vectorD.array().abs().maxCoeff() * NumTraits<Scalar>::epsilon(),
+                                 RealScalar(1) / NumTraits<RealScalar>::highest()); // motivated by LAPACK's xGELSS
+    for (Index i = 0; i < vectorD.size(); ++i)
+    {
+      if(i+1 < vectorD.size() && subdiagD.coeff(i) != Scalar(0))
+      {
+        // the 2x2 block [a conj(b); b c] is invertible by construction
+        Scalar a = vectorD.coeff(i), b = subdiagD.coeff(i), c = vectorD.coeff(i+1);
+        Scalar det = a*c - b*conj(b);
+        typename Dest::RowXpr x0 = dst.row(i), x1 = dst.row(i+1);
+        for (Index j = 0; j < dst.cols(); ++j)
+        {
+          Scalar y0 = x0.coeff(j), y1 = x1.coeff(j);
+          x0.coeffRef(j) = (c*y0 - conj(b)*y1) / det;
+          x1.coeffRef(j) = (a*y1 - b*y0) / det;
+        }
+        ++i;
+      }
+      else if(abs(vectorD(i)) > tolerance)
+        dst.row(i) /= vectorD(i);
+      else
+        dst.row(i).setZero();
+    }
+
+    // dst = L^-* (D^-1 L^-1 P b)
+    dec().matrixU().solveInPlace(dst);
+
+    // dst = P^-1 (L^-* D^-1 L^-1 P b) = A^-1 b
+    dst = dec().transpositionsP().transpose() * dst;
+  }
+};
+}
+
+/** \returns the matrix represented by the decomposition,
+ * i.e., it returns the product: P^T L D L^* P.
+ * This function is provided for debug purpose. */
+template<typename MatrixType, int _UpLo>
+MatrixType BunchKaufman<MatrixType,_UpLo>::reconstructedMatrix() const
+{
+  eigen_assert(m_isInitialized && "BunchKaufman is not initialized.");
+  const Index size = m_matrix.rows();
+  MatrixType res(size,size);
+
+  // L^* P
+  res.setIdentity();
+  res = transpositionsP() * res;
+  res = matrixU() * res;
+  // D(L^*P), D being tridiagonal
+  MatrixType tmp = vectorD().asDiagonal() * res;
+  for (Index i = 0; i+1 < size; ++i)
+  {
+    tmp.row(i+1) += m_subdiagonal.coeff(i) * res.row(i);
+    tmp.row(i) += internal::conj(m_subdiagonal.coeff(i)) * res.row(i+1);
+  }
+  // P^T L (DL^*P)
+  res = matrixL() * tmp;
+  res = transpositionsP().transpose() * res;
+
+  return res;
+}
+
+} // end namespace Eigen
+
+#endif // EIGEN_BUNCHKAUFMAN_H
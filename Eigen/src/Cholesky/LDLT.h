@@ -40,7 +40,10 @@ template<typename MatrixType, int UpLo> struct LDLT_Traits;
   * Remember that Cholesky decompositions are not rank-revealing. Also, do not use a Cholesky
   * decomposition to determine whether a system of equations has a solution.
   *
-  * \sa MatrixBase::ldlt(), class LLT
+  * The pivots only depend on the diagonal of \f$ A \f$, which is not enough for indefinite matrices:
+  * use class BunchKaufman for them.
+  *
+  * \sa MatrixBase::ldlt(), class LLT, class BunchKaufman
   */
 template<typename _MatrixType, int _UpLo> class LDLT
 {
@@ -291,22 +294,7 @@ template<> struct ldlt_inplace<Lower>
 
       transpositions.coeffRef(k) = index_of_biggest_in_corner;
       if(k != index_of_biggest_in_corner)
-      {
-        // apply the transposition while taking care to consider only
-        // the lower triangular part
-        Index s = size-index_of_biggest_in_corner-1; // trailing size after the biggest element
-        mat.row(k).head(k).swap(mat.row(index_of_biggest_in_corner).head(k));
-        mat.col(k).tail(s).swap(mat.col(index_of_biggest_in_corner).tail(s));
-        std::swap(mat.coeffRef(k,k),mat.coeffRef(index_of_biggest_in_corner,index_of_biggest_in_corner));
-        for(int i=k+1;i<index_of_biggest_in_corner;++i)
-        {
-          Scalar tmp = mat.coeffRef(i,k);
-          mat.coeffRef(i,k) = conj(mat.coeffRef(index_of_biggest_in_corner,i));
-          mat.coeffRef(index_of_biggest_in_corner,i) = conj(tmp);
-        }
-        if(NumTraits<Scalar>::IsComplex)
-          mat.coeffRef(index_of_biggest_in_corner,k) = conj(mat.coeff(index_of_biggest_in_corner,k));
-      }
+        swapRowsAndCols(mat, k, index_of_biggest_in_corner);
 
       // partition the matrix:
       //       A00 |  -  |  -
@@ -331,6 +319,121 @@ template<> struct ldlt_inplace<Lower>
     return true;
   }
 
+  /** \internal Blocked version of unblocked() for large matrices. The pivots are chosen as in
+    * unblocked(), from the diagonal of the input matrix only, so that they are computed first
+    * and the permuted matrix is factorized by panels. Each panel is factorized by the left-looking
+    * algorithm of unblocked(), and the remaining matrix is updated by a selfadjoint rank-k
+    * product A22 -= L21 D L21^*.
+    */
+  template<typename MatrixType, typename TranspositionType, typename Workspace>
+  static bool blocked(MatrixType& mat, TranspositionType& transpositions, Workspace& temp, int* sign=0)
+  {
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::RealScalar RealScalar;
+    typedef typename MatrixType::Index Index;
+    eigen_assert(mat.rows()==mat.cols());
+    const Index size = mat.rows();
+    if(size<32)
+      return unblocked(mat, transpositions, temp, sign);
+
+    // find the pivots and the number of columns to factorize
+    RealScalar cutoff(0), biggest_in_corner;
+    Index rank = size;
+    temp = mat.diagonal();
+    for (Index k = 0; k < size; ++k)
+    {
+      Index index_of_biggest_in_corner;
+      biggest_in_corner = temp.tail(size-k).cwiseAbs().maxCoeff(&index_of_biggest_in_corner);
+      index_of_biggest_in_corner += k;
+
+      if(k == 0)
+      {
+        cutoff = abs(NumTraits<Scalar>::epsilon() * biggest_in_corner);
+        if(sign)
+          *sign = real(temp.coeff(index_of_biggest_in_corner)) > 0 ? 1 : -1;
+      }
+
+      if(biggest_in_corner < cutoff)
+      {
+        for(Index i = k; i < size; i++) transpositions.coeffRef(i) = i;
+        rank = k;
+        break;
+      }
+
+      transpositions.coeffRef(k) = index_of_biggest_in_corner;
+      std::swap(temp.coeffRef(k), temp.coeffRef(index_of_biggest_in_corner));
+    }
+    for (Index k = 0; k < rank; ++k)
+      if(transpositions.coeff(k) != k)
+        swapRowsAndCols(mat, k, transpositions.coeff(k));
+
+    Index blockSize = size/8;
+    blockSize = (blockSize/16)*16;
+    blockSize = (std::min)((std::max)(blockSize,Index(8)), Index(128));
+    Matrix<Scalar,Dynamic,Dynamic> W;
+
+    for (Index k = 0; k < rank; k += blockSize)
+    {
+      // partition the matrix:
+      //       A00 |  -  |  -
+      // lu  = A10 | A11 |  -
+      //       A20 | A21 | A22
+      // the columns of A21 and A22 beyond the rank are not updated, like in unblocked().
+      Index bs = (std::min)(blockSize, rank-k);
+      Index rs = size - k - bs;
+      Index ts = rank - k - bs;
+
+      for (Index j = k; j < k+bs; ++j)
+      {
+        Index c = j-k;
+        Index rj = size - j - 1;
+        if(c>0)
+        {
+          temp.head(c) = mat.diagonal().segment(k,c).asDiagonal() * mat.row(j).segment(k,c).adjoint();
+          mat.coeffRef(j,j) -= (mat.row(j).segment(k,c) * temp.head(c)).value();
+          if(rj>0)
+            mat.col(j).tail(rj).noalias() -= mat.block(j+1,k,rj,c) * temp.head(c);
+        }
+        if((rj>0) && (abs(mat.coeffRef(j,j)) > cutoff))
+          mat.col(j).tail(rj) /= mat.coeffRef(j,j);
+      }
+
+      if(ts>0)
+      {
+        Block<MatrixType,Dynamic,Dynamic> A21(mat,k+bs,k,rs,bs);
+        W = A21.topRows(ts) * mat.diagonal().segment(k,bs).conjugate().asDiagonal();
+        mat.block(k+bs,k+bs,ts,ts).template triangularView<Lower>() -= A21.topRows(ts) * W.adjoint(); // bottleneck
+        if(rs>ts)
+          mat.block(rank,k+bs,rs-ts,ts).noalias() -= A21.bottomRows(rs-ts) * W.adjoint();
+      }
+    }
+
+    return true;
+  }
+
+  /** \internal Applies the transposition of the rows and columns \a k < \a p of the
+    * selfadjoint matrix whose lower triangular part is \a mat. */
+  template<typename MatrixType>
+  static void swapRowsAndCols(MatrixType& mat, typename MatrixType::Index k, typename MatrixType::Index p)
+  {
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename MatrixType::Index Index;
+    // apply the transposition while taking care to consider only
+    // the lower triangular part
+    Index s = mat.rows()-p-1; // trailing size after the biggest element
+    mat.row(k).head(k).swap(mat.row(p).head(k));
+    mat.col(k).tail(s).swap(mat.col(p).tail(s));
+    std::swap(mat.coeffRef(k,k),mat.coeffRef(p,p));
+    for(Index i=k+1;i<p;++i)
+    {
+      Scalar tmp = mat.coeffRef(i,k);
+      mat.coeffRef(i,k) = conj(mat.coeffRef(p,i));
+      mat.coeffRef(p,i) = conj(tmp);
+    }
+    if(NumTraits<Scalar>::IsComplex)
+      mat.coeffRef(p,k) = conj(mat.coeff(p,k));
+  }
+
   // Reference for the algorithm: Davis and Hager, "Multiple Rank
   // Modifications of a Sparse Cholesky Factorization" (Algorithm 1)
   // Trivial rearrangements of their computations (Timothy E. Holy)
@@ -396,6 +499,13 @@ template<> struct ldlt_inplace<Upper>
     return ldlt_inplace<Lower>::unblocked(matt, transpositions, temp, sign);
   }
 
+  template<typename MatrixType, typename TranspositionType, typename Workspace>
+  static EIGEN_STRONG_INLINE bool blocked(MatrixType& mat, TranspositionType& transpositions, Workspace& temp, int* sign=0)
+  {
+    Transpose<MatrixType> matt(mat);
+    return ldlt_inplace<Lower>::blocked(matt, transpositions, temp, sign);
+  }
+
   template<typename MatrixType, typename TranspositionType, typename Workspace, typename WType>
   static EIGEN_STRONG_INLINE bool update(MatrixType& mat, TranspositionType& transpositions, Workspace& tmp, WType& w, typename MatrixType::RealScalar sigma=1)
   {
@@ -436,7 +546,7 @@ LDLT<MatrixType,_UpLo>& LDLT<MatrixType,_UpLo>::compute(const MatrixType& a)
   m_isInitialized = false;
   m_temporary.resize(size);
 
-  internal::ldlt_inplace<UpLo>::unblocked(m_matrix, m_transpositions, m_temporary, &m_sign);
+  internal::ldlt_inplace<UpLo>::blocked(m_matrix, m_transpositions, m_temporary, &m_sign);
 
   m_isInitialized = true;
   return *this;
@@ -299,6 +299,11 @@ template<typename Scalar> struct llt_inplace<Scalar, Lower>
     blockSize = (blockSize/16)*16;
     blockSize = (std::min)((std::max)(blockSize,Index(8)), Index(128));
 
+#ifdef EIGEN_HAS_OPENMP
+    if(size>=EIGEN_PARALLEL_LLT_THRESHOLD && omp_get_num_threads()==1 && nbThreads()>1)
+      return tiled(m, blockSize);
+#endif
+
     for (Index k=0; k<size; k+=blockSize)
     {
       // partition the matrix:
@@ -319,6 +324,143 @@ template<typename Scalar> struct llt_inplace<Scalar, Lower>
     return -1;
   }
 
+  /** \internal Tiled version of blocked(), whose tasks are scheduled on the OpenMP threads as soon as their
+    * dependencies are satisfied. The tile (i,j), i>=j, is updated by the tiles (i,k) and (j,k) for k<j in
+    * that order, and then either factorized if it is diagonal, or solved against the tile (j,j).
+    * The next tasks are taken from a heap keyed by the column of their tile, so that the factorization of
+    * the next block column overlaps the updates of the remaining matrix.
+    */
+  template<typename MatrixType>
+  static typename MatrixType::Index tiled(MatrixType& m, typename MatrixType::Index tileSize)
+  {
+    typedef typename MatrixType::Index Index;
+    typedef Map<Matrix<Scalar,Dynamic,Dynamic,MatrixType::Flags&RowMajorBit?RowMajor:ColMajor>, 0, OuterStride<> > TileType;
+    eigen_assert(m.rows()==m.cols());
+    const Index size = m.rows();
+    const Index nt = (size+tileSize-1)/tileSize;
+
+    // number of tasks done on each tile, which is done after j+1 of them
+    Matrix<Index,Dynamic,1> tasks = Matrix<Index,Dynamic,1>::Zero(nt*nt);
+    Matrix<bool,Dynamic,1> queued = Matrix<bool,Dynamic,1>::Constant(nt*nt, false);
+    Matrix<Index,Dynamic,1> heap(nt*nt);
+    Index heapSize = 0;
+    Index remaining = nt*(nt+1)/2;
+    Index failure = -1;
+
+    heap.coeffRef(heapSize++) = 0;
+    queued.coeffRef(0) = true;
+
+    #ifdef EIGEN_HAS_OPENMP
+    #pragma omp parallel num_threads(nbThreads())
+    #endif
+    for(;;)
+    {
+      Index key = -1;
+      bool stop = false;
+      #ifdef EIGEN_HAS_OPENMP
+      #pragma omp critical(eigen_llt_tiled)
+      #endif
+      {
+        if(remaining==0 || failure>=0)
+          stop = true;
+        else if(heapSize>0)
+        {
+          std::pop_heap(heap.data(), heap.data()+heapSize, std::greater<Index>());
+          key = heap.coeff(--heapSize);
+        }
+      }
+      if(stop)
+        break;
+      if(key<0)
+      {
+        // nothing is ready: wait outside of the critical section, with an exponential back-off,
+        // until a task is queued or the factorization stops, so that the working threads are not held up
+        for(int spins=1; ; spins=(std::min)(2*spins, 1<<12))
+        {
+          for(volatile int s=0; s<spins; s=s+1) {}
+          #ifdef EIGEN_HAS_OPENMP
+          #pragma omp flush
+          #endif
+          if(heapSize>0 || remaining==0 || failure>=0)
+            break;
+        }
+        continue;
+      }
+
+      const Index i = key%nt, j = key/nt;
+      const Index k = tasks.coeff(i*nt+j);
+      const Index ri = i*tileSize, rj = j*tileSize;
+      const Index bi = (std::min)(tileSize, size-ri), bj = (std::min)(tileSize, size-rj);
+      Block<MatrixType,Dynamic,Dynamic> Aij(m,ri,rj,bi,bj);
+      Index ret = -1;
+      if(k<j)
+      {
+        Block<MatrixType,Dynamic,Dynamic> Aik(m,ri,k*tileSize,bi,tileSize);
+        if(i==j)
+          Aij.template selfadjointView<Lower>().rankUpdate(Aik,-1);
+        else
+          Aij.noalias() -= Aik * Block<MatrixType,Dynamic,Dynamic>(m,rj,k*tileSize,bj,tileSize).adjoint();
+      }
+      else if(i==j)
+      {
+        TileType Ajj(&Aij.coeffRef(0,0), bj, bj, OuterStride<>(m.outerStride()));
+        ret = blocked(Ajj);
+      }
+      else
+      {
+        Block<MatrixType,Dynamic,Dynamic> Ajj(m,rj,rj,bj,bj);
+        Ajj.adjoint().template triangularView<Upper>().template solveInPlace<OnTheRight>(Aij);
+      }
+
+      #ifdef EIGEN_HAS_OPENMP
+      #pragma omp critical(eigen_llt_tiled)
+      #endif
+      {
+        if(ret>=0)
+          failure = rj+ret;
+        else
+        {
+          tasks.coeffRef(i*nt+j) = k+1;
+          queued.coeffRef(i*nt+j) = false;
+          if(k<j)
+            push_if_ready(i, j, nt, tasks, queued, heap, heapSize);
+          else
+          {
+            // the tile is done, queue the tasks which were waiting for it
+            --remaining;
+            if(i==j)
+              for(Index i1=j+1; i1<nt; ++i1)
+                push_if_ready(i1, j, nt, tasks, queued, heap, heapSize);
+            else
+            {
+              for(Index j1=j+1; j1<=i; ++j1)
+                push_if_ready(i, j1, nt, tasks, queued, heap, heapSize);
+              for(Index i1=i+1; i1<nt; ++i1)
+                push_if_ready(i1, i, nt, tasks, queued, heap, heapSize);
+            }
+          }
+        }
+      }
+    }
+    return failure;
+  }
+
+  /** \internal Queues the next task of the tile (i,j) of tiled() if its dependencies are done. */
+  template<typename Index, typename IndexVector, typename BoolVector>
+  static void push_if_ready(Index i, Index j, Index nt, const IndexVector& tasks, BoolVector& queued, IndexVector& heap, Index& heapSize)
+  {
+    const Index k = tasks.coeff(i*nt+j);
+    if(queued.coeff(i*nt+j) || k>j)
+      return;
+    // the tile (a,b) is done after b+1 tasks
+    if(k<j ? (tasks.coeff(i*nt+k)>k && tasks.coeff(j*nt+k)>k) : (i==j || tasks.coeff(j*nt+j)>j))
+    {
+      queued.coeffRef(i*nt+j) = true;
+      heap.coeffRef(heapSize++) = j*nt+i;
+      std::push_heap(heap.data(), heap.data()+heapSize, std::greater<Index>());
+    }
+  }
+
   template<typename MatrixType, typename VectorType>
   static typename MatrixType::Index rankUpdate(MatrixType& mat, const VectorType& vec, const RealScalar& sigma)
   {
@@ -342,6 +484,12 @@ template<typename Scalar> struct llt_inplace<Scalar, Upper>
     Transpose<MatrixType> matt(mat);
     return llt_inplace<Scalar, Lower>::blocked(matt);
   }
+  template<typename MatrixType>
+  static EIGEN_STRONG_INLINE typename MatrixType::Index tiled(MatrixType& mat, typename MatrixType::Index tileSize)
+  {
+    Transpose<MatrixType> matt(mat);
+    return llt_inplace<Scalar, Lower>::tiled(matt, tileSize);
+  }
   template<typename MatrixType, typename VectorType>
   static typename MatrixType::Index rankUpdate(MatrixType& mat, const VectorType& vec, const RealScalar& sigma)
   {
@@ -236,6 +236,58 @@ struct assign_innervec_InnerUnrolling<Derived1, Derived2, Stop, Stop>
 * Part 3 : implementation of all cases
 ***************************************************************************/
 
+/** \internal \returns an estimate of the cost of reading one coefficient of \a src when Derived::CoeffReadCost
+  * is Dynamic. Expressions whose cost depends on their sizes, like partial reductions, specialize it. */
+template<typename Derived>
+struct dynamic_coeff_read_cost
+{
+  static inline typename Derived::Index run(const Derived&)
+  { return EIGEN_PARALLEL_ASSIGN_THRESHOLD; }
+};
+
+/** \internal \returns the number of threads among which the assignment of \a size coefficients of \a src
+  * should be split. This is more than one only if OpenMP is enabled, we are not already in a parallel region, and
+  * each thread gets at least EIGEN_PARALLEL_ASSIGN_THRESHOLD of work as estimated from Derived::CoeffReadCost.
+  * Expressions which have to be evaluated before being nested, like random generators, are never split since
+  * their coefficients might have to be computed in order, and neither are expressions nesting a functor which is
+  * not parallel safe, like the sequential LinSpaced or a user functor.
+  */
+template<typename Derived>
+inline typename Derived::Index parallel_assign_threads(const Derived& src, typename Derived::Index size)
+{
+#ifdef EIGEN_HAS_OPENMP
+  typedef typename Derived::Index Index;
+  if((int(Derived::Flags)&(EvalBeforeNestingBit|ParallelUnsafeBit)) || omp_get_num_threads()>1)
+    return 1;
+  const Index cost = (std::max)(Index(1), int(Derived::CoeffReadCost)==Dynamic ? dynamic_coeff_read_cost<Derived>::run(src)
+                                                                              : Index(Derived::CoeffReadCost));
+  if(size*cost < 2*Index(EIGEN_PARALLEL_ASSIGN_THRESHOLD))
+    return 1;
+  int threads;
+  manage_multi_threading(GetAction, &threads);
+  return (std::max)(Index(1), (std::min)(Index(threads), size*cost/Index(EIGEN_PARALLEL_ASSIGN_THRESHOLD)));
+#else
+  EIGEN_UNUSED_VARIABLE(src);
+  EIGEN_UNUSED_VARIABLE(size);
+  return 1;
+#endif
+}
+
+/** \internal \returns whether an aligned destination of \a bytes bytes should be written with non-temporal stores,
+  * i.e., whether it is larger than EIGEN_STREAMING_STORE_THRESHOLD, or than the top level cache by default.
+  */
+inline bool use_streaming_stores(std::ptrdiff_t bytes)
+{
+#ifndef EIGEN_DONT_USE_STREAMING_STORES
+  static const std::ptrdiff_t threshold = EIGEN_STREAMING_STORE_THRESHOLD > 0 ? std::ptrdiff_t(EIGEN_STREAMING_STORE_THRESHOLD)
+                                                                             : std::ptrdiff_t(queryTopLevelCacheSize());
+  return threshold > 0 && bytes > threshold;
+#else
+  EIGEN_UNUSED_VARIABLE(bytes);
+  return false;
+#endif
+}
+
 template<typename Derived1, typename Derived2,
          int Traversal = assign_traits<Derived1, Derived2>::Traversal,
          int Unrolling = assign_traits<Derived1, Derived2>::Unrolling,
@@ -300,6 +352,21 @@ struct assign_impl<Derived1, Derived2, LinearTraversal, NoUnrolling, Version>
   static inline void run(Derived1 &dst, const Derived2 &src)
   {
     const Index size = dst.size();
+#ifdef EIGEN_HAS_OPENMP
+    const Index threads = parallel_assign_threads(src, size);
+    if(threads>1)
+    {
+      const Index chunkSize = (size+threads-1)/threads;
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+      for(Index t = 0; t < threads; ++t)
+      {
+        const Index end = (std::min)((t+1)*chunkSize, size);
+        for(Index i = t*chunkSize; i < end; ++i)
+          dst.copyCoeff(i, src);
+      }
+      return;
+    }
+#endif
     for(Index i = 0; i < size; ++i)
       dst.copyCoeff(i, src);
   }
@@ -328,6 +395,17 @@ struct assign_impl<Derived1, Derived2, InnerVectorizedTraversal, NoUnrolling, Ve
     const Index innerSize = dst.innerSize();
     const Index outerSize = dst.outerSize();
     const Index packetSize = packet_traits<typename Derived1::Scalar>::size;
+#ifdef EIGEN_HAS_OPENMP
+    const Index threads = (std::min)(outerSize, parallel_assign_threads(src, dst.size()));
+    if(threads>1)
+    {
+      #pragma omp parallel for schedule(static) num_threads(threads)
+      for(Index outer = 0; outer < outerSize; ++outer)
+        for(Index inner = 0; inner < innerSize; inner+=packetSize)
+          dst.template copyPacketByOuterInner<Derived2, Aligned, Aligned>(outer, inner, src);
+      return;
+    }
+#endif
     for(Index outer = 0; outer < outerSize; ++outer)
       for(Index inner = 0; inner < innerSize; inner+=packetSize)
         dst.template copyPacketByOuterInner<Derived2, Aligned, Aligned>(outer, inner, src);
@@ -351,6 +429,17 @@ struct assign_impl<Derived1, Derived2, InnerVectorizedTraversal, InnerUnrolling,
   static EIGEN_STRONG_INLINE void run(Derived1 &dst, const Derived2 &src)
   {
     const Index outerSize = dst.outerSize();
+#ifdef EIGEN_HAS_OPENMP
+    const Index threads = (std::min)(outerSize, parallel_assign_threads(src, dst.size()));
+    if(threads>1)
+    {
+      #pragma omp parallel for schedule(static) num_threads(threads)
+      for(Index outer = 0; outer < outerSize; ++outer)
+        assign_innervec_InnerUnrolling<Derived1, Derived2, 0, Derived1::InnerSizeAtCompileTime>
+          ::run(dst, src, outer);
+      return;
+    }
+#endif
     for(Index outer = 0; outer < outerSize; ++outer)
       assign_innervec_InnerUnrolling<Derived1, Derived2, 0, Derived1::InnerSizeAtCompileTime>
         ::run(dst, src, outer);
@@ -405,12 +494,45 @@ struct assign_impl<Derived1, Derived2, LinearVectorizedTraversal, NoUnrolling, V
 
     unaligned_assign_impl<assign_traits<Derived1,Derived2>::DstIsAligned!=0>::run(src,dst,0,alignedStart);
 
+    // large destinations are written with non-temporal stores to avoid reading them into the caches
+    if(int(dstAlignment)==Aligned && (int(Derived1::Flags)&DirectAccessBit) && alignedStart<alignedEnd
+       && use_streaming_stores((alignedEnd-alignedStart)*Index(sizeof(typename Derived1::Scalar))))
+      run_packets<AlignedStreaming, srcAlignment>(dst, src, alignedStart, alignedEnd);
+    else
+      run_packets<dstAlignment, srcAlignment>(dst, src, alignedStart, alignedEnd);
+
+    unaligned_assign_impl<>::run(src,dst,alignedEnd,size);
+  }
+
+  template<int DstAlignment, int SrcAlignment>
+  static EIGEN_STRONG_INLINE void run_packets(Derived1 &dst, const Derived2 &src, Index alignedStart, Index alignedEnd)
+  {
+    typedef typename packet_traits<typename Derived1::Scalar>::type PacketScalar;
+    enum { packetSize = packet_traits<typename Derived1::Scalar>::size };
+#ifdef EIGEN_HAS_OPENMP
+    const Index threads = parallel_assign_threads(src, alignedEnd-alignedStart);
+    if(threads>1)
+    {
+      // each thread takes a packet aligned chunk of the vectorizable part
+      const Index chunkSize = (((alignedEnd-alignedStart)/packetSize+threads-1)/threads)*packetSize;
+      #pragma omp parallel for schedule(static,1) num_threads(threads)
+      for(Index t = 0; t < threads; ++t)
+      {
+        const Index end = (std::min)(alignedStart+(t+1)*chunkSize, alignedEnd);
+        for(Index index = alignedStart+t*chunkSize; index < end; index += packetSize)
+          dst.template copyPacket<Derived2, DstAlignment, SrcAlignment>(index, src);
+        if(DstAlignment==AlignedStreaming)
+          pstreamfence<PacketScalar>();
+      }
+      return;
+    }
+#endif
     for(Index index = alignedStart; index < alignedEnd; index += packetSize)
     {
-      dst.template copyPacket<Derived2, dstAlignment, srcAlignment>(index, src);
+      dst.template copyPacket<Derived2, DstAlignment, SrcAlignment>(index, src);
     }
-
-    unaligned_assign_impl<>::run(src,dst,alignedEnd,size);
+    if(DstAlignment==AlignedStreaming)
+      pstreamfence<PacketScalar>();
   }
 };
 
@@ -66,6 +66,96 @@ struct any_unroller<Derived, Dynamic>
   static inline bool run(const Derived &) { return false; }
 };
 
+template<typename Derived,
+         bool Vectorize = cwise_mask<Derived, typename cwise_mask_scalar<Derived>::type>::PacketAccess>
+struct boolean_redux_impl
+{
+  typedef typename Derived::Index Index;
+
+  static inline bool all(const Derived& mat)
+  {
+    for(Index j = 0; j < mat.cols(); ++j)
+      for(Index i = 0; i < mat.rows(); ++i)
+        if (!mat.coeff(i, j)) return false;
+    return true;
+  }
+
+  static inline bool any(const Derived& mat)
+  {
+    for(Index j = 0; j < mat.cols(); ++j)
+      for(Index i = 0; i < mat.rows(); ++i)
+        if (mat.coeff(i, j)) return true;
+    return false;
+  }
+
+  static inline Index count(const Derived& mat)
+  {
+    return mat.template cast<bool>().template cast<Index>().sum();
+  }
+};
+
+// When the boolean expression is a comparison, or a logical combination of comparisons, of vectorizable
+// expressions, its coefficients are evaluated a packet of masks at a time, and all() and any() return as
+// soon as a packet decides the result.
+template<typename Derived>
+struct boolean_redux_impl<Derived, true>
+{
+  typedef typename Derived::Index Index;
+  typedef typename cwise_mask_scalar<Derived>::type Scalar;
+  typedef cwise_mask<Derived, Scalar> Mask;
+  typedef typename packet_traits<Scalar>::type Packet;
+  enum { PacketSize = packet_traits<Scalar>::size };
+
+  static EIGEN_STRONG_INLINE Packet mask(const Derived& mat, Index outer, Index inner)
+  {
+    return Mask::template packet<Unaligned>(mat, mat.rowIndexByOuterInner(outer, inner),
+                                                 mat.colIndexByOuterInner(outer, inner));
+  }
+
+  static inline bool all(const Derived& mat)
+  {
+    const Index innerSize = mat.innerSize();
+    const Index alignedEnd = (innerSize/PacketSize)*PacketSize;
+    for(Index j = 0; j < mat.outerSize(); ++j)
+    {
+      for(Index i = 0; i < alignedEnd; i += PacketSize)
+        if (!predux_all(mask(mat, j, i))) return false;
+      for(Index i = alignedEnd; i < innerSize; ++i)
+        if (!mat.coeffByOuterInner(j, i)) return false;
+    }
+    return true;
+  }
+
+  static inline bool any(const Derived& mat)
+  {
+    const Index innerSize = mat.innerSize();
+    const Index alignedEnd = (innerSize/PacketSize)*PacketSize;
+    for(Index j = 0; j < mat.outerSize(); ++j)
+    {
+      for(Index i = 0; i < alignedEnd; i += PacketSize)
+        if (predux_any(mask(mat, j, i))) return true;
+      for(Index i = alignedEnd; i < innerSize; ++i)
+        if (mat.coeffByOuterInner(j, i)) return true;
+    }
+    return false;
+  }
+
+  static inline Index count(const Derived& mat)
+  {
+    const Index innerSize = mat.innerSize();
+    const Index alignedEnd = (innerSize/PacketSize)*PacketSize;
+    Index res = 0;
+    for(Index j = 0; j < mat.outerSize(); ++j)
+    {
+      for(Index i = 0; i < alignedEnd; i += PacketSize)
+        res += predux_count(mask(mat, j, i));
+      for(Index i = alignedEnd; i < innerSize; ++i)
+        if (mat.coeffByOuterInner(j, i)) ++res;
+    }
+    return res;
+  }
+};
+
 } // end namespace internal
 
 /** \returns true if all coefficients are true
@@ -89,12 +179,7 @@ inline bool DenseBase<Derived>::all() const
                            unroll ? int(SizeAtCompileTime) : Dynamic
      >::run(derived());
   else
-  {
-    for(Index j = 0; j < cols(); ++j)
-      for(Index i = 0; i < rows(); ++i)
-        if (!coeff(i, j)) return false;
-    return true;
-  }
+    return internal::boolean_redux_impl<Derived>::all(derived());
 }
 
 /** \returns true if at least one coefficient is true
@@ -115,12 +200,7 @@ inline bool DenseBase<Derived>::any() const
                            unroll ? int(SizeAtCompileTime) : Dynamic
            >::run(derived());
   else
-  {
-    for(Index j = 0; j < cols(); ++j)
-      for(Index i = 0; i < rows(); ++i)
-        if (coeff(i, j)) return true;
-    return false;
-  }
+    return internal::boolean_redux_impl<Derived>::any(derived());
 }
 
 /** \returns the number of coefficients which evaluate to true
@@ -130,7 +210,7 @@ inline bool DenseBase<Derived>::any() const
 template<typename Derived>
 inline typename DenseBase<Derived>::Index DenseBase<Derived>::count() const
 {
-  return derived().template cast<bool>().template cast<Index>().sum();
+  return internal::boolean_redux_impl<Derived>::count(derived());
 }
 
 } // end namespace Eigen
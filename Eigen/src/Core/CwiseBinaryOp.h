@@ -80,10 +80,97 @@ struct traits<CwiseBinaryOp<BinaryOp, Lhs, Rhs> >
            )
         )
      ),
-    Flags = (Flags0 & ~RowMajorBit) | (LhsFlags & RowMajorBit),
+    Flags = (Flags0 & ~RowMajorBit) | (LhsFlags & RowMajorBit)
+          | (functor_is_parallel_safe<BinaryOp>::ret ? 0 : ParallelUnsafeBit),
     CoeffReadCost = LhsCoeffReadCost + RhsCoeffReadCost + functor_traits<BinaryOp>::Cost
   };
 };
+
+template<typename BinaryOp, typename Lhs, typename Rhs, typename Scalar>
+struct cwise_mask<CwiseBinaryOp<BinaryOp, Lhs, Rhs>, Scalar>
+{
+  typedef CwiseBinaryOp<BinaryOp, Lhs, Rhs> XprType;
+  typedef typename XprType::Index Index;
+  typedef typename packet_traits<Scalar>::type PacketScalar;
+  enum {
+    PacketAccess = functor_cmp_mask<BinaryOp>::PacketAccess
+                && is_same<typename Lhs::Scalar, Scalar>::value
+                && bool(int(traits<XprType>::LhsFlags) & int(traits<XprType>::RhsFlags) & PacketAccessBit)
+                && traits<XprType>::StorageOrdersAgree
+  };
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar packet(const XprType& xpr, Index row, Index col)
+  {
+    return functor_cmp_mask<BinaryOp>::run(xpr.lhs().template packet<LoadMode>(row, col),
+                                           xpr.rhs().template packet<LoadMode>(row, col));
+  }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar packet(const XprType& xpr, Index index)
+  {
+    return functor_cmp_mask<BinaryOp>::run(xpr.lhs().template packet<LoadMode>(index),
+                                           xpr.rhs().template packet<LoadMode>(index));
+  }
+};
+
+template<typename BinaryOp, typename Lhs, typename Rhs>
+struct cwise_mask_scalar<CwiseBinaryOp<BinaryOp, Lhs, Rhs> >
+{
+  typedef typename conditional<functor_cmp_mask<BinaryOp>::PacketAccess, typename Lhs::Scalar, typename traits<CwiseBinaryOp<BinaryOp, Lhs, Rhs> >::Scalar>::type type;
+};
+
+// logical and and or of comparisons combine their masks
+template<typename BinaryOp, typename Lhs, typename Rhs, typename Scalar>
+struct cwise_mask_logical
+{
+  typedef CwiseBinaryOp<BinaryOp, Lhs, Rhs> XprType;
+  typedef typename XprType::Index Index;
+  typedef typename packet_traits<Scalar>::type PacketScalar;
+  typedef cwise_mask<typename remove_all<Lhs>::type, Scalar> LhsMask;
+  typedef cwise_mask<typename remove_all<Rhs>::type, Scalar> RhsMask;
+  enum {
+    PacketAccess = LhsMask::PacketAccess && RhsMask::PacketAccess && traits<XprType>::StorageOrdersAgree,
+    IsAnd = is_same<BinaryOp, scalar_boolean_and_op >::value
+  };
+
+  static EIGEN_STRONG_INLINE PacketScalar combine(const PacketScalar& a, const PacketScalar& b)
+  { return IsAnd ? pand(a,b) : por(a,b); }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar packet(const XprType& xpr, Index row, Index col)
+  {
+    return combine(LhsMask::template packet<LoadMode>(xpr.lhs(), row, col),
+                   RhsMask::template packet<LoadMode>(xpr.rhs(), row, col));
+  }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar packet(const XprType& xpr, Index index)
+  {
+    return combine(LhsMask::template packet<LoadMode>(xpr.lhs(), index),
+                   RhsMask::template packet<LoadMode>(xpr.rhs(), index));
+  }
+};
+
+template<typename Lhs, typename Rhs, typename Scalar>
+struct cwise_mask<CwiseBinaryOp<scalar_boolean_and_op, Lhs, Rhs>, Scalar>
+  : cwise_mask_logical<scalar_boolean_and_op, Lhs, Rhs, Scalar>
+{};
+
+template<typename Lhs, typename Rhs, typename Scalar>
+struct cwise_mask<CwiseBinaryOp<scalar_boolean_or_op, Lhs, Rhs>, Scalar>
+  : cwise_mask_logical<scalar_boolean_or_op, Lhs, Rhs, Scalar>
+{};
+
+template<typename Lhs, typename Rhs>
+struct cwise_mask_scalar<CwiseBinaryOp<scalar_boolean_and_op, Lhs, Rhs> >
+  : cwise_mask_scalar<typename remove_all<Lhs>::type>
+{};
+
+template<typename Lhs, typename Rhs>
+struct cwise_mask_scalar<CwiseBinaryOp<scalar_boolean_or_op, Lhs, Rhs> >
+  : cwise_mask_scalar<typename remove_all<Lhs>::type>
+{};
 } // end namespace internal
 
 // we require Lhs and Rhs to have the same scalar type. Currently there is no example of a binary functor
@@ -39,7 +39,8 @@ struct traits<CwiseNullaryOp<NullaryOp, PlainObjectType> > : traits<PlainObjectT
       & (  HereditaryBits
          | (functor_has_linear_access<NullaryOp>::ret ? LinearAccessBit : 0)
          | (functor_traits<NullaryOp>::PacketAccess ? PacketAccessBit : 0)))
-      | (functor_traits<NullaryOp>::IsRepeatable ? 0 : EvalBeforeNestingBit),
+      | (functor_traits<NullaryOp>::IsRepeatable ? 0 : EvalBeforeNestingBit)
+      | (functor_is_parallel_safe<NullaryOp>::ret ? 0 : ParallelUnsafeBit),
     CoeffReadCost = functor_traits<NullaryOp>::Cost
   };
 };
@@ -44,12 +44,195 @@ struct traits<CwiseUnaryOp<UnaryOp, XprType> >
   typedef typename XprType::Nested XprTypeNested;
   typedef typename remove_reference<XprTypeNested>::type _XprTypeNested;
   enum {
-    Flags = _XprTypeNested::Flags & (
+    Flags = (_XprTypeNested::Flags & (
       HereditaryBits | LinearAccessBit | AlignedBit
-      | (functor_traits<UnaryOp>::PacketAccess ? PacketAccessBit : 0)),
+      | (functor_traits<UnaryOp>::PacketAccess ? PacketAccessBit : 0)))
+      | (functor_is_parallel_safe<UnaryOp>::ret ? 0 : ParallelUnsafeBit),
     CoeffReadCost = _XprTypeNested::CoeffReadCost + functor_traits<UnaryOp>::Cost
   };
 };
+
+/** \internal evaluates a packet of a CwiseUnaryOp. Casts are specialized since they may need
+  * several packets, or only part of one packet, of the nested expression per packet of the result.
+  */
+template<typename UnaryOp, typename XprType>
+struct unary_op_packet
+{
+  typedef typename traits<CwiseUnaryOp<UnaryOp, XprType> >::Scalar Scalar;
+  typedef typename packet_traits<Scalar>::type PacketScalar;
+  typedef typename XprType::Index Index;
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar run(const UnaryOp& func, const XprType& xpr, Index row, Index col)
+  { return func.packetOp(xpr.template packet<LoadMode>(row, col)); }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar run(const UnaryOp& func, const XprType& xpr, Index index)
+  { return func.packetOp(xpr.template packet<LoadMode>(index)); }
+};
+
+template<typename SrcScalar, typename TgtScalar, typename XprType,
+         int SrcCoeffRatio = type_casting_traits<SrcScalar,TgtScalar>::SrcCoeffRatio,
+         int TgtCoeffRatio = type_casting_traits<SrcScalar,TgtScalar>::TgtCoeffRatio>
+struct cast_packet_impl;
+
+// one source packet per target packet
+template<typename SrcScalar, typename TgtScalar, typename XprType>
+struct cast_packet_impl<SrcScalar, TgtScalar, XprType, 1, 1>
+{
+  typedef typename packet_traits<SrcScalar>::type SrcPacket;
+  typedef typename packet_traits<TgtScalar>::type TgtPacket;
+  typedef typename XprType::Index Index;
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE TgtPacket run(const XprType& xpr, Index row, Index col)
+  { return pcast<SrcPacket,TgtPacket>(xpr.template packet<LoadMode>(row, col)); }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE TgtPacket run(const XprType& xpr, Index index)
+  { return pcast<SrcPacket,TgtPacket>(xpr.template packet<LoadMode>(index)); }
+};
+
+// two consecutive source packets per target packet, e.g., double to float
+template<typename SrcScalar, typename TgtScalar, typename XprType>
+struct cast_packet_impl<SrcScalar, TgtScalar, XprType, 2, 1>
+{
+  typedef typename packet_traits<SrcScalar>::type SrcPacket;
+  typedef typename packet_traits<TgtScalar>::type TgtPacket;
+  typedef typename XprType::Index Index;
+  enum { SrcPacketSize = packet_traits<SrcScalar>::size };
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE TgtPacket run(const XprType& xpr, Index row, Index col)
+  {
+    return pcast<SrcPacket,TgtPacket>(xpr.template packet<LoadMode>(row, col),
+                                      xpr.template packet<LoadMode>(XprType::IsRowMajor ? row : row + SrcPacketSize,
+                                                                    XprType::IsRowMajor ? col + SrcPacketSize : col));
+  }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE TgtPacket run(const XprType& xpr, Index index)
+  {
+    return pcast<SrcPacket,TgtPacket>(xpr.template packet<LoadMode>(index),
+                                      xpr.template packet<LoadMode>(index + SrcPacketSize));
+  }
+};
+
+// half a source packet per target packet, e.g., float to double. A whole source packet is read
+// when it fits in the nested expression, otherwise its first coefficients are gathered.
+template<typename SrcScalar, typename TgtScalar, typename XprType>
+struct cast_packet_impl<SrcScalar, TgtScalar, XprType, 1, 2>
+{
+  typedef typename packet_traits<SrcScalar>::type SrcPacket;
+  typedef typename packet_traits<TgtScalar>::type TgtPacket;
+  typedef typename XprType::Index Index;
+  enum { SrcPacketSize = packet_traits<SrcScalar>::size, TgtPacketSize = packet_traits<TgtScalar>::size };
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE TgtPacket run(const XprType& xpr, Index row, Index col)
+  {
+    if((XprType::IsRowMajor ? col : row) + SrcPacketSize <= xpr.innerSize())
+      return pcast<SrcPacket,TgtPacket>(xpr.template packet<Unaligned>(row, col));
+    EIGEN_ALIGN16 SrcScalar coeffs[SrcPacketSize];
+    for(int k = 0; k < SrcPacketSize; ++k)
+      coeffs[k] = k < TgtPacketSize ? xpr.coeff(XprType::IsRowMajor ? row : row + k, XprType::IsRowMajor ? col + k : col)
+                                    : SrcScalar(0);
+    return pcast<SrcPacket,TgtPacket>(pload<SrcPacket>(coeffs));
+  }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE TgtPacket run(const XprType& xpr, Index index)
+  {
+    if(index + SrcPacketSize <= xpr.size())
+      return pcast<SrcPacket,TgtPacket>(xpr.template packet<Unaligned>(index));
+    EIGEN_ALIGN16 SrcScalar coeffs[SrcPacketSize];
+    for(int k = 0; k < SrcPacketSize; ++k)
+      coeffs[k] = k < TgtPacketSize ? xpr.coeff(index + k) : SrcScalar(0);
+    return pcast<SrcPacket,TgtPacket>(pload<SrcPacket>(coeffs));
+  }
+};
+
+template<typename SrcScalar, typename TgtScalar, typename XprType>
+struct unary_op_packet<scalar_cast_op<SrcScalar,TgtScalar>, XprType>
+{
+  typedef typename packet_traits<TgtScalar>::type PacketScalar;
+  typedef typename XprType::Index Index;
+  typedef cast_packet_impl<SrcScalar, TgtScalar, XprType> Impl;
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar run(const scalar_cast_op<SrcScalar,TgtScalar>&, const XprType& xpr, Index row, Index col)
+  { return Impl::template run<LoadMode>(xpr, row, col); }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar run(const scalar_cast_op<SrcScalar,TgtScalar>&, const XprType& xpr, Index index)
+  { return Impl::template run<LoadMode>(xpr, index); }
+};
+
+template<typename Functor, typename XprType, typename Scalar>
+struct cwise_mask<CwiseUnaryOp<std::binder2nd<Functor>, XprType>, Scalar>
+{
+  typedef CwiseUnaryOp<std::binder2nd<Functor>, XprType> UnaryXprType;
+  typedef typename UnaryXprType::Index Index;
+  typedef typename packet_traits<Scalar>::type PacketScalar;
+  enum {
+    PacketAccess = functor_cmp_mask<Functor>::PacketAccess
+                && is_same<typename XprType::Scalar, Scalar>::value
+                && bool(int(traits<typename remove_all<XprType>::type>::Flags) & PacketAccessBit)
+  };
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar packet(const UnaryXprType& xpr, Index row, Index col)
+  {
+    return functor_cmp_mask<Functor>::run(xpr.nestedExpression().template packet<LoadMode>(row, col),
+                                          pset1<PacketScalar>(bound_value<std::binder2nd<Functor> >::get(xpr.functor())));
+  }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar packet(const UnaryXprType& xpr, Index index)
+  {
+    return functor_cmp_mask<Functor>::run(xpr.nestedExpression().template packet<LoadMode>(index),
+                                          pset1<PacketScalar>(bound_value<std::binder2nd<Functor> >::get(xpr.functor())));
+  }
+};
+
+template<typename Functor, typename XprType>
+struct cwise_mask_scalar<CwiseUnaryOp<std::binder2nd<Functor>, XprType> >
+{
+  typedef typename conditional<functor_cmp_mask<Functor>::PacketAccess, typename XprType::Scalar, bool>::type type;
+};
+
+template<typename Functor, typename XprType>
+struct cwise_mask_scalar<CwiseUnaryOp<std::binder1st<Functor>, XprType> >
+{
+  typedef typename conditional<functor_cmp_mask<Functor>::PacketAccess, typename XprType::Scalar, bool>::type type;
+};
+
+template<typename Functor, typename XprType, typename Scalar>
+struct cwise_mask<CwiseUnaryOp<std::binder1st<Functor>, XprType>, Scalar>
+{
+  typedef CwiseUnaryOp<std::binder1st<Functor>, XprType> UnaryXprType;
+  typedef typename UnaryXprType::Index Index;
+  typedef typename packet_traits<Scalar>::type PacketScalar;
+  enum {
+    PacketAccess = functor_cmp_mask<Functor>::PacketAccess
+                && is_same<typename XprType::Scalar, Scalar>::value
+                && bool(int(traits<typename remove_all<XprType>::type>::Flags) & PacketAccessBit)
+  };
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar packet(const UnaryXprType& xpr, Index row, Index col)
+  {
+    return functor_cmp_mask<Functor>::run(pset1<PacketScalar>(bound_value<std::binder1st<Functor> >::get(xpr.functor())),
+                                          xpr.nestedExpression().template packet<LoadMode>(row, col));
+  }
+
+  template<int LoadMode>
+  static EIGEN_STRONG_INLINE PacketScalar packet(const UnaryXprType& xpr, Index index)
+  {
+    return functor_cmp_mask<Functor>::run(pset1<PacketScalar>(bound_value<std::binder1st<Functor> >::get(xpr.functor())),
+                                          xpr.nestedExpression().template packet<LoadMode>(index));
+  }
+};
 }
 
 template<typename UnaryOp, typename XprType, typename StorageKind>
@@ -106,7 +289,8 @@ class CwiseUnaryOpImpl<UnaryOp,XprType,Dense>
     template<int LoadMode>
     EIGEN_STRONG_INLINE PacketScalar packet(Index row, Index col) const
     {
-      return derived().functor().packetOp(derived().nestedExpression().template packet<LoadMode>(row, col));
+      return internal::unary_op_packet<UnaryOp, typename internal::remove_all<typename XprType::Nested>::type>
+               ::template run<LoadMode>(derived().functor(), derived().nestedExpression(), row, col);
     }
 
     EIGEN_STRONG_INLINE const Scalar coeff(Index index) const
@@ -117,7 +301,8 @@ class CwiseUnaryOpImpl<UnaryOp,XprType,Dense>
     template<int LoadMode>
     EIGEN_STRONG_INLINE PacketScalar packet(Index index) const
     {
-      return derived().functor().packetOp(derived().nestedExpression().template packet<LoadMode>(index));
+      return internal::unary_op_packet<UnaryOp, typename internal::remove_all<typename XprType::Nested>::type>
+               ::template run<LoadMode>(derived().functor(), derived().nestedExpression(), index);
     }
 };
 
@@ -345,6 +345,7 @@ template<typename Derived> class DenseBase
     Derived& setZero();
     Derived& setOnes();
     Derived& setRandom();
+    Derived& setRandomNormal();
 
     template<typename OtherDerived>
     bool isApprox(const DenseBase<OtherDerived>& other,
@@ -457,6 +458,9 @@ template<typename Derived> class DenseBase
     static const CwiseNullaryOp<internal::scalar_random_op<Scalar>,Derived> Random(Index rows, Index cols);
     static const CwiseNullaryOp<internal::scalar_random_op<Scalar>,Derived> Random(Index size);
     static const CwiseNullaryOp<internal::scalar_random_op<Scalar>,Derived> Random();
+    static const CwiseNullaryOp<internal::scalar_normal_random_op<Scalar>,Derived> RandomNormal(Index rows, Index cols);
+    static const CwiseNullaryOp<internal::scalar_normal_random_op<Scalar>,Derived> RandomNormal(Index size);
+    static const CwiseNullaryOp<internal::scalar_normal_random_op<Scalar>,Derived> RandomNormal();
 
     template<typename ThenDerived,typename ElseDerived>
     const Select<Derived,ThenDerived,ElseDerived>
@@ -24,6 +24,15 @@ namespace internal {
 
 struct constructor_without_unaligned_array_assert {};
 
+/** \internal Applies the ParallelFirstTouch allocation policy to the new \a innerSize x \a outerSize array \a data,
+  * see parallel_first_touch(). Scalar types which require initialization are left untouched. */
+template<typename T>
+inline void dense_storage_first_touch(T* data, DenseIndex innerSize, DenseIndex outerSize)
+{
+  if(!NumTraits<T>::RequireInitialization && (large_allocation_policy(sizeof(T)*innerSize*outerSize) & ParallelFirstTouch))
+    parallel_first_touch(data, sizeof(T), innerSize, outerSize);
+}
+
 /** \internal
   * Static array. If the MatrixOrArrayOptions require auto-alignment, the array will be automatically aligned:
   * to 16 bytes boundary if the total size is a multiple of 16 bytes.
@@ -207,7 +216,10 @@ template<typename T, int _Options> class DenseStorage<T, Dynamic, Dynamic, Dynam
        : m_data(0), m_rows(0), m_cols(0) {}
     inline DenseStorage(DenseIndex size, DenseIndex rows, DenseIndex cols)
       : m_data(internal::conditional_aligned_new_auto<T,(_Options&DontAlign)==0>(size)), m_rows(rows), m_cols(cols) 
-    { EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN }
+    {
+      internal::dense_storage_first_touch(m_data, (_Options&RowMajor) ? cols : rows, (_Options&RowMajor) ? rows : cols);
+      EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN
+    }
     inline ~DenseStorage() { internal::conditional_aligned_delete_auto<T,(_Options&DontAlign)==0>(m_data, m_rows*m_cols); }
     inline void swap(DenseStorage& other)
     { std::swap(m_data,other.m_data); std::swap(m_rows,other.m_rows); std::swap(m_cols,other.m_cols); }
@@ -225,7 +237,10 @@ template<typename T, int _Options> class DenseStorage<T, Dynamic, Dynamic, Dynam
       {
         internal::conditional_aligned_delete_auto<T,(_Options&DontAlign)==0>(m_data, m_rows*m_cols);
         if (size)
+        {
           m_data = internal::conditional_aligned_new_auto<T,(_Options&DontAlign)==0>(size);
+          internal::dense_storage_first_touch(m_data, (_Options&RowMajor) ? cols : rows, (_Options&RowMajor) ? rows : cols);
+        }
         else
           m_data = 0;
         EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN
@@ -246,7 +261,10 @@ template<typename T, int _Rows, int _Options> class DenseStorage<T, Dynamic, _Ro
     inline explicit DenseStorage() : m_data(0), m_cols(0) {}
     inline DenseStorage(internal::constructor_without_unaligned_array_assert) : m_data(0), m_cols(0) {}
     inline DenseStorage(DenseIndex size, DenseIndex, DenseIndex cols) : m_data(internal::conditional_aligned_new_auto<T,(_Options&DontAlign)==0>(size)), m_cols(cols)
-    { EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN }
+    {
+      internal::dense_storage_first_touch(m_data, (_Options&RowMajor) ? cols : _Rows, (_Options&RowMajor) ? _Rows : cols);
+      EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN
+    }
     inline ~DenseStorage() { internal::conditional_aligned_delete_auto<T,(_Options&DontAlign)==0>(m_data, _Rows*m_cols); }
     inline void swap(DenseStorage& other) { std::swap(m_data,other.m_data); std::swap(m_cols,other.m_cols); }
     static inline DenseIndex rows(void) {return _Rows;}
@@ -262,7 +280,10 @@ template<typename T, int _Rows, int _Options> class DenseStorage<T, Dynamic, _Ro
       {
         internal::conditional_aligned_delete_auto<T,(_Options&DontAlign)==0>(m_data, _Rows*m_cols);
         if (size)
+        {
           m_data = internal::conditional_aligned_new_auto<T,(_Options&DontAlign)==0>(size);
+          internal::dense_storage_first_touch(m_data, (_Options&RowMajor) ? cols : _Rows, (_Options&RowMajor) ? _Rows : cols);
+        }
         else
           m_data = 0;
         EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN
@@ -282,7 +303,10 @@ template<typename T, int _Cols, int _Options> class DenseStorage<T, Dynamic, Dyn
     inline explicit DenseStorage() : m_data(0), m_rows(0) {}
     inline DenseStorage(internal::constructor_without_unaligned_array_assert) : m_data(0), m_rows(0) {}
     inline DenseStorage(DenseIndex size, DenseIndex rows, DenseIndex) : m_data(internal::conditional_aligned_new_auto<T,(_Options&DontAlign)==0>(size)), m_rows(rows)
-    { EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN }
+    {
+      internal::dense_storage_first_touch(m_data, (_Options&RowMajor) ? _Cols : rows, (_Options&RowMajor) ? rows : _Cols);
+      EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN
+    }
     inline ~DenseStorage() { internal::conditional_aligned_delete_auto<T,(_Options&DontAlign)==0>(m_data, _Cols*m_rows); }
     inline void swap(DenseStorage& other) { std::swap(m_data,other.m_data); std::swap(m_rows,other.m_rows); }
     inline DenseIndex rows(void) const {return m_rows;}
@@ -298,7 +322,10 @@ template<typename T, int _Cols, int _Options> class DenseStorage<T, Dynamic, Dyn
       {
         internal::conditional_aligned_delete_auto<T,(_Options&DontAlign)==0>(m_data, _Cols*m_rows);
         if (size)
+        {
           m_data = internal::conditional_aligned_new_auto<T,(_Options&DontAlign)==0>(size);
+          internal::dense_storage_first_touch(m_data, (_Options&RowMajor) ? _Cols : rows, (_Options&RowMajor) ? rows : _Cols);
+        }
         else
           m_data = 0;
         EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN
@@ -309,6 +336,122 @@ template<typename T, int _Cols, int _Options> class DenseStorage<T, Dynamic, Dyn
     inline T *data() { return m_data; }
 };
 
+/** \internal
+  *
+  * \class PaddedDenseStorage
+  * \ingroup Core_Module
+  *
+  * \brief Stores the data of a fully dynamic matrix with a padded leading dimension
+  *
+  * This is the storage used by matrices having the PaddedOuterStride option. Each inner vector starts
+  * on a packet boundary, and outer strides whose size in bytes is a multiple of EIGEN_PADDED_OUTER_STRIDE_ALIASING
+  * are increased by EIGEN_PADDED_OUTER_STRIDE_EXTRA bytes to avoid cache set aliasing between consecutive
+  * inner vectors.
+  *
+  * \sa DenseStorage
+  */
+template<typename T, int _Options> class PaddedDenseStorage
+{
+    enum {
+      IsRowMajor = (_Options&RowMajor)==RowMajor,
+      Align = (_Options&DontAlign)==0,
+      PacketSize = Align ? internal::packet_traits<T>::size : 1
+    };
+    T *m_data;
+    DenseIndex m_rows;
+    DenseIndex m_cols;
+    DenseIndex m_outerStride;
+    inline DenseIndex allocatedSize() const { return m_outerStride * (IsRowMajor ? m_rows : m_cols); }
+  public:
+    /** \internal \returns the outer stride used for inner vectors of size \a innerSize */
+    static DenseIndex paddedOuterStride(DenseIndex innerSize)
+    {
+      if(innerSize<=1)
+        return innerSize;
+      DenseIndex stride = ((innerSize+PacketSize-1)/PacketSize)*PacketSize;
+      if(((stride*sizeof(T)) % EIGEN_PADDED_OUTER_STRIDE_ALIASING) == 0)
+        stride += (std::max)(DenseIndex(PacketSize), DenseIndex(EIGEN_PADDED_OUTER_STRIDE_EXTRA/sizeof(T)));
+      return stride;
+    }
+
+    inline explicit PaddedDenseStorage() : m_data(0), m_rows(0), m_cols(0), m_outerStride(0) {}
+    inline PaddedDenseStorage(internal::constructor_without_unaligned_array_assert)
+       : m_data(0), m_rows(0), m_cols(0), m_outerStride(0) {}
+    inline PaddedDenseStorage(DenseIndex, DenseIndex rows, DenseIndex cols)
+      : m_rows(rows), m_cols(cols), m_outerStride(paddedOuterStride(IsRowMajor ? cols : rows))
+    {
+      const DenseIndex size = allocatedSize();
+      m_data = internal::conditional_aligned_new_auto<T,Align>(size);
+      internal::dense_storage_first_touch(m_data, m_outerStride, IsRowMajor ? rows : cols);
+      EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN
+    }
+    inline ~PaddedDenseStorage() { internal::conditional_aligned_delete_auto<T,Align>(m_data, allocatedSize()); }
+    inline void swap(PaddedDenseStorage& other)
+    {
+      std::swap(m_data,other.m_data); std::swap(m_rows,other.m_rows);
+      std::swap(m_cols,other.m_cols); std::swap(m_outerStride,other.m_outerStride);
+    }
+    inline DenseIndex rows(void) const {return m_rows;}
+    inline DenseIndex cols(void) const {return m_cols;}
+    inline DenseIndex outerStride(void) const {return m_outerStride;}
+    void conservativeResize(DenseIndex, DenseIndex rows, DenseIndex cols)
+    {
+      DenseIndex outerStride = paddedOuterStride(IsRowMajor ? cols : rows);
+      DenseIndex outerSize = IsRowMajor ? rows : cols;
+      if(outerStride==m_outerStride)
+      {
+        m_data = internal::conditional_aligned_realloc_new_auto<T,Align>(m_data, outerStride*outerSize, allocatedSize());
+      }
+      else
+      {
+        T* data = internal::conditional_aligned_new_auto<T,Align>(outerStride*outerSize);
+        DenseIndex innerCopy = (std::min)(IsRowMajor ? cols : rows, IsRowMajor ? m_cols : m_rows);
+        DenseIndex outerCopy = (std::min)(outerSize, IsRowMajor ? m_rows : m_cols);
+        for(DenseIndex j=0; j<outerCopy; ++j)
+          std::copy(m_data+j*m_outerStride, m_data+j*m_outerStride+innerCopy, data+j*outerStride);
+        internal::conditional_aligned_delete_auto<T,Align>(m_data, allocatedSize());
+        m_data = data;
+      }
+      m_rows = rows;
+      m_cols = cols;
+      m_outerStride = outerStride;
+    }
+    void resize(DenseIndex, DenseIndex rows, DenseIndex cols)
+    {
+      DenseIndex outerStride = paddedOuterStride(IsRowMajor ? cols : rows);
+      DenseIndex size = outerStride * (IsRowMajor ? rows : cols);
+      if(size != allocatedSize())
+      {
+        internal::conditional_aligned_delete_auto<T,Align>(m_data, allocatedSize());
+        if (size)
+        {
+          m_data = internal::conditional_aligned_new_auto<T,Align>(size);
+          internal::dense_storage_first_touch(m_data, outerStride, IsRowMajor ? rows : cols);
+        }
+        else
+          m_data = 0;
+        EIGEN_INTERNAL_DENSE_STORAGE_CTOR_PLUGIN
+      }
+      m_rows = rows;
+      m_cols = cols;
+      m_outerStride = outerStride;
+    }
+    inline const T *data() const { return m_data; }
+    inline T *data() { return m_data; }
+};
+
+namespace internal {
+
+/** \internal \returns the outer stride of the matrix stored in \a storage, \a innerSize unless its leading dimension is padded */
+template<typename Storage>
+inline DenseIndex dense_storage_outer_stride(const Storage&, DenseIndex innerSize) { return innerSize; }
+
+template<typename T, int _Options>
+inline DenseIndex dense_storage_outer_stride(const PaddedDenseStorage<T,_Options>& storage, DenseIndex)
+{ return storage.outerStride(); }
+
+} // end namespace internal
+
 } // end namespace Eigen
 
 #endif // EIGEN_MATRIX_H
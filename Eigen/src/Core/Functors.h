@@ -251,6 +251,66 @@ template<> struct functor_traits<scalar_boolean_or_op> {
   };
 };
 
+/** \internal
+  * \brief Template functor to compute the bitwise and of two integers
+  *
+  * \sa class CwiseBinaryOp, ArrayBase::operator&
+  */
+template<typename Scalar> struct scalar_bitwise_and_op {
+  EIGEN_EMPTY_STRUCT_CTOR(scalar_bitwise_and_op)
+  EIGEN_STRONG_INLINE const Scalar operator() (const Scalar& a, const Scalar& b) const { return a & b; }
+  template<typename Packet>
+  EIGEN_STRONG_INLINE const Packet packetOp(const Packet& a, const Packet& b) const
+  { return internal::pand(a,b); }
+};
+template<typename Scalar>
+struct functor_traits<scalar_bitwise_and_op<Scalar> > {
+  enum {
+    Cost = NumTraits<Scalar>::AddCost,
+    PacketAccess = packet_traits<Scalar>::HasBitwise
+  };
+};
+
+/** \internal
+  * \brief Template functor to compute the bitwise or of two integers
+  *
+  * \sa class CwiseBinaryOp, ArrayBase::operator|
+  */
+template<typename Scalar> struct scalar_bitwise_or_op {
+  EIGEN_EMPTY_STRUCT_CTOR(scalar_bitwise_or_op)
+  EIGEN_STRONG_INLINE const Scalar operator() (const Scalar& a, const Scalar& b) const { return a | b; }
+  template<typename Packet>
+  EIGEN_STRONG_INLINE const Packet packetOp(const Packet& a, const Packet& b) const
+  { return internal::por(a,b); }
+};
+template<typename Scalar>
+struct functor_traits<scalar_bitwise_or_op<Scalar> > {
+  enum {
+    Cost = NumTraits<Scalar>::AddCost,
+    PacketAccess = packet_traits<Scalar>::HasBitwise
+  };
+};
+
+/** \internal
+  * \brief Template functor to compute the bitwise xor of two integers
+  *
+  * \sa class CwiseBinaryOp, ArrayBase::operator^
+  */
+template<typename Scalar> struct scalar_bitwise_xor_op {
+  EIGEN_EMPTY_STRUCT_CTOR(scalar_bitwise_xor_op)
+  EIGEN_STRONG_INLINE const Scalar operator() (const Scalar& a, const Scalar& b) const { return a ^ b; }
+  template<typename Packet>
+  EIGEN_STRONG_INLINE const Packet packetOp(const Packet& a, const Packet& b) const
+  { return internal::pxor(a,b); }
+};
+template<typename Scalar>
+struct functor_traits<scalar_bitwise_xor_op<Scalar> > {
+  enum {
+    Cost = NumTraits<Scalar>::AddCost,
+    PacketAccess = packet_traits<Scalar>::HasBitwise
+  };
+};
+
 // unary functors:
 
 /** \internal
@@ -334,6 +394,9 @@ struct functor_traits<scalar_conjugate_op<Scalar> >
 /** \internal
   * \brief Template functor to cast a scalar to another type
   *
+  * The packet version may read several source packets, or only part of one, per packet of \a NewType,
+  * see type_casting_traits. It is therefore evaluated by CwiseUnaryOp through unary_op_packet.
+  *
   * \sa class CwiseUnaryOp, MatrixBase::cast()
   */
 template<typename Scalar, typename NewType>
@@ -344,7 +407,8 @@ struct scalar_cast_op {
 };
 template<typename Scalar, typename NewType>
 struct functor_traits<scalar_cast_op<Scalar,NewType> >
-{ enum { Cost = is_same<Scalar, NewType>::value ? 0 : NumTraits<NewType>::AddCost, PacketAccess = false }; };
+{ enum { Cost = is_same<Scalar, NewType>::value ? 0 : NumTraits<NewType>::AddCost,
+         PacketAccess = type_casting_traits<Scalar,NewType>::VectorizedCast }; };
 
 /** \internal
   * \brief Template functor to extract the real part of a complex
@@ -640,6 +704,13 @@ template <typename Scalar, bool RandomAccess> struct linspaced_op
 template<typename Functor> struct functor_has_linear_access { enum { ret = 1 }; };
 template<typename Scalar> struct functor_has_linear_access<scalar_identity_op<Scalar> > { enum { ret = 0 }; };
 
+// a functor is parallel safe if it computes each result from its arguments, or from its indices for a nullary
+// functor, without any mutable state, so that the coefficients of an expression nesting it may be computed in any
+// order by several threads. Functors are not parallel safe by default, so that a functor with a state, like the
+// sequential linspaced_op or a user functor, is always evaluated by a single thread. Eigen's own stateless functors
+// opt in at the end of this file.
+template<typename Functor> struct functor_is_parallel_safe { enum { ret = 0 }; };
+
 // in CwiseBinaryOp, we require the Lhs and Rhs to have the same scalar type, except for multiplication
 // where we only require them to have the same _real_ scalar type so one may multiply, say, float by complex<float>.
 // FIXME move this to functor_traits adding a functor_default
@@ -860,6 +931,38 @@ template<typename Scalar>
 struct functor_traits<scalar_cube_op<Scalar> >
 { enum { Cost = 2*NumTraits<Scalar>::MulCost, PacketAccess = packet_traits<Scalar>::HasMul }; };
 
+/** \internal
+  * \brief Template functor to shift an integer to the left by \a N bits
+  * \sa class CwiseUnaryOp, ArrayBase::shiftLeft()
+  */
+template<typename Scalar, int N>
+struct scalar_shift_left_op {
+  EIGEN_EMPTY_STRUCT_CTOR(scalar_shift_left_op)
+  inline Scalar operator() (const Scalar& a) const { return a << N; }
+  template<typename Packet>
+  inline const Packet packetOp(const Packet& a) const
+  { return internal::plogical_shift_left<N>(a); }
+};
+template<typename Scalar, int N>
+struct functor_traits<scalar_shift_left_op<Scalar,N> >
+{ enum { Cost = NumTraits<Scalar>::AddCost, PacketAccess = packet_traits<Scalar>::HasShift }; };
+
+/** \internal
+  * \brief Template functor to shift an integer to the right by \a N bits
+  * \sa class CwiseUnaryOp, ArrayBase::shiftRight()
+  */
+template<typename Scalar, int N>
+struct scalar_shift_right_op {
+  EIGEN_EMPTY_STRUCT_CTOR(scalar_shift_right_op)
+  inline Scalar operator() (const Scalar& a) const { return a >> N; }
+  template<typename Packet>
+  inline const Packet packetOp(const Packet& a) const
+  { return internal::parithmetic_shift_right<N>(a); }
+};
+template<typename Scalar, int N>
+struct functor_traits<scalar_shift_right_op<Scalar,N> >
+{ enum { Cost = NumTraits<Scalar>::AddCost, PacketAccess = packet_traits<Scalar>::HasShift }; };
+
 // default functor traits for STL functors:
 
 template<typename T>
@@ -918,6 +1021,63 @@ template<typename T>
 struct functor_traits<std::not_equal_to<T> >
 { enum { Cost = 1, PacketAccess = false }; };
 
+/** \internal
+  * \brief Computes the masks of a comparison functor on packets, with pcmp_lt(), pcmp_le() or pcmp_eq().
+  * PacketAccess is true if the functor is supported and the packet type of \c T provides these comparisons.
+  */
+template<typename Functor> struct functor_cmp_mask { enum { PacketAccess = false }; };
+
+template<typename T> struct functor_cmp_mask<std::less<T> >
+{
+  enum { PacketAccess = packet_traits<T>::HasCmp };
+  template<typename Packet> static EIGEN_STRONG_INLINE Packet run(const Packet& a, const Packet& b) { return pcmp_lt(a,b); }
+};
+
+template<typename T> struct functor_cmp_mask<std::less_equal<T> >
+{
+  enum { PacketAccess = packet_traits<T>::HasCmp };
+  template<typename Packet> static EIGEN_STRONG_INLINE Packet run(const Packet& a, const Packet& b) { return pcmp_le(a,b); }
+};
+
+template<typename T> struct functor_cmp_mask<std::greater<T> >
+{
+  enum { PacketAccess = packet_traits<T>::HasCmp };
+  template<typename Packet> static EIGEN_STRONG_INLINE Packet run(const Packet& a, const Packet& b) { return pcmp_lt(b,a); }
+};
+
+template<typename T> struct functor_cmp_mask<std::greater_equal<T> >
+{
+  enum { PacketAccess = packet_traits<T>::HasCmp };
+  template<typename Packet> static EIGEN_STRONG_INLINE Packet run(const Packet& a, const Packet& b) { return pcmp_le(b,a); }
+};
+
+template<typename T> struct functor_cmp_mask<std::equal_to<T> >
+{
+  enum { PacketAccess = packet_traits<T>::HasCmp };
+  template<typename Packet> static EIGEN_STRONG_INLINE Packet run(const Packet& a, const Packet& b) { return pcmp_eq(a,b); }
+};
+
+template<typename T> struct functor_cmp_mask<std::not_equal_to<T> >
+{
+  enum { PacketAccess = packet_traits<T>::HasCmp };
+  template<typename Packet> static EIGEN_STRONG_INLINE Packet run(const Packet& a, const Packet& b) { return pxor(pcmp_eq(a,b), ptrue(a)); }
+};
+
+/** \internal gives access to the value bound by std::bind1st() or std::bind2nd() */
+template<typename Binder> struct bound_value;
+
+template<typename Functor> struct bound_value<std::binder1st<Functor> > : std::binder1st<Functor>
+{
+  static const typename Functor::first_argument_type& get(const std::binder1st<Functor>& binder)
+  { return binder.*(&bound_value::value); }
+};
+
+template<typename Functor> struct bound_value<std::binder2nd<Functor> > : std::binder2nd<Functor>
+{
+  static const typename Functor::second_argument_type& get(const std::binder2nd<Functor>& binder)
+  { return binder.*(&bound_value::value); }
+};
+
 template<typename T>
 struct functor_traits<std::binder2nd<T> >
 { enum { Cost = functor_traits<T>::Cost, PacketAccess = false }; };
@@ -962,6 +1122,93 @@ struct functor_traits<std::binary_compose<T0,T1,T2> >
 
 #endif // EIGEN_STDEXT_SUPPORT
 
+// the stateless functors, see functor_is_parallel_safe
+#define EIGEN_PARALLEL_SAFE_FUNCTOR(FUNCTOR) \
+  template<typename T> struct functor_is_parallel_safe<FUNCTOR<T> > { enum { ret = 1 }; };
+#define EIGEN_PARALLEL_SAFE_FUNCTOR2(FUNCTOR) \
+  template<typename T0, typename T1> struct functor_is_parallel_safe<FUNCTOR<T0,T1> > { enum { ret = 1 }; };
+
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_sum_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR2(scalar_product_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR2(scalar_conj_product_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_min_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_max_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_hypot_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR2(scalar_binary_pow_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_difference_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_quotient_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_bitwise_and_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_bitwise_or_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_bitwise_xor_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_opposite_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_abs_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_abs2_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_conjugate_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR2(scalar_cast_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_real_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_imag_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_real_ref_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_imag_ref_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_exp_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_log_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_multiple_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR2(scalar_multiple2_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_quotient1_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_constant_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_identity_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_add_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_sqrt_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_cos_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_sin_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_tan_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_acos_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_asin_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_pow_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_inverse_mult_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_inverse_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_square_op)
+EIGEN_PARALLEL_SAFE_FUNCTOR(scalar_cube_op)
+template<> struct functor_is_parallel_safe<scalar_boolean_and_op> { enum { ret = 1 }; };
+template<> struct functor_is_parallel_safe<scalar_boolean_or_op> { enum { ret = 1 }; };
+template<typename Scalar, int N> struct functor_is_parallel_safe<scalar_shift_left_op<Scalar,N> > { enum { ret = 1 }; };
+template<typename Scalar, int N> struct functor_is_parallel_safe<scalar_shift_right_op<Scalar,N> > { enum { ret = 1 }; };
+// unlike the sequential one, the random access linspaced_op computes each coefficient from its index
+template<typename Scalar> struct functor_is_parallel_safe<linspaced_op<Scalar,true> > { enum { ret = 1 }; };
+
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::multiplies)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::divides)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::plus)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::minus)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::negate)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::logical_or)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::logical_and)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::logical_not)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::greater)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::less)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::greater_equal)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::less_equal)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::equal_to)
+EIGEN_PARALLEL_SAFE_FUNCTOR(std::not_equal_to)
+// the adaptors are parallel safe if the functors they wrap are
+template<typename T> struct functor_is_parallel_safe<std::binder2nd<T> > : functor_is_parallel_safe<T> {};
+template<typename T> struct functor_is_parallel_safe<std::binder1st<T> > : functor_is_parallel_safe<T> {};
+template<typename T> struct functor_is_parallel_safe<std::unary_negate<T> > : functor_is_parallel_safe<T> {};
+template<typename T> struct functor_is_parallel_safe<std::binary_negate<T> > : functor_is_parallel_safe<T> {};
+
+#ifdef EIGEN_STDEXT_SUPPORT
+EIGEN_PARALLEL_SAFE_FUNCTOR2(std::project1st)
+EIGEN_PARALLEL_SAFE_FUNCTOR2(std::project2nd)
+template<typename T0,typename T1> struct functor_is_parallel_safe<std::select2nd<std::pair<T0,T1> > > { enum { ret = 1 }; };
+template<typename T0,typename T1> struct functor_is_parallel_safe<std::select1st<std::pair<T0,T1> > > { enum { ret = 1 }; };
+template<typename T0,typename T1> struct functor_is_parallel_safe<std::unary_compose<T0,T1> >
+{ enum { ret = functor_is_parallel_safe<T0>::ret && functor_is_parallel_safe<T1>::ret }; };
+template<typename T0,typename T1,typename T2> struct functor_is_parallel_safe<std::binary_compose<T0,T1,T2> >
+{ enum { ret = functor_is_parallel_safe<T0>::ret && functor_is_parallel_safe<T1>::ret && functor_is_parallel_safe<T2>::ret }; };
+#endif // EIGEN_STDEXT_SUPPORT
+
+#undef EIGEN_PARALLEL_SAFE_FUNCTOR
+#undef EIGEN_PARALLEL_SAFE_FUNCTOR2
+
 // allow to add new functors and specializations of functor_traits from outside Eigen.
 // this macro is really needed because functor_traits must be specialized after it is declared but before it is used...
 #ifdef EIGEN_FUNCTORS_PLUGIN
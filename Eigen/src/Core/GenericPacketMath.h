@@ -58,6 +58,10 @@ struct default_packet_traits
     HasExp    = 0,
     HasLog    = 0,
     HasPow    = 0,
+    HasCmp    = 0,
+    HasBlend  = 0,
+    HasBitwise = 0,
+    HasShift  = 0,
 
     HasSin    = 0,
     HasCos    = 0,
@@ -90,6 +94,19 @@ template<typename T> struct packet_traits : default_packet_traits
   };
 };
 
+/** \internal Tells whether packets of \a SrcScalar can be converted to packets of \a TgtScalar with pcast().
+  * SrcCoeffRatio is the number of source packets converted into one target packet, and TgtCoeffRatio
+  * the number of target packets the coefficients of one source packet would fill.
+  */
+template<typename SrcScalar, typename TgtScalar> struct type_casting_traits
+{
+  enum {
+    VectorizedCast = 0,
+    SrcCoeffRatio = 1,
+    TgtCoeffRatio = 1
+  };
+};
+
 /** \internal \returns a + b (coeff-wise) */
 template<typename Packet> inline Packet
 padd(const Packet& a,
@@ -148,6 +165,60 @@ pxor(const Packet& a, const Packet& b) { return a ^ b; }
 template<typename Packet> inline Packet
 pandnot(const Packet& a, const Packet& b) { return a & (!b); }
 
+/** \internal \returns \a a shifted left by \a N bits */
+template<int N, typename Packet> inline Packet
+plogical_shift_left(const Packet& a) { return a << N; }
+
+/** \internal \returns \a a shifted right by \a N bits, propagating the sign bit */
+template<int N, typename Packet> inline Packet
+parithmetic_shift_right(const Packet& a) { return a >> N; }
+
+/** \internal \returns \a a shifted right by \a N bits, shifting in zeros.
+  * The scalar fallback is only a logical shift for unsigned or non-negative coefficients. */
+template<int N, typename Packet> inline Packet
+plogical_shift_right(const Packet& a) { return a >> N; }
+
+/** \internal \returns a packet with all bits set */
+template<typename Packet> inline Packet
+ptrue(const Packet& /*a*/) { Packet b; memset(static_cast<void*>(&b), 0xff, sizeof(Packet)); return b; }
+
+/** \internal \returns a mask whose coefficients have all their bits set where a < b, and are zero elsewhere */
+template<typename Packet> inline Packet
+pcmp_lt(const Packet& a, const Packet& b) { return a < b ? ptrue(a) : Packet(0); }
+
+/** \internal \returns a mask whose coefficients have all their bits set where a <= b, and are zero elsewhere */
+template<typename Packet> inline Packet
+pcmp_le(const Packet& a, const Packet& b) { return a <= b ? ptrue(a) : Packet(0); }
+
+/** \internal \returns a mask whose coefficients have all their bits set where a == b, and are zero elsewhere */
+template<typename Packet> inline Packet
+pcmp_eq(const Packet& a, const Packet& b) { return a == b ? ptrue(a) : Packet(0); }
+
+/** \internal \returns the coefficients of \a a where \a mask is set, and those of \a b elsewhere.
+  * The coefficients of \a mask must have either all or none of their bits set, as returned by pcmp_lt() */
+template<typename Packet> inline Packet
+pblend(const Packet& mask, const Packet& a, const Packet& b) { return mask != Packet(0) ? a : b; }
+
+/** \internal \returns the first coefficients of \a a converted to the scalar type of \a TgtPacket */
+template<typename SrcPacket, typename TgtPacket> inline TgtPacket
+pcast(const SrcPacket& a) { return static_cast<TgtPacket>(a); }
+
+/** \internal \returns the coefficients of \a a followed by those of \a b converted to the scalar type of \a TgtPacket */
+template<typename SrcPacket, typename TgtPacket> inline TgtPacket
+pcast(const SrcPacket& a, const SrcPacket& /*b*/) { return static_cast<TgtPacket>(a); }
+
+/** \internal \returns true if any coefficient of the mask \a a, as returned by pcmp_lt(), is set */
+template<typename Packet> inline bool
+predux_any(const Packet& a) { return a != Packet(0); }
+
+/** \internal \returns true if all the coefficients of the mask \a a, as returned by pcmp_lt(), are set */
+template<typename Packet> inline bool
+predux_all(const Packet& a) { return a != Packet(0); }
+
+/** \internal \returns the number of set coefficients of the mask \a a, as returned by pcmp_lt() */
+template<typename Packet> inline int
+predux_count(const Packet& a) { return a != Packet(0) ? 1 : 0; }
+
 /** \internal \returns a packet version of \a *from, from must be 16 bytes aligned */
 template<typename Packet> inline Packet
 pload(const typename unpacket_traits<Packet>::type* from) { return *from; }
@@ -176,6 +247,14 @@ template<typename Scalar, typename Packet> inline void pstore(Scalar* to, const
 template<typename Scalar, typename Packet> inline void pstoreu(Scalar* to, const Packet& from)
 { (*to) = from; }
 
+/** \internal copy the packet \a from to \a *to with a non-temporal store bypassing the caches, \a to must be 16 bytes aligned */
+template<typename Scalar, typename Packet> inline void pstream(Scalar* to, const Packet& from)
+{ pstore(to, from); }
+
+/** \internal makes the previous non-temporal stores of packets of type \a Packet globally visible */
+template<typename Packet> inline void pstreamfence()
+{}
+
 /** \internal tries to do cache prefetching of \a addr */
 template<typename Scalar> inline void prefetch(const Scalar* addr)
 {
@@ -273,22 +352,24 @@ pmadd(const Packet&  a,
 { return padd(pmul(a, b),c); }
 
 /** \internal \returns a packet version of \a *from.
-  * If LoadMode equals #Aligned, \a from must be 16 bytes aligned */
+  * If LoadMode equals #Aligned or #AlignedStreaming, \a from must be 16 bytes aligned */
 template<typename Packet, int LoadMode>
 inline Packet ploadt(const typename unpacket_traits<Packet>::type* from)
 {
-  if(LoadMode == Aligned)
+  if(LoadMode == Aligned || LoadMode == AlignedStreaming)
     return pload<Packet>(from);
   else
     return ploadu<Packet>(from);
 }
 
 /** \internal copy the packet \a from to \a *to.
-  * If StoreMode equals #Aligned, \a to must be 16 bytes aligned */
+  * If StoreMode equals #Aligned or #AlignedStreaming, \a to must be 16 bytes aligned */
 template<typename Scalar, typename Packet, int LoadMode>
 inline void pstoret(Scalar* to, const Packet& from)
 {
-  if(LoadMode == Aligned)
+  if(LoadMode == AlignedStreaming)
+    pstream(to, from);
+  else if(LoadMode == Aligned)
     pstore(to, from);
   else
     pstoreu(to, from);
@@ -34,6 +34,8 @@ namespace Eigen {
   *                 \b #AutoAlign or \b #DontAlign.
   *                 The former controls \ref TopicStorageOrders "storage order", and defaults to column-major. The latter controls alignment, which is required
   *                 for vectorization. It defaults to aligning matrices except for fixed sizes that aren't a multiple of the packet size.
+  *                 Fully dynamic matrices may additionally specify \b #PaddedOuterStride to pad their leading dimension, which
+  *                 avoids cache set conflicts for power-of-two sizes at the price of non contiguous coefficients.
   * \tparam _MaxRows Maximum number of rows. Defaults to \a _Rows (\ref maxrows "note").
   * \tparam _MaxCols Maximum number of columns. Defaults to \a _Cols (\ref maxrows "note").
   *
@@ -318,9 +320,6 @@ class Matrix
     void swap(MatrixBase<OtherDerived> const & other)
     { this->_swap(other.derived()); }
 
-    inline Index innerStride() const { return 1; }
-    inline Index outerStride() const { return this->innerSize(); }
-
     /////////// Geometry module ///////////
 
     template<typename OtherDerived>
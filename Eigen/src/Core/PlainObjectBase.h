@@ -107,7 +107,12 @@ class PlainObjectBase : public internal::dense_xpr_base<Derived>::type
     template<typename StrideType> struct StridedConstAlignedMapType { typedef Eigen::Map<const Derived, Aligned, StrideType> type; };
 
   protected:
-    DenseStorage<Scalar, Base::MaxSizeAtCompileTime, Base::RowsAtCompileTime, Base::ColsAtCompileTime, Options> m_storage;
+    enum { HasPaddedOuterStride = (Options&PaddedOuterStride)==PaddedOuterStride };
+    typedef typename internal::conditional<HasPaddedOuterStride,
+              PaddedDenseStorage<Scalar, Options>,
+              DenseStorage<Scalar, Base::MaxSizeAtCompileTime, Base::RowsAtCompileTime, Base::ColsAtCompileTime, Options>
+            >::type StorageType;
+    StorageType m_storage;
 
   public:
     enum { NeedsToAlign = SizeAtCompileTime != Dynamic && (internal::traits<Derived>::Flags & AlignedBit) != 0 };
@@ -119,77 +124,68 @@ class PlainObjectBase : public internal::dense_xpr_base<Derived>::type
     EIGEN_STRONG_INLINE Index rows() const { return m_storage.rows(); }
     EIGEN_STRONG_INLINE Index cols() const { return m_storage.cols(); }
 
+    inline Index innerStride() const { return 1; }
+    /** \returns the distance between two consecutive inner vectors, which is innerSize() unless
+      * the PaddedOuterStride option is set */
+    inline Index outerStride() const
+    { return internal::dense_storage_outer_stride(m_storage, (Flags & RowMajorBit) ? m_storage.cols() : m_storage.rows()); }
+
     EIGEN_STRONG_INLINE const Scalar& coeff(Index row, Index col) const
     {
-      if(Flags & RowMajorBit)
-        return m_storage.data()[col + row * m_storage.cols()];
-      else // column-major
-        return m_storage.data()[row + col * m_storage.rows()];
+      return m_storage.data()[storageIndex(row, col)];
     }
 
     EIGEN_STRONG_INLINE const Scalar& coeff(Index index) const
     {
-      return m_storage.data()[index];
+      return m_storage.data()[storageIndex(index)];
     }
 
     EIGEN_STRONG_INLINE Scalar& coeffRef(Index row, Index col)
     {
-      if(Flags & RowMajorBit)
-        return m_storage.data()[col + row * m_storage.cols()];
-      else // column-major
-        return m_storage.data()[row + col * m_storage.rows()];
+      return m_storage.data()[storageIndex(row, col)];
     }
 
     EIGEN_STRONG_INLINE Scalar& coeffRef(Index index)
     {
-      return m_storage.data()[index];
+      return m_storage.data()[storageIndex(index)];
     }
 
     EIGEN_STRONG_INLINE const Scalar& coeffRef(Index row, Index col) const
     {
-      if(Flags & RowMajorBit)
-        return m_storage.data()[col + row * m_storage.cols()];
-      else // column-major
-        return m_storage.data()[row + col * m_storage.rows()];
+      return m_storage.data()[storageIndex(row, col)];
     }
 
     EIGEN_STRONG_INLINE const Scalar& coeffRef(Index index) const
     {
-      return m_storage.data()[index];
+      return m_storage.data()[storageIndex(index)];
     }
 
     /** \internal */
     template<int LoadMode>
     EIGEN_STRONG_INLINE PacketScalar packet(Index row, Index col) const
     {
-      return internal::ploadt<PacketScalar, LoadMode>
-               (m_storage.data() + (Flags & RowMajorBit
-                                   ? col + row * m_storage.cols()
-                                   : row + col * m_storage.rows()));
+      return internal::ploadt<PacketScalar, LoadMode>(m_storage.data() + storageIndex(row, col));
     }
 
     /** \internal */
     template<int LoadMode>
     EIGEN_STRONG_INLINE PacketScalar packet(Index index) const
     {
-      return internal::ploadt<PacketScalar, LoadMode>(m_storage.data() + index);
+      return internal::ploadt<PacketScalar, LoadMode>(m_storage.data() + storageIndex(index));
     }
 
     /** \internal */
     template<int StoreMode>
     EIGEN_STRONG_INLINE void writePacket(Index row, Index col, const PacketScalar& x)
     {
-      internal::pstoret<Scalar, PacketScalar, StoreMode>
-              (m_storage.data() + (Flags & RowMajorBit
-                                   ? col + row * m_storage.cols()
-                                   : row + col * m_storage.rows()), x);
+      internal::pstoret<Scalar, PacketScalar, StoreMode>(m_storage.data() + storageIndex(row, col), x);
     }
 
     /** \internal */
     template<int StoreMode>
     EIGEN_STRONG_INLINE void writePacket(Index index, const PacketScalar& x)
     {
-      internal::pstoret<Scalar, PacketScalar, StoreMode>(m_storage.data() + index, x);
+      internal::pstoret<Scalar, PacketScalar, StoreMode>(m_storage.data() + storageIndex(index), x);
     }
 
     /** \returns a const pointer to the data array of this matrix */
@@ -635,6 +631,28 @@ class PlainObjectBase : public internal::dense_xpr_base<Derived>::type
 
   public:
 #ifndef EIGEN_PARSED_BY_DOXYGEN
+    /** \internal \returns the position of the coefficient (\a row, \a col) in the storage array */
+    EIGEN_STRONG_INLINE Index storageIndex(Index row, Index col) const
+    {
+      if(HasPaddedOuterStride)
+        return (Flags & RowMajorBit) ? col + row * outerStride() : row + col * outerStride();
+      else if(Flags & RowMajorBit)
+        return col + row * m_storage.cols();
+      else // column-major
+        return row + col * m_storage.rows();
+    }
+
+    /** \internal \returns the position of the coefficient of linear index \a index in the storage array */
+    EIGEN_STRONG_INLINE Index storageIndex(Index index) const
+    {
+      if(HasPaddedOuterStride)
+      {
+        const Index innerSize = this->innerSize();
+        return index % innerSize + (index / innerSize) * outerStride();
+      }
+      return index;
+    }
+
     static EIGEN_STRONG_INLINE void _check_template_params()
     {
       EIGEN_STATIC_ASSERT((EIGEN_IMPLIES(MaxRowsAtCompileTime==1 && MaxColsAtCompileTime!=1, (Options&RowMajor)==RowMajor)
@@ -645,7 +663,9 @@ class PlainObjectBase : public internal::dense_xpr_base<Derived>::type
                         && ((MaxColsAtCompileTime == Dynamic) || (MaxColsAtCompileTime >= 0))
                         && (MaxRowsAtCompileTime == RowsAtCompileTime || RowsAtCompileTime==Dynamic)
                         && (MaxColsAtCompileTime == ColsAtCompileTime || ColsAtCompileTime==Dynamic)
-                        && (Options & (DontAlign|RowMajor)) == Options),
+                        && EIGEN_IMPLIES((Options&PaddedOuterStride)==PaddedOuterStride,
+                                         MaxRowsAtCompileTime==Dynamic && MaxColsAtCompileTime==Dynamic)
+                        && (Options & (DontAlign|RowMajor|PaddedOuterStride)) == Options),
         INVALID_MATRIX_TEMPLATE_PARAMETERS)
     }
 #endif
@@ -672,7 +692,7 @@ struct internal::conservative_resize_like_impl
     else
     {
       // The storage order does not allow us to use reallocation.
-      typename Derived::PlainObject tmp(rows,cols);
+      Derived tmp(rows,cols);
       const Index common_rows = (std::min)(rows, _this.rows());
       const Index common_cols = (std::min)(cols, _this.cols());
       tmp.block(0,0,common_rows,common_cols) = _this.block(0,0,common_rows,common_cols);
@@ -706,7 +726,7 @@ struct internal::conservative_resize_like_impl
     else
     {
       // The storage order does not allow us to use reallocation.
-      typename Derived::PlainObject tmp(other);
+      Derived tmp(other);
       const Index common_rows = (std::min)(tmp.rows(), _this.rows());
       const Index common_cols = (std::min)(tmp.cols(), _this.cols());
       tmp.block(0,0,common_rows,common_cols) = _this.block(0,0,common_rows,common_cols);
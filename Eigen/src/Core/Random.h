@@ -14,18 +14,341 @@ namespace Eigen {
 
 namespace internal {
 
-template<typename Scalar> struct scalar_random_op {
-  EIGEN_EMPTY_STRUCT_CTOR(scalar_random_op)
+/** \internal \returns the murmur3 finalizer of \a x, a bijection of the 32 bits words whose
+  * output bits all depend on all input bits */
+inline unsigned int random_mix32(unsigned int x)
+{
+  x ^= x >> 16;
+  x *= 0x7feb352du;
+  x ^= x >> 15;
+  x *= 0x846ca68bu;
+  x ^= x >> 16;
+  return x;
+}
+
+template<typename Packet> EIGEN_STRONG_INLINE Packet prandom_mix32(const Packet& a)
+{
+  Packet x = pxor(a, plogical_shift_right<16>(a));
+  x = pmul(x, pset1<Packet>(static_cast<int>(0x7feb352du)));
+  x = pxor(x, plogical_shift_right<15>(x));
+  x = pmul(x, pset1<Packet>(static_cast<int>(0x846ca68bu)));
+  return pxor(x, plogical_shift_right<16>(x));
+}
+
+struct random_seed_state { unsigned int seed, count; bool seeded; };
+
+inline random_seed_state& random_seed()
+{
+  static random_seed_state state = { 0, 0, false };
+  return state;
+}
+
+/** \internal \class random_generator
+  * Counter-based generator of the random expressions: the words of the coefficient \c i are the hash of
+  * \c i and of a 64 bits key, which is drawn once per expression. The coefficients therefore do not depend
+  * on the traversal order, and packets and parallel assignments evaluate them independently.
+  * Each coefficient can draw from several streams, i.e., independent words.
+  */
+class random_generator
+{
+  public:
+    struct counter { unsigned int lo, hi; };
+
+    /** \a innerSize and \a rowMajor give the linear index of the coefficient (\c row, \c col). If \a innerSize
+      * is zero, the inner and outer indices are hashed as the low and high words of the counter. */
+    random_generator(DenseIndex innerSize = 0, bool rowMajor = false)
+      : m_innerSize(innerSize), m_rowMajor(rowMajor)
+    {
+      #ifdef EIGEN_HAS_OPENMP
+      #pragma omp critical(eigen_random_seed)
+      #endif
+      {
+        random_seed_state& state = random_seed();
+        if(state.seeded)
+        {
+          m_key0 = random_mix32(state.seed ^ random_mix32(state.count));
+          m_key1 = random_mix32(m_key0 + state.count + 0x9e3779b9u);
+          ++state.count;
+        }
+        else
+        {
+          // without an explicit seed, each key is drawn from std::rand() so that std::srand() controls the sequence
+          const unsigned int r0 = static_cast<unsigned int>(std::rand());
+          const unsigned int r1 = static_cast<unsigned int>(std::rand());
+          m_key0 = random_mix32(r0);
+          m_key1 = random_mix32(m_key0 + r1 + 0x9e3779b9u);
+        }
+      }
+    }
+
+    counter linear(DenseIndex index) const
+    {
+      counter c;
+      c.lo = static_cast<unsigned int>(index);
+      c.hi = static_cast<unsigned int>((index >> 16) >> 16);
+      return c;
+    }
+
+    counter linear(DenseIndex row, DenseIndex col) const
+    {
+      const DenseIndex inner = m_rowMajor ? col : row, outer = m_rowMajor ? row : col;
+      if(m_innerSize>0)
+        return linear(inner + outer*m_innerSize);
+      counter c;
+      c.lo = static_cast<unsigned int>(inner);
+      c.hi = static_cast<unsigned int>(outer);
+      return c;
+    }
+
+    /** \returns the word of the stream \a stream of the coefficient \a c */
+    unsigned int word(const counter& c, unsigned int stream) const
+    { return random_mix32(random_mix32(c.lo ^ (m_key0 + stream*0x9e3779b9u)) + (c.hi ^ m_key1)); }
+
+    /** \returns whether the coefficients \a c to \a c + \a size - 1 share the high word of their counters */
+    static bool fitsPacket(const counter& c, int size) { return c.lo <= ~0u - static_cast<unsigned int>(size-1); }
+
+    /** \returns the words of the stream \a stream of the coefficients \a c, \a c + 1, ..., as 32 bits integer packets */
+    template<typename Packet>
+    Packet packetWord(const counter& c, unsigned int stream) const
+    {
+      Packet x = pxor(plset<int>(static_cast<int>(c.lo)), pset1<Packet>(static_cast<int>(m_key0 + stream*0x9e3779b9u)));
+      x = padd(prandom_mix32(x), pset1<Packet>(static_cast<int>(c.hi ^ m_key1)));
+      return prandom_mix32(x);
+    }
+
+  protected:
+    DenseIndex m_innerSize;
+    bool m_rowMajor;
+    unsigned int m_key0, m_key1;
+};
+
+enum { RandomGeneric, RandomFloat, RandomDouble, RandomInteger, RandomComplex };
+
+template<typename Scalar> struct random_kind
+{
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  enum { value = is_same<Scalar,float>::value ? int(RandomFloat)
+               : is_same<Scalar,double>::value ? int(RandomDouble)
+               : (NumTraits<Scalar>::IsInteger && is_arithmetic<Scalar>::value && !is_same<Scalar,bool>::value) ? int(RandomInteger)
+               : (NumTraits<Scalar>::IsComplex && (is_same<RealScalar,float>::value || is_same<RealScalar,double>::value)) ? int(RandomComplex)
+               : int(RandomGeneric) };
+};
+
+/** \internal Converts the words of a random_generator to uniform and normal deviates of the type \a Scalar.
+  * \c uniform() follows the distribution of internal::random<Scalar>(), i.e., [-1,1) for the floating point types. */
+template<typename Scalar, int Kind = random_kind<Scalar>::value> struct random_deviates
+{
+  enum { Streams = 0, Vectorizable = 0, VectorizableNormal = 0 };
+  static Scalar uniform(const random_generator&, const random_generator::counter&, unsigned int = 0) { return random<Scalar>(); }
+  static Scalar normal(const random_generator&, const random_generator::counter&, unsigned int = 0)
+  {
+    // Box-Muller transform of two uniform deviates in (0,1] and [0,1)
+    using std::sqrt; using std::log; using std::cos;
+    const double u1 = (double(std::rand()) + 1.) / (double(RAND_MAX) + 1.), u2 = double(std::rand()) / (double(RAND_MAX) + 1.);
+    return Scalar(sqrt(-2. * log(u1)) * cos(2. * 3.14159265358979323846 * u2));
+  }
+};
+
+template<typename Scalar> struct random_deviates<Scalar, RandomFloat>
+{
+  typedef typename packet_traits<float>::type Packet;
+  typedef typename packet_traits<int>::type IntPacket;
+  enum {
+    Streams = 1,
+    Vectorizable = packet_traits<float>::Vectorizable && packet_traits<int>::Vectorizable
+                && packet_traits<int>::HasBitwise && packet_traits<int>::HasShift
+                && int(packet_traits<int>::size)==int(packet_traits<float>::size)
+                && type_casting_traits<int,float>::VectorizedCast,
+    VectorizableNormal = Vectorizable && packet_traits<float>::HasLog && packet_traits<float>::HasCos && packet_traits<float>::HasSqrt
+  };
+
+  // the 24 upper bits of the word, scaled to [0,1)
+  static float unit(unsigned int w) { return float(w >> 8) * (1.f/16777216.f); }
+  static float uniform(const random_generator& g, const random_generator::counter& c, unsigned int stream = 0)
+  { return unit(g.word(c, stream)) * 2.f - 1.f; }
+  static float normal(const random_generator& g, const random_generator::counter& c, unsigned int stream = 0)
+  {
+    using std::sqrt; using std::log; using std::cos;
+    const float u1 = 1.f - unit(g.word(c, stream)), u2 = unit(g.word(c, stream+1));
+    return sqrt(-2.f * log(u1)) * cos(6.28318530717958647692f * u2);
+  }
+
+  static Packet punit(const random_generator& g, const random_generator::counter& c, unsigned int stream)
+  { return pmul(pcast<IntPacket,Packet>(plogical_shift_right<8>(g.template packetWord<IntPacket>(c, stream))), pset1<Packet>(1.f/16777216.f)); }
+  static Packet puniform(const random_generator& g, const random_generator::counter& c)
+  { return pmadd(punit(g, c, 0), pset1<Packet>(2.f), pset1<Packet>(-1.f)); }
+  static Packet pnormal(const random_generator& g, const random_generator::counter& c)
+  {
+    const Packet u1 = psub(pset1<Packet>(1.f), punit(g, c, 0)), u2 = punit(g, c, 1);
+    return pmul(psqrt(pmul(pset1<Packet>(-2.f), plog(u1))), pcos(pmul(pset1<Packet>(6.28318530717958647692f), u2)));
+  }
+};
+
+template<typename Scalar> struct random_deviates<Scalar, RandomDouble>
+{
+  typedef typename packet_traits<double>::type Packet;
+  typedef typename packet_traits<int>::type IntPacket;
+  enum {
+    Streams = 2,
+    Vectorizable = packet_traits<double>::Vectorizable && packet_traits<int>::Vectorizable
+                && packet_traits<int>::HasBitwise && packet_traits<int>::HasShift
+                && int(packet_traits<int>::size)==2*int(packet_traits<double>::size)
+                && type_casting_traits<int,double>::VectorizedCast,
+    VectorizableNormal = Vectorizable && packet_traits<double>::HasLog && packet_traits<double>::HasCos && packet_traits<double>::HasSqrt
+  };
+
+  // 27 bits of the first word and 26 bits of the second one, scaled to [0,1)
+  static double unit(unsigned int w0, unsigned int w1) { return (double(w0 >> 5) * 67108864. + double(w1 >> 6)) * (1./9007199254740992.); }
+  static double uniform(const random_generator& g, const random_generator::counter& c, unsigned int stream = 0)
+  { return unit(g.word(c, stream), g.word(c, stream+1)) * 2. - 1.; }
+  static double normal(const random_generator& g, const random_generator::counter& c, unsigned int stream = 0)
+  {
+    using std::sqrt; using std::log; using std::cos;
+    const double u1 = 1. - unit(g.word(c, stream), g.word(c, stream+1)), u2 = unit(g.word(c, stream+2), g.word(c, stream+3));
+    return sqrt(-2. * log(u1)) * cos(6.28318530717958647692 * u2);
+  }
+
+  static Packet punit(const random_generator& g, const random_generator::counter& c, unsigned int stream)
+  {
+    // only the first half of the integer packets is converted
+    const Packet hi = pcast<IntPacket,Packet>(plogical_shift_right<5>(g.template packetWord<IntPacket>(c, stream)));
+    const Packet lo = pcast<IntPacket,Packet>(plogical_shift_right<6>(g.template packetWord<IntPacket>(c, stream+1)));
+    return pmul(pmadd(hi, pset1<Packet>(67108864.), lo), pset1<Packet>(1./9007199254740992.));
+  }
+  static Packet puniform(const random_generator& g, const random_generator::counter& c)
+  { return pmadd(punit(g, c, 0), pset1<Packet>(2.), pset1<Packet>(-1.)); }
+  static Packet pnormal(const random_generator& g, const random_generator::counter& c)
+  {
+    const Packet u1 = psub(pset1<Packet>(1.), punit(g, c, 0)), u2 = punit(g, c, 2);
+    return pmul(psqrt(pmul(pset1<Packet>(-2.), plog(u1))), pcos(pmul(pset1<Packet>(6.28318530717958647692), u2)));
+  }
+};
+
+template<typename Scalar> struct random_deviates<Scalar, RandomInteger>
+{
+  enum { Streams = 1, Vectorizable = 0, VectorizableNormal = 0 };
+  static Scalar uniform(const random_generator& g, const random_generator::counter& c, unsigned int stream = 0)
+  {
+    // the same distribution as internal::random<Scalar>(), with the word in place of std::rand()
+    enum { rand_bits = floor_log2<(unsigned int)(RAND_MAX)+1>::value,
+           scalar_bits = sizeof(Scalar) * CHAR_BIT,
+           shift = EIGEN_PLAIN_ENUM_MAX(0, int(rand_bits) - int(scalar_bits))
+    };
+    const unsigned int r = g.word(c, stream) >> (32 - rand_bits);
+    Scalar x = Scalar(r >> shift);
+    Scalar offset = NumTraits<Scalar>::IsSigned ? Scalar(1 << (rand_bits-1)) : Scalar(0);
+    return x - offset;
+  }
+  static Scalar normal(const random_generator& g, const random_generator::counter& c, unsigned int stream = 0)
+  { return Scalar(random_deviates<double>::normal(g, c, stream)); }
+};
+
+template<typename Scalar> struct random_deviates<Scalar, RandomComplex>
+{
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef random_deviates<RealScalar> Real;
+  enum { Streams = 2*Real::Streams, Vectorizable = 0, VectorizableNormal = 0 };
+  static Scalar uniform(const random_generator& g, const random_generator::counter& c, unsigned int stream = 0)
+  { return Scalar(Real::uniform(g, c, stream), Real::uniform(g, c, stream + Real::Streams)); }
+  static Scalar normal(const random_generator& g, const random_generator::counter& c, unsigned int stream = 0)
+  { return Scalar(Real::normal(g, c, stream), Real::normal(g, c, stream + 2*Real::Streams)); }
+};
+
+/** \internal Base class of the random functors: \c Derived::run(generator,counter) computes a coefficient,
+  * and \c Derived::prun(generator,counter) a packet of consecutive coefficients. */
+template<typename Scalar, typename Derived> struct random_op_base
+{
+  typedef typename packet_traits<Scalar>::type Packet;
+  random_op_base(DenseIndex innerSize, bool rowMajor) : m_generator(innerSize, rowMajor) {}
+
+  template<typename Index>
+  inline const Scalar operator() (Index row, Index col) const { return Derived::run(m_generator, m_generator.linear(row, col)); }
+  template<typename Index>
+  inline const Scalar operator() (Index index) const { return Derived::run(m_generator, m_generator.linear(index)); }
+
+  template<typename Index>
+  EIGEN_STRONG_INLINE const Packet packetOp(Index row, Index col) const { return packet(m_generator.linear(row, col)); }
   template<typename Index>
-  inline const Scalar operator() (Index, Index = 0) const { return random<Scalar>(); }
+  EIGEN_STRONG_INLINE const Packet packetOp(Index index) const { return packet(m_generator.linear(index)); }
+
+  protected:
+    EIGEN_STRONG_INLINE const Packet packet(const random_generator::counter& c) const
+    {
+      enum { PacketSize = packet_traits<Scalar>::size };
+      if(random_generator::fitsPacket(c, packet_traits<int>::size))
+        return Derived::prun(m_generator, c);
+      // the counters wrap around their low word within this packet
+      EIGEN_ALIGN16 Scalar values[PacketSize];
+      random_generator::counter ck = c;
+      for(int k=0; k<PacketSize; ++k)
+      {
+        values[k] = Derived::run(m_generator, ck);
+        if(++ck.lo == 0) ++ck.hi;
+      }
+      return pload<Packet>(values);
+    }
+
+    random_generator m_generator;
+};
+
+template<typename Scalar> struct scalar_random_op : random_op_base<Scalar, scalar_random_op<Scalar> >
+{
+  typedef random_op_base<Scalar, scalar_random_op<Scalar> > Base;
+  typedef typename Base::Packet Packet;
+  scalar_random_op(DenseIndex innerSize = 0, bool rowMajor = false) : Base(innerSize, rowMajor) {}
+  static Scalar run(const random_generator& g, const random_generator::counter& c) { return random_deviates<Scalar>::uniform(g, c); }
+  static Packet prun(const random_generator& g, const random_generator::counter& c) { return random_deviates<Scalar>::puniform(g, c); }
 };
 
 template<typename Scalar>
 struct functor_traits<scalar_random_op<Scalar> >
-{ enum { Cost = 5 * NumTraits<Scalar>::MulCost, PacketAccess = false, IsRepeatable = false }; };
+{ enum { Cost = 5 * NumTraits<Scalar>::MulCost, PacketAccess = random_deviates<Scalar>::Vectorizable, IsRepeatable = false }; };
+
+template<typename Scalar> struct scalar_normal_random_op : random_op_base<Scalar, scalar_normal_random_op<Scalar> >
+{
+  typedef random_op_base<Scalar, scalar_normal_random_op<Scalar> > Base;
+  typedef typename Base::Packet Packet;
+  scalar_normal_random_op(DenseIndex innerSize = 0, bool rowMajor = false) : Base(innerSize, rowMajor) {}
+  static Scalar run(const random_generator& g, const random_generator::counter& c) { return random_deviates<Scalar>::normal(g, c); }
+  static Packet prun(const random_generator& g, const random_generator::counter& c) { return random_deviates<Scalar>::pnormal(g, c); }
+};
+
+template<typename Scalar>
+struct functor_traits<scalar_normal_random_op<Scalar> >
+{ enum { Cost = 30 * NumTraits<Scalar>::MulCost, PacketAccess = random_deviates<Scalar>::VectorizableNormal, IsRepeatable = false }; };
+
+// the coefficients only depend on their indices and on the key drawn when the expression is created
+template<typename Scalar> struct functor_is_parallel_safe<scalar_random_op<Scalar> > { enum { ret = 1 }; };
+template<typename Scalar> struct functor_is_parallel_safe<scalar_normal_random_op<Scalar> > { enum { ret = 1 }; };
 
 } // end namespace internal
 
+/** Sets the seed of the random expressions, i.e., DenseBase::Random(), DenseBase::setRandom(), DenseBase::RandomNormal()
+  * and DenseBase::setRandomNormal().
+  *
+  * The coefficients of a random expression are a hash of their index and of a key which is drawn from this seed each time
+  * an expression is created. For a given seed, the same sequence of random expressions has thus the same coefficients,
+  * whatever the vectorization and the number of threads. Until this function is called, the key of each expression is
+  * drawn from std::rand() instead, so that std::srand() controls the random matrices as well.
+  *
+  * \note Unlike DenseBase::Random(), internal::random() always calls std::rand().
+  *
+  * \note Without OpenMP, this function and the creation of random expressions are not synchronized: like std::rand(),
+  * they must not be called concurrently from several threads.
+  */
+inline void setRandomSeed(unsigned int seed)
+{
+  #ifdef EIGEN_HAS_OPENMP
+  #pragma omp critical(eigen_random_seed)
+  #endif
+  {
+    internal::random_seed_state& state = internal::random_seed();
+    state.seed = seed;
+    state.count = 0;
+    state.seeded = true;
+  }
+}
+
 /** \returns a random matrix expression
   *
   * The parameters \a rows and \a cols are the number of rows and of columns of
@@ -48,7 +371,7 @@ template<typename Derived>
 inline const CwiseNullaryOp<internal::scalar_random_op<typename internal::traits<Derived>::Scalar>, Derived>
 DenseBase<Derived>::Random(Index rows, Index cols)
 {
-  return NullaryExpr(rows, cols, internal::scalar_random_op<Scalar>());
+  return NullaryExpr(rows, cols, internal::scalar_random_op<Scalar>(IsRowMajor ? cols : rows, IsRowMajor));
 }
 
 /** \returns a random vector expression
@@ -75,7 +398,7 @@ template<typename Derived>
 inline const CwiseNullaryOp<internal::scalar_random_op<typename internal::traits<Derived>::Scalar>, Derived>
 DenseBase<Derived>::Random(Index size)
 {
-  return NullaryExpr(size, internal::scalar_random_op<Scalar>());
+  return NullaryExpr(size, internal::scalar_random_op<Scalar>(size, IsRowMajor));
 }
 
 /** \returns a fixed-size random matrix or vector expression
@@ -96,7 +419,57 @@ template<typename Derived>
 inline const CwiseNullaryOp<internal::scalar_random_op<typename internal::traits<Derived>::Scalar>, Derived>
 DenseBase<Derived>::Random()
 {
-  return NullaryExpr(RowsAtCompileTime, ColsAtCompileTime, internal::scalar_random_op<Scalar>());
+  return NullaryExpr(RowsAtCompileTime, ColsAtCompileTime,
+                     internal::scalar_random_op<Scalar>(IsRowMajor ? ColsAtCompileTime : RowsAtCompileTime, IsRowMajor));
+}
+
+/** \returns a matrix expression whose coefficients follow the standard normal distribution
+  *
+  * The parameters \a rows and \a cols are the number of rows and of columns of
+  * the returned matrix. The coefficients have a zero mean and a unit variance; for complex
+  * scalar types, the real and imaginary parts are independent standard normal deviates.
+  * A normal distribution of mean \c mu and standard deviation \c sigma is obtained with
+  * \code mu + sigma * MatrixXd::RandomNormal(rows, cols).array() \endcode
+  *
+  * Like Random(), this expression has the "evaluate before nesting" flag, and its coefficients
+  * are reproducible with setRandomSeed().
+  *
+  * \sa setRandomNormal(), RandomNormal(Index), RandomNormal(), Random(Index,Index)
+  */
+template<typename Derived>
+inline const CwiseNullaryOp<internal::scalar_normal_random_op<typename internal::traits<Derived>::Scalar>, Derived>
+DenseBase<Derived>::RandomNormal(Index rows, Index cols)
+{
+  return NullaryExpr(rows, cols, internal::scalar_normal_random_op<Scalar>(IsRowMajor ? cols : rows, IsRowMajor));
+}
+
+/** \returns a vector expression whose coefficients follow the standard normal distribution
+  *
+  * The parameter \a size is the size of the returned vector.
+  *
+  * \only_for_vectors
+  *
+  * \sa setRandomNormal(), RandomNormal(Index,Index), RandomNormal()
+  */
+template<typename Derived>
+inline const CwiseNullaryOp<internal::scalar_normal_random_op<typename internal::traits<Derived>::Scalar>, Derived>
+DenseBase<Derived>::RandomNormal(Index size)
+{
+  return NullaryExpr(size, internal::scalar_normal_random_op<Scalar>(size, IsRowMajor));
+}
+
+/** \returns a fixed-size matrix or vector expression whose coefficients follow the standard normal distribution
+  *
+  * This variant is only for fixed-size MatrixBase types.
+  *
+  * \sa setRandomNormal(), RandomNormal(Index,Index), RandomNormal(Index)
+  */
+template<typename Derived>
+inline const CwiseNullaryOp<internal::scalar_normal_random_op<typename internal::traits<Derived>::Scalar>, Derived>
+DenseBase<Derived>::RandomNormal()
+{
+  return NullaryExpr(RowsAtCompileTime, ColsAtCompileTime,
+                     internal::scalar_normal_random_op<Scalar>(IsRowMajor ? ColsAtCompileTime : RowsAtCompileTime, IsRowMajor));
 }
 
 /** Sets all coefficients in this expression to random values.
@@ -112,6 +485,16 @@ inline Derived& DenseBase<Derived>::setRandom()
   return *this = Random(rows(), cols());
 }
 
+/** Sets all coefficients in this expression to standard normal deviates.
+  *
+  * \sa RandomNormal(), setRandom()
+  */
+template<typename Derived>
+inline Derived& DenseBase<Derived>::setRandomNormal()
+{
+  return *this = RandomNormal(rows(), cols());
+}
+
 /** Resizes to the given \a size, and sets all coefficients in this expression to random values.
   *
   * \only_for_vectors
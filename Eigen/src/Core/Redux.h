@@ -189,45 +189,105 @@ struct redux_impl<Func,Derived, DefaultTraversal, CompleteUnrolling>
   : public redux_novec_unroller<Func,Derived, 0, Derived::SizeAtCompileTime>
 {};
 
+/** \internal \returns the number of threads among which the \a chunks of a reduction of \a size coefficients
+  * should be distributed. This is more than one only if OpenMP is enabled, we are not already in a parallel region,
+  * each thread gets at least EIGEN_PARALLEL_REDUX_THRESHOLD of work, and neither the reduction functor nor the
+  * expression nest a functor which is not parallel safe, like the sequential LinSpaced or a user functor.
+  */
+template<typename Func, typename Derived>
+inline typename Derived::Index parallel_redux_threads(typename Derived::Index chunks, typename Derived::Index size)
+{
+#ifdef EIGEN_HAS_OPENMP
+  typedef typename Derived::Index Index;
+  if(chunks<2 || (int(Derived::Flags)&ParallelUnsafeBit) || !functor_is_parallel_safe<Func>::ret || omp_get_num_threads()>1)
+    return 1;
+  const Index cost = (int(Derived::CoeffReadCost)==Dynamic || int(functor_traits<Func>::Cost)==Dynamic)
+                   ? Index(EIGEN_PARALLEL_REDUX_THRESHOLD)
+                   : Index(Derived::CoeffReadCost) + Index(functor_traits<Func>::Cost);
+  int threads;
+  manage_multi_threading(GetAction, &threads);
+  return (std::max)(Index(1), (std::min)((std::min)(Index(threads), chunks), size*cost/Index(EIGEN_PARALLEL_REDUX_THRESHOLD)));
+#else
+  EIGEN_UNUSED_VARIABLE(chunks);
+  EIGEN_UNUSED_VARIABLE(size);
+  return 1;
+#endif
+}
+
 template<typename Func, typename Derived>
 struct redux_impl<Func, Derived, LinearVectorizedTraversal, NoUnrolling>
 {
   typedef typename Derived::Scalar Scalar;
   typedef typename packet_traits<Scalar>::type PacketScalar;
   typedef typename Derived::Index Index;
+  enum {
+    packetSize = packet_traits<Scalar>::size,
+    alignment = bool(Derived::Flags & DirectAccessBit) || bool(Derived::Flags & AlignedBit)
+              ? Aligned : Unaligned
+  };
+
+  /** \internal reduces the packets of [start,end), the size of which must be a non zero multiple of the packet size.
+    * Four independent accumulators are used to hide the latency of func.packetOp. */
+  static EIGEN_STRONG_INLINE PacketScalar packetRun(const Derived& mat, const Func& func, Index start, Index end)
+  {
+    const Index end4 = start + ((end-start)/(4*packetSize))*(4*packetSize);
+    PacketScalar packet_res0 = mat.template packet<alignment>(start);
+    Index index = start + packetSize;
+    if(end4>start) // we have at least four packets to partly unroll the loop
+    {
+      PacketScalar packet_res1 = mat.template packet<alignment>(start+packetSize);
+      PacketScalar packet_res2 = mat.template packet<alignment>(start+2*packetSize);
+      PacketScalar packet_res3 = mat.template packet<alignment>(start+3*packetSize);
+      for(index = start + 4*packetSize; index < end4; index += 4*packetSize)
+      {
+        packet_res0 = func.packetOp(packet_res0, mat.template packet<alignment>(index));
+        packet_res1 = func.packetOp(packet_res1, mat.template packet<alignment>(index+packetSize));
+        packet_res2 = func.packetOp(packet_res2, mat.template packet<alignment>(index+2*packetSize));
+        packet_res3 = func.packetOp(packet_res3, mat.template packet<alignment>(index+3*packetSize));
+      }
+      packet_res0 = func.packetOp(func.packetOp(packet_res0,packet_res1),func.packetOp(packet_res2,packet_res3));
+    }
+    for(; index < end; index += packetSize)
+      packet_res0 = func.packetOp(packet_res0, mat.template packet<alignment>(index));
+    return packet_res0;
+  }
 
   static Scalar run(const Derived& mat, const Func& func)
   {
     const Index size = mat.size();
     eigen_assert(size && "you are using an empty matrix");
-    const Index packetSize = packet_traits<Scalar>::size;
     const Index alignedStart = internal::first_aligned(mat);
-    enum {
-      alignment = bool(Derived::Flags & DirectAccessBit) || bool(Derived::Flags & AlignedBit)
-                ? Aligned : Unaligned
-    };
-    const Index alignedSize2 = ((size-alignedStart)/(2*packetSize))*(2*packetSize);
     const Index alignedSize = ((size-alignedStart)/(packetSize))*(packetSize);
-    const Index alignedEnd2 = alignedStart + alignedSize2;
     const Index alignedEnd  = alignedStart + alignedSize;
     Scalar res;
     if(alignedSize)
     {
-      PacketScalar packet_res0 = mat.template packet<alignment>(alignedStart);
-      if(alignedSize>packetSize) // we have at least two packets to partly unroll the loop
+      PacketScalar packet_res;
+      // Large reductions are split into chunks whose boundaries only depend on the size, such that the result
+      // does not depend on the number of threads. The partial results are then combined pairwise.
+      const Index chunks = (std::min)(Index(EIGEN_REDUX_MAX_CHUNKS), alignedSize/Index(EIGEN_REDUX_CHUNK_SIZE));
+      if(chunks<2)
       {
-        PacketScalar packet_res1 = mat.template packet<alignment>(alignedStart+packetSize);
-        for(Index index = alignedStart + 2*packetSize; index < alignedEnd2; index += 2*packetSize)
-        {
-          packet_res0 = func.packetOp(packet_res0, mat.template packet<alignment>(index));
-          packet_res1 = func.packetOp(packet_res1, mat.template packet<alignment>(index+packetSize));
-        }
-
-        packet_res0 = func.packetOp(packet_res0,packet_res1);
-        if(alignedEnd>alignedEnd2)
-          packet_res0 = func.packetOp(packet_res0, mat.template packet<alignment>(alignedEnd2));
+        packet_res = packetRun(mat, func, alignedStart, alignedEnd);
       }
-      res = func.predux(packet_res0);
+      else
+      {
+        PacketScalar partials[EIGEN_REDUX_MAX_CHUNKS];
+        const Index chunkSize = ((alignedSize/packetSize)/chunks)*packetSize;
+        const Index threads = parallel_redux_threads<Func,Derived>(chunks, size);
+        EIGEN_UNUSED_VARIABLE(threads);
+        #ifdef EIGEN_HAS_OPENMP
+        #pragma omp parallel for schedule(static) num_threads(threads) if(threads>1)
+        #endif
+        for(Index c = 0; c < chunks; ++c)
+          partials[c] = packetRun(mat, func, alignedStart + c*chunkSize,
+                                  c+1==chunks ? alignedEnd : alignedStart + (c+1)*chunkSize);
+        for(Index step = 1; step < chunks; step *= 2)
+          for(Index c = 0; c+step < chunks; c += 2*step)
+            partials[c] = func.packetOp(partials[c], partials[c+step]);
+        packet_res = partials[0];
+      }
+      res = func.predux(packet_res);
 
       for(Index index = 0; index < alignedStart; ++index)
         res = func(res,mat.coeff(index));
@@ -24,6 +24,11 @@ namespace Eigen {
   * This class represents an expression of a coefficient wise version of the C++ ternary operator ?:.
   * It is the return type of DenseBase::select() and most of the time this is the only way it is used.
   *
+  * When the condition is a coefficient wise comparison (<, <=, >, >=, ==, !=), or a logical and/or of
+  * comparisons, of expressions of the same
+  * scalar type as the \em then and \em else expressions, and all of them are vectorizable, the selection
+  * is vectorized without branches.
+  *
   * \sa DenseBase::select(const DenseBase<ThenDerived>&, const DenseBase<ElseDerived>&) const
   */
 
@@ -43,7 +48,17 @@ struct traits<Select<ConditionMatrixType, ThenMatrixType, ElseMatrixType> >
     ColsAtCompileTime = ConditionMatrixType::ColsAtCompileTime,
     MaxRowsAtCompileTime = ConditionMatrixType::MaxRowsAtCompileTime,
     MaxColsAtCompileTime = ConditionMatrixType::MaxColsAtCompileTime,
-    Flags = (unsigned int)ThenMatrixType::Flags & ElseMatrixType::Flags & HereditaryBits,
+    ConditionFlags = traits<typename remove_all<ConditionMatrixNested>::type>::Flags,
+    ThenFlags = traits<typename remove_all<ThenMatrixNested>::type>::Flags,
+    ElseFlags = traits<typename remove_all<ElseMatrixNested>::type>::Flags,
+    StorageOrdersAgree = (int(ConditionFlags)&RowMajorBit)==(int(ThenFlags)&RowMajorBit)
+                      && (int(ThenFlags)&RowMajorBit)==(int(ElseFlags)&RowMajorBit),
+    Vectorizable = cwise_mask<typename remove_all<ConditionMatrixNested>::type, Scalar>::PacketAccess
+                && packet_traits<Scalar>::HasBlend,
+    Flags = ((unsigned int)ThenMatrixType::Flags & ElseMatrixType::Flags & HereditaryBits)
+          | ((int(ConditionFlags) | int(ThenFlags) | int(ElseFlags)) & ParallelUnsafeBit)
+          | (StorageOrdersAgree ? (int(ConditionFlags) & int(ThenFlags) & int(ElseFlags) & (LinearAccessBit | AlignedBit)) : 0)
+          | (StorageOrdersAgree && Vectorizable ? (int(ThenFlags) & int(ElseFlags) & PacketAccessBit) : 0),
     CoeffReadCost = traits<typename remove_all<ConditionMatrixNested>::type>::CoeffReadCost
                   + EIGEN_SIZE_MAX(traits<typename remove_all<ThenMatrixNested>::type>::CoeffReadCost,
                                    traits<typename remove_all<ElseMatrixNested>::type>::CoeffReadCost)
@@ -88,6 +103,22 @@ class Select : internal::no_assignment_operator,
         return m_else.coeff(i);
     }
 
+    template<int LoadMode>
+    inline PacketScalar packet(Index i, Index j) const
+    {
+      return internal::pblend(Mask::template packet<LoadMode>(m_condition, i, j),
+                              m_then.template packet<LoadMode>(i, j),
+                              m_else.template packet<LoadMode>(i, j));
+    }
+
+    template<int LoadMode>
+    inline PacketScalar packet(Index i) const
+    {
+      return internal::pblend(Mask::template packet<LoadMode>(m_condition, i),
+                              m_then.template packet<LoadMode>(i),
+                              m_else.template packet<LoadMode>(i));
+    }
+
     const ConditionMatrixType& conditionMatrix() const
     {
       return m_condition;
@@ -104,6 +135,8 @@ class Select : internal::no_assignment_operator,
     }
 
   protected:
+    typedef internal::cwise_mask<typename internal::remove_all<typename ConditionMatrixType::Nested>::type, Scalar> Mask;
+
     typename ConditionMatrixType::Nested m_condition;
     typename ThenMatrixType::Nested m_then;
     typename ElseMatrixType::Nested m_else;
@@ -28,7 +28,86 @@ inline void stable_norm_kernel(const ExpressionType& bl, Scalar& ssq, Scalar& sc
   // then we can neglect this sub vector
   ssq += (bl*invScale).squaredNorm();
 }
-}
+
+// Accumulates the squares of the small, medium and big coefficients of Blue's algorithm.
+template<typename Derived,
+         bool Vectorize = packet_traits<typename Derived::Scalar>::HasCmp
+                       && packet_traits<typename Derived::Scalar>::HasAbs
+                       && !NumTraits<typename Derived::Scalar>::IsComplex
+                       && bool(int(Derived::Flags) & PacketAccessBit)
+                       && bool(int(Derived::Flags) & LinearAccessBit)>
+struct blue_norm_sums
+{
+  typedef typename Derived::Index Index;
+  typedef typename NumTraits<typename Derived::Scalar>::Real RealScalar;
+
+  static EIGEN_STRONG_INLINE void accumulate(RealScalar ax, RealScalar ab2, RealScalar b1, RealScalar s1m, RealScalar s2m,
+                                             RealScalar& asml, RealScalar& amed, RealScalar& abig)
+  {
+    if(ax > ab2)     abig += internal::abs2(ax*s2m);
+    else if(ax < b1) asml += internal::abs2(ax*s1m);
+    else             amed += internal::abs2(ax);
+  }
+
+  static inline void run(const Derived& vec, RealScalar ab2, RealScalar b1, RealScalar s1m, RealScalar s2m,
+                         RealScalar& asml, RealScalar& amed, RealScalar& abig)
+  {
+    for(Index j=0; j<vec.size(); ++j)
+      accumulate(internal::abs(vec.coeff(j)), ab2, b1, s1m, s2m, asml, amed, abig);
+  }
+};
+
+// The packet version computes the three candidate squares of every coefficient and keeps
+// the right one with masks, so that the loop has no branch.
+template<typename Derived>
+struct blue_norm_sums<Derived, true>
+{
+  typedef typename Derived::Index Index;
+  typedef typename Derived::Scalar RealScalar;
+  typedef typename packet_traits<RealScalar>::type Packet;
+  typedef blue_norm_sums<Derived, false> ScalarSums;
+  enum {
+    PacketSize = packet_traits<RealScalar>::size,
+    Alignment = (int(Derived::Flags)&DirectAccessBit) || (int(Derived::Flags)&AlignedBit) ? Aligned : Unaligned
+  };
+
+  static inline void run(const Derived& vec, RealScalar ab2, RealScalar b1, RealScalar s1m, RealScalar s2m,
+                         RealScalar& asml, RealScalar& amed, RealScalar& abig)
+  {
+    const Index n = vec.size();
+    const Index alignedStart = first_aligned(vec);
+    const Index alignedEnd = alignedStart + ((n-alignedStart)/PacketSize)*PacketSize;
+
+    for(Index j=0; j<alignedStart; ++j)
+      ScalarSums::accumulate(internal::abs(vec.coeff(j)), ab2, b1, s1m, s2m, asml, amed, abig);
+
+    const Packet pab2 = pset1<Packet>(ab2), pb1 = pset1<Packet>(b1);
+    const Packet ps1m = pset1<Packet>(s1m), ps2m = pset1<Packet>(s2m);
+    const Packet pzero = pset1<Packet>(RealScalar(0));
+    const Packet pones = ptrue(pzero);
+    Packet pasml = pzero, pamed = pzero, pabig = pzero;
+    for(Index j=alignedStart; j<alignedEnd; j+=PacketSize)
+    {
+      Packet ax = pabs(vec.template packet<Alignment>(j));
+      Packet maskBig = pcmp_lt(pab2, ax);
+      Packet maskSml = pcmp_lt(ax, pb1);
+      Packet maskMed = pxor(por(maskBig, maskSml), pones);
+      Packet axBig = pmul(ax, ps2m);
+      Packet axSml = pmul(ax, ps1m);
+      pabig = padd(pabig, pand(maskBig, pmul(axBig, axBig)));
+      pasml = padd(pasml, pand(maskSml, pmul(axSml, axSml)));
+      pamed = padd(pamed, pand(maskMed, pmul(ax, ax)));
+    }
+    abig += predux(pabig);
+    asml += predux(pasml);
+    amed += predux(pamed);
+
+    for(Index j=alignedEnd; j<n; ++j)
+      ScalarSums::accumulate(internal::abs(vec.coeff(j)), ab2, b1, s1m, s2m, asml, amed, abig);
+  }
+};
+
+} // end namespace internal
 
 /** \returns the \em l2 norm of \c *this avoiding underflow and overflow.
   * This version use a blockwise two passes algorithm:
@@ -118,13 +197,7 @@ MatrixBase<Derived>::blueNorm() const
   RealScalar asml = RealScalar(0);
   RealScalar amed = RealScalar(0);
   RealScalar abig = RealScalar(0);
-  for(Index j=0; j<n; ++j)
-  {
-    RealScalar ax = internal::abs(coeff(j));
-    if(ax > ab2)     abig += internal::abs2(ax*s2m);
-    else if(ax < b1) asml += internal::abs2(ax*s1m);
-    else             amed += internal::abs2(ax);
-  }
+  internal::blue_norm_sums<Derived>::run(derived(), ab2, b1, s1m, s2m, asml, amed, abig);
   if(abig > RealScalar(0))
   {
     abig = internal::sqrt(abig);
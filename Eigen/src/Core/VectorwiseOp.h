@@ -33,6 +33,8 @@ template< typename MatrixType, typename MemberOp, int Direction>
 class PartialReduxExpr;
 
 namespace internal {
+template<typename MemberOp, typename Scalar> struct member_packet_redux;
+
 template<typename MatrixType, typename MemberOp, int Direction>
 struct traits<PartialReduxExpr<MatrixType, MemberOp, Direction> >
  : traits<MatrixType>
@@ -48,8 +50,18 @@ struct traits<PartialReduxExpr<MatrixType, MemberOp, Direction> >
     ColsAtCompileTime = Direction==Horizontal ? 1 : MatrixType::ColsAtCompileTime,
     MaxRowsAtCompileTime = Direction==Vertical   ? 1 : MatrixType::MaxRowsAtCompileTime,
     MaxColsAtCompileTime = Direction==Horizontal ? 1 : MatrixType::MaxColsAtCompileTime,
+    // when the subvectors are reduced across the storage order, a packet of results is obtained by
+    // reducing the packets of consecutive inner vectors
+    Vectorizable = member_packet_redux<MemberOp,InputScalar>::Vectorizable
+                && bool(_MatrixTypeNested::Flags & PacketAccessBit)
+                && (MaxRowsAtCompileTime==Dynamic || MaxColsAtCompileTime==Dynamic
+                    || (RowsAtCompileTime*ColsAtCompileTime) % packet_traits<Scalar>::size == 0)
+                && (Direction==Vertical) == bool(_MatrixTypeNested::Flags & RowMajorBit)
+                && is_same<Scalar,InputScalar>::value,
     Flags0 = (unsigned int)_MatrixTypeNested::Flags & HereditaryBits,
-    Flags = (Flags0 & ~RowMajorBit) | (RowsAtCompileTime == 1 ? RowMajorBit : 0),
+    Flags = (Flags0 & ~RowMajorBit) | (RowsAtCompileTime == 1 ? RowMajorBit : 0)
+          | (Vectorizable ? LinearAccessBit | PacketAccessBit : 0)
+          | (functor_is_parallel_safe<MemberOp>::ret ? 0 : ParallelUnsafeBit),
     TraversalSize = Direction==Vertical ? RowsAtCompileTime : ColsAtCompileTime
   };
   #if EIGEN_GNUC_AT_LEAST(3,4)
@@ -80,6 +92,8 @@ class PartialReduxExpr : internal::no_assignment_operator,
     Index rows() const { return (Direction==Vertical   ? 1 : m_matrix.rows()); }
     Index cols() const { return (Direction==Horizontal ? 1 : m_matrix.cols()); }
 
+    const _MatrixTypeNested& nestedExpression() const { return m_matrix; }
+
     EIGEN_STRONG_INLINE const Scalar coeff(Index i, Index j) const
     {
       if (Direction==Vertical)
@@ -96,11 +110,74 @@ class PartialReduxExpr : internal::no_assignment_operator,
         return m_functor(m_matrix.row(index));
     }
 
+    template<int LoadMode>
+    EIGEN_STRONG_INLINE const PacketScalar packet(Index i, Index j) const
+    {
+      return packet<LoadMode>(Direction==Vertical ? j : i);
+    }
+
+    /** \internal reduces the packets starting at \a index of all the inner vectors.
+      * Four independent accumulators are used to hide the latency of the reduction functor. */
+    template<int LoadMode>
+    const PacketScalar packet(Index index) const
+    {
+      typedef internal::member_packet_redux<MemberOp,typename MatrixType::Scalar> PacketRedux;
+      const typename PacketRedux::BinaryOp func = PacketRedux::op(m_functor);
+      const Index size = Direction==Vertical ? m_matrix.rows() : m_matrix.cols();
+      if(size==0) // all the subvectors are empty and reduce to the same value
+        return internal::pset1<PacketScalar>(coeff(index));
+      const Index size4 = (size/4)*4;
+      PacketScalar res0 = PacketRedux::map(subPacket(0, index));
+      Index k = 1;
+      if(size4>0)
+      {
+        PacketScalar res1 = PacketRedux::map(subPacket(1, index));
+        PacketScalar res2 = PacketRedux::map(subPacket(2, index));
+        PacketScalar res3 = PacketRedux::map(subPacket(3, index));
+        for(k = 4; k < size4; k += 4)
+        {
+          res0 = func.packetOp(res0, PacketRedux::map(subPacket(k,   index)));
+          res1 = func.packetOp(res1, PacketRedux::map(subPacket(k+1, index)));
+          res2 = func.packetOp(res2, PacketRedux::map(subPacket(k+2, index)));
+          res3 = func.packetOp(res3, PacketRedux::map(subPacket(k+3, index)));
+        }
+        res0 = func.packetOp(func.packetOp(res0, res1), func.packetOp(res2, res3));
+      }
+      for(; k < size; ++k)
+        res0 = func.packetOp(res0, PacketRedux::map(subPacket(k, index)));
+      return PacketRedux::finalize(res0, size);
+    }
+
   protected:
+    /** \internal \returns the packet starting at \a index of the \a k-th subvector */
+    EIGEN_STRONG_INLINE const PacketScalar subPacket(Index k, Index index) const
+    {
+      return Direction==Vertical ? m_matrix.template packet<Unaligned>(k, index)
+                                 : m_matrix.template packet<Unaligned>(index, k);
+    }
+
+
     MatrixTypeNested m_matrix;
     const MemberOp m_functor;
 };
 
+namespace internal {
+// every coefficient of a partial redux reads a whole subvector
+template<typename MatrixType, typename MemberOp, int Direction>
+struct dynamic_coeff_read_cost<PartialReduxExpr<MatrixType, MemberOp, Direction> >
+{
+  typedef PartialReduxExpr<MatrixType, MemberOp, Direction> XprType;
+  typedef typename traits<XprType>::_MatrixTypeNested MatrixTypeNested;
+  static inline typename XprType::Index run(const XprType& xpr)
+  {
+    typedef typename XprType::Index Index;
+    const Index size = Direction==Vertical ? xpr.nestedExpression().rows() : xpr.nestedExpression().cols();
+    const Index cost = int(MatrixTypeNested::CoeffReadCost)==Dynamic ? Index(1) : Index(MatrixTypeNested::CoeffReadCost);
+    return size * (cost + NumTraits<typename MatrixType::Scalar>::AddCost);
+  }
+};
+}
+
 #define EIGEN_MEMBER_FUNCTOR(MEMBER,COST)                               \
   template <typename ResultType>                                        \
   struct member_##MEMBER {                                           \
@@ -111,7 +188,10 @@ class PartialReduxExpr : internal::no_assignment_operator,
     template<typename XprType>                                          \
     EIGEN_STRONG_INLINE ResultType operator()(const XprType& mat) const \
     { return mat.MEMBER(); } \
-  }
+  };                                                                    \
+  template <typename ResultType>                                        \
+  struct functor_is_parallel_safe<member_##MEMBER<ResultType> >         \
+  { enum { ret = 1 }; }
 
 namespace internal {
 
@@ -143,6 +223,63 @@ struct member_redux {
   { return mat.redux(m_functor); }
   const BinaryOp m_functor;
 };
+
+template <typename BinaryOp, typename Scalar>
+struct functor_is_parallel_safe<member_redux<BinaryOp,Scalar> > : functor_is_parallel_safe<BinaryOp> {};
+
+/** \internal Describes how the member functors which boil down to a redux with a single binary functor can
+  * reduce packets: map() is applied to the packets of the matrix, which are then reduced with op() and the
+  * result is passed to finalize() along with the number of reduced coefficients. */
+template<typename MemberOp, typename Scalar>
+struct member_packet_redux
+{
+  enum { Vectorizable = 0 };
+};
+
+template<typename _BinaryOp>
+struct member_packet_redux_base
+{
+  typedef _BinaryOp BinaryOp;
+  enum { Vectorizable = functor_traits<BinaryOp>::PacketAccess };
+  template<typename MemberOp>
+  static EIGEN_STRONG_INLINE BinaryOp op(const MemberOp&) { return BinaryOp(); }
+  template<typename Packet>
+  static EIGEN_STRONG_INLINE Packet map(const Packet& p) { return p; }
+  template<typename Packet, typename Index>
+  static EIGEN_STRONG_INLINE Packet finalize(const Packet& p, Index) { return p; }
+};
+
+template<typename ResultType, typename Scalar>
+struct member_packet_redux<member_sum<ResultType>, Scalar> : member_packet_redux_base<scalar_sum_op<Scalar> > {};
+template<typename ResultType, typename Scalar>
+struct member_packet_redux<member_prod<ResultType>, Scalar> : member_packet_redux_base<scalar_product_op<Scalar> > {};
+template<typename ResultType, typename Scalar>
+struct member_packet_redux<member_minCoeff<ResultType>, Scalar> : member_packet_redux_base<scalar_min_op<Scalar> > {};
+template<typename ResultType, typename Scalar>
+struct member_packet_redux<member_maxCoeff<ResultType>, Scalar> : member_packet_redux_base<scalar_max_op<Scalar> > {};
+
+template<typename ResultType, typename Scalar>
+struct member_packet_redux<member_mean<ResultType>, Scalar> : member_packet_redux_base<scalar_sum_op<Scalar> >
+{
+  enum { Vectorizable = functor_traits<scalar_sum_op<Scalar> >::PacketAccess && packet_traits<Scalar>::HasDiv };
+  template<typename Packet, typename Index>
+  static EIGEN_STRONG_INLINE Packet finalize(const Packet& p, Index size) { return pdiv(p, pset1<Packet>(Scalar(size))); }
+};
+
+template<typename ResultType, typename Scalar>
+struct member_packet_redux<member_squaredNorm<ResultType>, Scalar> : member_packet_redux_base<scalar_sum_op<Scalar> >
+{
+  enum { Vectorizable = functor_traits<scalar_sum_op<Scalar> >::PacketAccess && packet_traits<Scalar>::HasMul
+                     && !NumTraits<Scalar>::IsComplex };
+  template<typename Packet>
+  static EIGEN_STRONG_INLINE Packet map(const Packet& p) { return pmul(p, p); }
+};
+
+template<typename BinaryOp, typename Scalar>
+struct member_packet_redux<member_redux<BinaryOp,Scalar>, Scalar> : member_packet_redux_base<BinaryOp>
+{
+  static EIGEN_STRONG_INLINE BinaryOp op(const member_redux<BinaryOp,Scalar>& member) { return member.m_functor; }
+};
 }
 
 /** \class VectorwiseOp
@@ -53,6 +53,52 @@ struct visitor_impl<Visitor, Derived, Dynamic>
   }
 };
 
+template<typename Visitor, typename Derived, bool Vectorize>
+struct packet_visitor_impl
+{
+  static inline void run(const Derived& mat, Visitor& visitor)
+  {
+    visitor_impl<Visitor, Derived, Dynamic>::run(mat, visitor);
+  }
+};
+
+// Visits the coefficients in the same column-major order as above, handing runs of packets of consecutive
+// coefficients of a column (or of a row vector) to the visitor.
+template<typename Visitor, typename Derived>
+struct packet_visitor_impl<Visitor, Derived, true>
+{
+  typedef typename Derived::Index Index;
+  enum {
+    PacketSize = packet_traits<typename Derived::Scalar>::size,
+    IsRowVector = Derived::IsRowMajor,
+    // short enough for the offsets in a run to be represented exactly by the coefficients of a float packet
+    MaxRunPackets = 1<<20
+  };
+  static inline void run(const Derived& mat, Visitor& visitor)
+  {
+    const Index innerSize = IsRowVector ? mat.cols() : mat.rows();
+    const Index outerSize = IsRowVector ? 1 : mat.cols();
+    if(innerSize < 2*PacketSize)
+      return visitor_impl<Visitor, Derived, Dynamic>::run(mat, visitor);
+    visitor.init(mat.coeff(0,0), 0, 0);
+    for(Index j = 0; j < outerSize; ++j)
+    {
+      Index i = j==0 ? 1 : 0;
+      while(i + PacketSize <= innerSize)
+      {
+        const Index end = i + (std::min)(Index(MaxRunPackets), (innerSize-i)/PacketSize) * PacketSize;
+        visitor.beginPackets(IsRowVector ? 0 : i, IsRowVector ? i : j);
+        for(; i < end; i += PacketSize)
+          visitor.packet(mat.template packet<Unaligned>(IsRowVector ? 0 : i, IsRowVector ? i : j),
+                         IsRowVector ? 0 : i, IsRowVector ? i : j);
+        visitor.endPackets();
+      }
+      for(; i < innerSize; ++i)
+        visitor(mat.coeff(IsRowVector ? 0 : i, IsRowVector ? i : j), IsRowVector ? 0 : i, IsRowVector ? i : j);
+    }
+  }
+};
+
 } // end namespace internal
 
 /** Applies the visitor \a visitor to the whole coefficients of the matrix or vector.
@@ -67,6 +113,18 @@ struct visitor_impl<Visitor, Derived, Dynamic>
   * };
   * \endcode
   *
+  * If \c internal::functor_traits<Visitor>::PacketAccess is true and the expression is vectorizable and column-major,
+  * or a row vector, the visitor must also provide:
+  * \code
+  *   // called before a run of at most 2^20 packets of consecutive coefficients starting at (i,j)
+  *   void beginPackets(Index i, Index j);
+  *   // called for the coefficients (i,j) to (i+PacketSize-1,j), or (i,j+PacketSize-1) for a row vector
+  *   template<typename Packet> void packet(const Packet& p, Index i, Index j);
+  *   // called after the last packet of a run
+  *   void endPackets();
+  * \endcode
+  * The coefficients are still visited in column-major order, part of them by runs of packets.
+  *
   * \note compared to one or two \em for \em loops, visitors offer automatic
   * unrolling for small fixed size matrix.
   *
@@ -81,6 +139,12 @@ void DenseBase<Derived>::visit(Visitor& visitor) const
                    && (SizeAtCompileTime == 1 || internal::functor_traits<Visitor>::Cost != Dynamic)
                    && SizeAtCompileTime * CoeffReadCost + (SizeAtCompileTime-1) * internal::functor_traits<Visitor>::Cost
                       <= EIGEN_UNROLLING_LIMIT };
+  enum { vectorize = !unroll
+                      && bool(internal::functor_traits<Visitor>::PacketAccess)
+                      && bool(Flags & PacketAccessBit)
+                      && (!IsRowMajor || RowsAtCompileTime==1) };
+  if(!unroll)
+    return internal::packet_visitor_impl<Visitor, Derived, vectorize>::run(derived(), visitor);
   return internal::visitor_impl<Visitor, Derived,
       unroll ? int(SizeAtCompileTime) : Dynamic
     >::run(derived(), visitor);
@@ -96,6 +160,8 @@ struct coeff_visitor
 {
   typedef typename Derived::Index Index;
   typedef typename Derived::Scalar Scalar;
+  typedef typename packet_traits<Scalar>::type PacketScalar;
+  enum { PacketSize = packet_traits<Scalar>::size };
   Index row, col;
   Scalar res;
   inline void init(const Scalar& value, Index i, Index j)
@@ -104,6 +170,49 @@ struct coeff_visitor
     row = i;
     col = j;
   }
+
+  // Within a run of packets, each lane keeps its own extremum, in m_best, and the offset in the run of the packet
+  // it comes from, in m_bestOffset. A lane is only updated by a strictly better coefficient, so it keeps the first
+  // one of its extrema, and starting from res leaves a NaN res unchanged as in the scalar path.
+  Index m_runRow, m_runCol;
+  PacketScalar m_best, m_bestOffset;
+  inline void beginPackets(Index i, Index j)
+  {
+    m_runRow = i;
+    m_runCol = j;
+    m_best = pset1<PacketScalar>(res);
+    m_bestOffset = pset1<PacketScalar>(Scalar(0));
+  }
+  // the lanes set in the mask \a better are taken from the packet \a p starting at (i,j)
+  inline void updatePackets(const PacketScalar& better, const PacketScalar& p, Index i, Index j)
+  {
+    m_best = pblend(better, p, m_best);
+    m_bestOffset = pblend(better, pset1<PacketScalar>(Scalar(Derived::IsRowMajor ? j-m_runCol : i-m_runRow)), m_bestOffset);
+  }
+  // combines the lanes into res, keeping the first extremum of the run in column-major order
+  template<typename Compare>
+  inline void endPackets(Compare isBetter)
+  {
+    EIGEN_ALIGN16 Scalar best[PacketSize];
+    EIGEN_ALIGN16 Scalar bestOffset[PacketSize];
+    pstore(best, m_best);
+    pstore(bestOffset, m_bestOffset);
+    Index offset = -1;
+    for(Index k = 0; k < PacketSize; ++k)
+    {
+      const Index koffset = Index(bestOffset[k]) + k;
+      if(isBetter(best[k], res) || (offset >= 0 && best[k] == res && koffset < offset))
+      {
+        res = best[k];
+        offset = koffset;
+      }
+    }
+    if(offset >= 0)
+    {
+      row = Derived::IsRowMajor ? m_runRow : m_runRow + offset;
+      col = Derived::IsRowMajor ? m_runCol + offset : m_runCol;
+    }
+  }
 };
 
 /** \internal
@@ -125,12 +234,24 @@ struct min_coeff_visitor : coeff_visitor<Derived>
       this->col = j;
     }
   }
+  typedef typename coeff_visitor<Derived>::PacketScalar PacketScalar;
+  void packet(const PacketScalar& p, Index i, Index j)
+  {
+    const PacketScalar better = pcmp_lt(p, this->m_best);
+    if(predux_any(better))
+      this->updatePackets(better, p, i, j);
+  }
+  void endPackets()
+  {
+    coeff_visitor<Derived>::endPackets(std::less<Scalar>());
+  }
 };
 
-template<typename Scalar>
-struct functor_traits<min_coeff_visitor<Scalar> > {
+template<typename Derived>
+struct functor_traits<min_coeff_visitor<Derived> > {
   enum {
-    Cost = NumTraits<Scalar>::AddCost
+    Cost = NumTraits<typename Derived::Scalar>::AddCost,
+    PacketAccess = packet_traits<typename Derived::Scalar>::HasCmp
   };
 };
 
@@ -153,12 +274,24 @@ struct max_coeff_visitor : coeff_visitor<Derived>
       this->col = j;
     }
   }
+  typedef typename coeff_visitor<Derived>::PacketScalar PacketScalar;
+  void packet(const PacketScalar& p, Index i, Index j)
+  {
+    const PacketScalar better = pcmp_lt(this->m_best, p);
+    if(predux_any(better))
+      this->updatePackets(better, p, i, j);
+  }
+  void endPackets()
+  {
+    coeff_visitor<Derived>::endPackets(std::greater<Scalar>());
+  }
 };
 
-template<typename Scalar>
-struct functor_traits<max_coeff_visitor<Scalar> > {
+template<typename Derived>
+struct functor_traits<max_coeff_visitor<Derived> > {
   enum {
-    Cost = NumTraits<Scalar>::AddCost
+    Cost = NumTraits<typename Derived::Scalar>::AddCost,
+    PacketAccess = packet_traits<typename Derived::Scalar>::HasCmp
   };
 };
 
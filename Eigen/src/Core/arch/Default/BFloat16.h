@@ -0,0 +1,197 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef EIGEN_BFLOAT16_H
+#define EIGEN_BFLOAT16_H
+
+namespace Eigen {
+
+namespace internal {
+
+/** \internal \returns the bfloat16 bits of \a f, rounded to nearest even. */
+inline unsigned short float_to_bfloat16_rtne(float f)
+{
+  unsigned int u;
+  std::memcpy(&u, &f, sizeof(u));
+  // NaNs must not be rounded up to infinity
+  if((u & 0x7fffffffu) > 0x7f800000u)
+    return static_cast<unsigned short>((u >> 16) | 0x0040);
+  u += 0x7fffu + ((u >> 16) & 1);
+  return static_cast<unsigned short>(u >> 16);
+}
+
+/** \internal \returns the bfloat16 bits of \a f, rounded toward zero. */
+inline unsigned short float_to_bfloat16_truncate(float f)
+{
+  unsigned int u;
+  std::memcpy(&u, &f, sizeof(u));
+  if((u & 0x7fffffffu) > 0x7f800000u)
+    return static_cast<unsigned short>((u >> 16) | 0x0040);
+  return static_cast<unsigned short>(u >> 16);
+}
+
+/** \internal \returns the float value of the bfloat16 bits \a h. */
+inline float bfloat16_to_float(unsigned short h)
+{
+  const unsigned int u = static_cast<unsigned int>(h) << 16;
+  float f;
+  std::memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+} // end namespace internal
+
+/** \class bfloat16
+  * \ingroup Core_Module
+  *
+  * \brief Brain floating point scalar type
+  *
+  * A bfloat16 holds the upper 16 bits of a float: it has the exponent range of float with an 8 bits
+  * significand. Large matrices of bfloat16 take half the memory and bandwidth of float ones, and unlike
+  * \ref half their values and accumulations cannot overflow before float would.
+  * Arithmetic operators convert their operands to float and round the result to the nearest bfloat16,
+  * and vectorized expressions do the same on whole packets. The products of large matrices and vectors
+  * convert the operands to float as they are packed and accumulate in float.
+  *
+  * Conversions to bfloat16 are explicit and round to nearest even, e.g., \c bfloat16(1.5f) or
+  * \c m.cast<bfloat16>(); truncate() is a cheaper conversion which rounds toward zero.
+  * A double is rounded directly to the nearest bfloat16, not through the nearest float.
+  * A bfloat16 converts implicitly to float.
+  */
+struct bfloat16
+{
+  bfloat16() : x(0) {}
+
+  template<typename T>
+  explicit bfloat16(const T& value) : x(internal::float_to_bfloat16_rtne(static_cast<float>(value))) {}
+
+  explicit bfloat16(double value) : x(internal::float_to_bfloat16_rtne(internal::double_to_float_round_to_odd(value))) {}
+
+  operator float() const { return internal::bfloat16_to_float(x); }
+
+  /** \returns the bfloat16 whose bits are \a bits */
+  static bfloat16 fromBits(unsigned short bits) { bfloat16 h; h.x = bits; return h; }
+
+  /** \returns \a f rounded toward zero, i.e., its upper 16 bits */
+  static bfloat16 truncate(float f) { return fromBits(internal::float_to_bfloat16_truncate(f)); }
+
+  unsigned short x;
+};
+
+inline bfloat16 operator+(const bfloat16& a, const bfloat16& b) { return bfloat16(float(a) + float(b)); }
+inline bfloat16 operator-(const bfloat16& a, const bfloat16& b) { return bfloat16(float(a) - float(b)); }
+inline bfloat16 operator*(const bfloat16& a, const bfloat16& b) { return bfloat16(float(a) * float(b)); }
+inline bfloat16 operator/(const bfloat16& a, const bfloat16& b) { return bfloat16(float(a) / float(b)); }
+inline bfloat16 operator-(const bfloat16& a) { return bfloat16::fromBits(static_cast<unsigned short>(a.x ^ 0x8000)); }
+
+inline bfloat16& operator+=(bfloat16& a, const bfloat16& b) { a = a + b; return a; }
+inline bfloat16& operator-=(bfloat16& a, const bfloat16& b) { a = a - b; return a; }
+inline bfloat16& operator*=(bfloat16& a, const bfloat16& b) { a = a * b; return a; }
+inline bfloat16& operator/=(bfloat16& a, const bfloat16& b) { a = a / b; return a; }
+
+inline bool operator==(const bfloat16& a, const bfloat16& b) { return float(a) == float(b); }
+inline bool operator!=(const bfloat16& a, const bfloat16& b) { return float(a) != float(b); }
+inline bool operator< (const bfloat16& a, const bfloat16& b) { return float(a) <  float(b); }
+inline bool operator<=(const bfloat16& a, const bfloat16& b) { return float(a) <= float(b); }
+inline bool operator> (const bfloat16& a, const bfloat16& b) { return float(a) >  float(b); }
+inline bool operator>=(const bfloat16& a, const bfloat16& b) { return float(a) >= float(b); }
+
+template<typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>& operator<<(std::basic_ostream<CharT,Traits>& os, const bfloat16& h) { return os << float(h); }
+
+// These overloads are found by argument dependent lookup from the internal math functions.
+inline bfloat16 abs(const bfloat16& a)   { return bfloat16::fromBits(static_cast<unsigned short>(a.x & 0x7fff)); }
+inline bfloat16 sqrt(const bfloat16& a)  { return bfloat16(std::sqrt(float(a))); }
+inline bfloat16 exp(const bfloat16& a)   { return bfloat16(std::exp(float(a))); }
+inline bfloat16 log(const bfloat16& a)   { return bfloat16(std::log(float(a))); }
+inline bfloat16 sin(const bfloat16& a)   { return bfloat16(std::sin(float(a))); }
+inline bfloat16 cos(const bfloat16& a)   { return bfloat16(std::cos(float(a))); }
+inline bfloat16 tan(const bfloat16& a)   { return bfloat16(std::tan(float(a))); }
+inline bfloat16 asin(const bfloat16& a)  { return bfloat16(std::asin(float(a))); }
+inline bfloat16 acos(const bfloat16& a)  { return bfloat16(std::acos(float(a))); }
+inline bfloat16 atan(const bfloat16& a)  { return bfloat16(std::atan(float(a))); }
+inline bfloat16 floor(const bfloat16& a) { return bfloat16(std::floor(float(a))); }
+inline bfloat16 ceil(const bfloat16& a)  { return bfloat16(std::ceil(float(a))); }
+inline bfloat16 pow(const bfloat16& a, const bfloat16& b)   { return bfloat16(std::pow(float(a), float(b))); }
+inline bfloat16 atan2(const bfloat16& a, const bfloat16& b) { return bfloat16(std::atan2(float(a), float(b))); }
+
+template<> struct NumTraits<bfloat16>
+{
+  enum {
+    IsInteger = 0,
+    IsSigned = 1,
+    IsComplex = 0,
+    RequireInitialization = 0,
+    ReadCost = 1,
+    AddCost = 2,
+    MulCost = 2
+  };
+
+  typedef bfloat16 Real;
+  typedef bfloat16 NonInteger;
+  typedef bfloat16 Nested;
+
+  static inline bfloat16 epsilon() { return bfloat16::fromBits(0x3c00); }
+  static inline bfloat16 dummy_precision() { return bfloat16(5e-2f); }
+  static inline bfloat16 highest() { return bfloat16::fromBits(0x7f7f); }
+  static inline bfloat16 lowest() { return bfloat16::fromBits(0xff7f); }
+};
+
+namespace internal {
+
+template<> struct random_impl<bfloat16>
+{
+  static inline bfloat16 run(const bfloat16& x, const bfloat16& y) { return bfloat16(random<float>(x, y)); }
+  static inline bfloat16 run() { return run(bfloat16(-1.f), bfloat16(1.f)); }
+};
+
+} // end namespace internal
+
+} // end namespace Eigen
+
+namespace std {
+
+template<> class numeric_limits<Eigen::bfloat16>
+{
+  public:
+    static const bool is_specialized = true;
+    static const bool is_signed = true;
+    static const bool is_integer = false;
+    static const bool is_exact = false;
+    static const bool has_infinity = true;
+    static const bool has_quiet_NaN = true;
+    static const bool has_signaling_NaN = true;
+    static const float_denorm_style has_denorm = denorm_present;
+    static const bool has_denorm_loss = false;
+    static const float_round_style round_style = round_to_nearest;
+    static const bool is_iec559 = false;
+    static const bool is_bounded = true;
+    static const bool is_modulo = false;
+    static const int digits = 8;
+    static const int digits10 = 2;
+    static const int radix = 2;
+    static const int min_exponent = -125;
+    static const int min_exponent10 = -37;
+    static const int max_exponent = 128;
+    static const int max_exponent10 = 38;
+    static const bool traps = false;
+    static const bool tinyness_before = false;
+
+    static Eigen::bfloat16 (min)() { return Eigen::bfloat16::fromBits(0x0080); }
+    static Eigen::bfloat16 (max)() { return Eigen::bfloat16::fromBits(0x7f7f); }
+    static Eigen::bfloat16 lowest() { return Eigen::bfloat16::fromBits(0xff7f); }
+    static Eigen::bfloat16 epsilon() { return Eigen::bfloat16::fromBits(0x3c00); }
+    static Eigen::bfloat16 round_error() { return Eigen::bfloat16::fromBits(0x3f00); }
+    static Eigen::bfloat16 infinity() { return Eigen::bfloat16::fromBits(0x7f80); }
+    static Eigen::bfloat16 quiet_NaN() { return Eigen::bfloat16::fromBits(0x7fc0); }
+    static Eigen::bfloat16 signaling_NaN() { return Eigen::bfloat16::fromBits(0x7fa0); }
+    static Eigen::bfloat16 denorm_min() { return Eigen::bfloat16::fromBits(0x0001); }
+};
+
+} // end namespace std
+
+#endif // EIGEN_BFLOAT16_H
@@ -0,0 +1,262 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef EIGEN_HALF_H
+#define EIGEN_HALF_H
+
+namespace Eigen {
+
+namespace internal {
+
+/** \internal \returns the IEEE 754 half precision bits of \a f, rounded to nearest even. */
+inline unsigned short float_to_half_rtne(float f)
+{
+#ifdef EIGEN_VECTORIZE_F16C
+  return static_cast<unsigned short>(_cvtss_sh(f, 0));
+#else
+  const unsigned int f32infty = 255u << 23;
+  const unsigned int f16max = (127u + 16u) << 23;
+  const unsigned int denorm_magic_bits = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+  unsigned int u;
+  std::memcpy(&u, &f, sizeof(u));
+  const unsigned int sign = u & 0x80000000u;
+  u ^= sign;
+
+  unsigned short h;
+  if(u >= f16max)
+  {
+    // overflows to infinity, and NaNs become quiet NaNs
+    h = u > f32infty ? 0x7e00 : 0x7c00;
+  }
+  else if(u < (113u << 23))
+  {
+    // subnormal or zero: the addition to a magic number rounds the mantissa at the right place
+    float magic, v;
+    std::memcpy(&magic, &denorm_magic_bits, sizeof(magic));
+    std::memcpy(&v, &u, sizeof(v));
+    v += magic;
+    std::memcpy(&u, &v, sizeof(u));
+    h = static_cast<unsigned short>(u - denorm_magic_bits);
+  }
+  else
+  {
+    const unsigned int mant_odd = (u >> 13) & 1;
+    // rebias the exponent and round to nearest even
+    u += ((unsigned int)(15 - 127) << 23) + 0xfff;
+    u += mant_odd;
+    h = static_cast<unsigned short>(u >> 13);
+  }
+  return static_cast<unsigned short>(h | (sign >> 16));
+#endif
+}
+
+/** \internal \returns \a d rounded to float toward zero, with the last bit of the significand set when the
+  * conversion is inexact. Rounding this float to a format with at least two bits less of significand gives
+  * the same result as rounding \a d directly, while rounding \a d to the nearest float first could round twice.
+  */
+inline float double_to_float_round_to_odd(double d)
+{
+  float f = static_cast<float>(d);
+  if(static_cast<double>(f) != d && d == d)
+  {
+    unsigned int u;
+    std::memcpy(&u, &f, sizeof(u));
+    if(std::abs(static_cast<double>(f)) > std::abs(d))
+      --u;
+    u |= 1;
+    std::memcpy(&f, &u, sizeof(f));
+  }
+  return f;
+}
+
+/** \internal \returns the IEEE 754 half precision bits of \a d, rounded to nearest even. */
+inline unsigned short double_to_half_rtne(double d)
+{
+  return float_to_half_rtne(double_to_float_round_to_odd(d));
+}
+
+/** \internal \returns the float value of the IEEE 754 half precision bits \a h. */
+inline float half_to_float(unsigned short h)
+{
+#ifdef EIGEN_VECTORIZE_F16C
+  return _cvtsh_ss(h);
+#else
+  const unsigned int shifted_exp = 0x7c00u << 13;
+  unsigned int u = (h & 0x7fffu) << 13;
+  const unsigned int exp = shifted_exp & u;
+  u += (127u - 15u) << 23;
+  float f;
+  if(exp == shifted_exp)
+  {
+    // infinity or NaN
+    u += (128u - 16u) << 23;
+    std::memcpy(&f, &u, sizeof(f));
+  }
+  else if(exp == 0)
+  {
+    // zero or subnormal: renormalize through a float subtraction
+    const unsigned int magic_bits = 113u << 23;
+    float magic;
+    std::memcpy(&magic, &magic_bits, sizeof(magic));
+    u += 1u << 23;
+    std::memcpy(&f, &u, sizeof(f));
+    f -= magic;
+  }
+  else
+    std::memcpy(&f, &u, sizeof(f));
+  if(h & 0x8000u)
+    f = -f;
+  return f;
+#endif
+}
+
+} // end namespace internal
+
+/** \class half
+  * \ingroup Core_Module
+  *
+  * \brief IEEE 754 half precision floating point scalar type
+  *
+  * A half is stored on 16 bits, which halves the memory footprint and bandwidth of large matrices compared to float.
+  * Arithmetic operators convert their operands to float and round the result back to the nearest half.
+  * Vectorized expressions do the same on whole packets, with the F16C instructions when they are enabled.
+  * The products of large matrices and vectors of halves convert the operands to float as they are packed
+  * and accumulate in float, so that the result is rounded only once.
+  *
+  * Conversions to half are explicit, e.g., \c half(1.5f) or \c m.cast<half>(), while a half converts implicitly to float.
+  * A double is rounded directly to the nearest half, not through the nearest float.
+  */
+struct half
+{
+  half() : x(0) {}
+
+  template<typename T>
+  explicit half(const T& value) : x(internal::float_to_half_rtne(static_cast<float>(value))) {}
+
+  explicit half(double value) : x(internal::double_to_half_rtne(value)) {}
+
+  operator float() const { return internal::half_to_float(x); }
+
+  /** \returns the half whose bits are \a bits */
+  static half fromBits(unsigned short bits) { half h; h.x = bits; return h; }
+
+  unsigned short x;
+};
+
+inline half operator+(const half& a, const half& b) { return half(float(a) + float(b)); }
+inline half operator-(const half& a, const half& b) { return half(float(a) - float(b)); }
+inline half operator*(const half& a, const half& b) { return half(float(a) * float(b)); }
+inline half operator/(const half& a, const half& b) { return half(float(a) / float(b)); }
+inline half operator-(const half& a) { return half::fromBits(static_cast<unsigned short>(a.x ^ 0x8000)); }
+
+inline half& operator+=(half& a, const half& b) { a = a + b; return a; }
+inline half& operator-=(half& a, const half& b) { a = a - b; return a; }
+inline half& operator*=(half& a, const half& b) { a = a * b; return a; }
+inline half& operator/=(half& a, const half& b) { a = a / b; return a; }
+
+inline bool operator==(const half& a, const half& b) { return float(a) == float(b); }
+inline bool operator!=(const half& a, const half& b) { return float(a) != float(b); }
+inline bool operator< (const half& a, const half& b) { return float(a) <  float(b); }
+inline bool operator<=(const half& a, const half& b) { return float(a) <= float(b); }
+inline bool operator> (const half& a, const half& b) { return float(a) >  float(b); }
+inline bool operator>=(const half& a, const half& b) { return float(a) >= float(b); }
+
+template<typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>& operator<<(std::basic_ostream<CharT,Traits>& os, const half& h) { return os << float(h); }
+
+// These overloads are found by argument dependent lookup from the internal math functions.
+inline half abs(const half& a)   { return half::fromBits(static_cast<unsigned short>(a.x & 0x7fff)); }
+inline half sqrt(const half& a)  { return half(std::sqrt(float(a))); }
+inline half exp(const half& a)   { return half(std::exp(float(a))); }
+inline half log(const half& a)   { return half(std::log(float(a))); }
+inline half sin(const half& a)   { return half(std::sin(float(a))); }
+inline half cos(const half& a)   { return half(std::cos(float(a))); }
+inline half tan(const half& a)   { return half(std::tan(float(a))); }
+inline half asin(const half& a)  { return half(std::asin(float(a))); }
+inline half acos(const half& a)  { return half(std::acos(float(a))); }
+inline half atan(const half& a)  { return half(std::atan(float(a))); }
+inline half floor(const half& a) { return half(std::floor(float(a))); }
+inline half ceil(const half& a)  { return half(std::ceil(float(a))); }
+inline half pow(const half& a, const half& b)   { return half(std::pow(float(a), float(b))); }
+inline half atan2(const half& a, const half& b) { return half(std::atan2(float(a), float(b))); }
+
+template<> struct NumTraits<half>
+{
+  enum {
+    IsInteger = 0,
+    IsSigned = 1,
+    IsComplex = 0,
+    RequireInitialization = 0,
+    ReadCost = 1,
+    AddCost = 3,
+    MulCost = 3
+  };
+
+  typedef half Real;
+  typedef half NonInteger;
+  typedef half Nested;
+
+  static inline half epsilon() { return half::fromBits(0x1400); }
+  static inline half dummy_precision() { return half(1e-2f); }
+  static inline half highest() { return half::fromBits(0x7bff); }
+  static inline half lowest() { return half::fromBits(0xfbff); }
+};
+
+namespace internal {
+
+template<> struct random_impl<half>
+{
+  static inline half run(const half& x, const half& y) { return half(random<float>(x, y)); }
+  static inline half run() { return run(half(-1.f), half(1.f)); }
+};
+
+} // end namespace internal
+
+} // end namespace Eigen
+
+namespace std {
+
+template<> class numeric_limits<Eigen::half>
+{
+  public:
+    static const bool is_specialized = true;
+    static const bool is_signed = true;
+    static const bool is_integer = false;
+    static const bool is_exact = false;
+    static const bool has_infinity = true;
+    static const bool has_quiet_NaN = true;
+    static const bool has_signaling_NaN = true;
+    static const float_denorm_style has_denorm = denorm_present;
+    static const bool has_denorm_loss = false;
+    static const float_round_style round_style = round_to_nearest;
+    static const bool is_iec559 = true;
+    static const bool is_bounded = true;
+    static const bool is_modulo = false;
+    static const int digits = 11;
+    static const int digits10 = 3;
+    static const int radix = 2;
+    static const int min_exponent = -13;
+    static const int min_exponent10 = -4;
+    static const int max_exponent = 16;
+    static const int max_exponent10 = 4;
+    static const bool traps = false;
+    static const bool tinyness_before = false;
+
+    static Eigen::half (min)() { return Eigen::half::fromBits(0x0400); }
+    static Eigen::half (max)() { return Eigen::half::fromBits(0x7bff); }
+    static Eigen::half lowest() { return Eigen::half::fromBits(0xfbff); }
+    static Eigen::half epsilon() { return Eigen::half::fromBits(0x1400); }
+    static Eigen::half round_error() { return Eigen::half::fromBits(0x3800); }
+    static Eigen::half infinity() { return Eigen::half::fromBits(0x7c00); }
+    static Eigen::half quiet_NaN() { return Eigen::half::fromBits(0x7e00); }
+    static Eigen::half signaling_NaN() { return Eigen::half::fromBits(0x7d00); }
+    static Eigen::half denorm_min() { return Eigen::half::fromBits(0x0001); }
+};
+
+} // end namespace std
+
+#endif // EIGEN_HALF_H
@@ -38,6 +38,95 @@
 #define EIGEN_TUNE_TRIANGULAR_PANEL_WIDTH 8
 #endif
 
+/** Defines the amount of work, in Eigen's own notion of "number of FLOPS" (number of coefficients times
+  * their CoeffReadCost), above which a coefficient-wise assignment is split among the OpenMP threads.
+  * Each thread must get at least that much work. The default is 262144.
+  */
+#ifndef EIGEN_PARALLEL_ASSIGN_THRESHOLD
+#define EIGEN_PARALLEL_ASSIGN_THRESHOLD 262144
+#endif
+
+/** Defines the size in bytes above which the destination of a linear vectorized assignment is written with
+  * non-temporal stores, which bypass the caches instead of first reading every destination line.
+  * The default, 0, stands for the size of the top level cache as returned by queryTopLevelCacheSize().
+  * Define EIGEN_DONT_USE_STREAMING_STORES to never use them.
+  */
+#ifndef EIGEN_STREAMING_STORE_THRESHOLD
+#define EIGEN_STREAMING_STORE_THRESHOLD 0
+#endif
+
+/** Defines the minimal number of coefficients of the chunks into which large vectorized reductions are split.
+  * The partial results of the chunks are combined pairwise, in an order which only depends on the size of the
+  * reduced expression, and the chunks are distributed among the OpenMP threads. The default is 16384.
+  */
+#ifndef EIGEN_REDUX_CHUNK_SIZE
+#define EIGEN_REDUX_CHUNK_SIZE 16384
+#endif
+
+/** Defines the maximal number of chunks into which a vectorized reduction is split. The default is 64.
+  */
+#ifndef EIGEN_REDUX_MAX_CHUNKS
+#define EIGEN_REDUX_MAX_CHUNKS 64
+#endif
+
+/** Defines the amount of work, in Eigen's own notion of "number of FLOPS", above which the chunks of a reduction
+  * are distributed among the OpenMP threads. Each thread must get at least that much work. The default is 262144.
+  */
+#ifndef EIGEN_PARALLEL_REDUX_THRESHOLD
+#define EIGEN_PARALLEL_REDUX_THRESHOLD 262144
+#endif
+
+/** Defines the size of the matrices above which the Cholesky decomposition LLT is computed by tiles scheduled
+  * on the OpenMP threads, rather than by block columns whose updates are only parallelized within the
+  * matrix products. The default is 512.
+  */
+#ifndef EIGEN_PARALLEL_LLT_THRESHOLD
+#define EIGEN_PARALLEL_LLT_THRESHOLD 512
+#endif
+
+/** Defines the size of the matrices from which SelfAdjointEigenSolver computes the eigenvectors of the
+  * tridiagonal matrix by divide and conquer rather than by QR iterations. The default is 64.
+  */
+#ifndef EIGEN_SELFADJOINT_DC_THRESHOLD
+#define EIGEN_SELFADJOINT_DC_THRESHOLD 64
+#endif
+
+/** Defines the size of the active blocks of a Hessenberg matrix from which RealSchur performs multishift QR
+  * sweeps with aggressive early deflation, rather than Francis double shift steps. The default is 75.
+  */
+#ifndef EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD
+#define EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD 75
+#endif
+
+/** Defines the size of the active blocks of a Hessenberg matrix from which ComplexSchur performs multishift QR
+  * sweeps with aggressive early deflation, rather than single shift steps. The default is 75.
+  */
+#ifndef EIGEN_COMPLEXSCHUR_MULTISHIFT_THRESHOLD
+#define EIGEN_COMPLEXSCHUR_MULTISHIFT_THRESHOLD 75
+#endif
+
+/** Defines the size of the bidiagonal blocks up to which BDCSVD computes their singular value decomposition by
+  * JacobiSVD rather than by divide and conquer. Matrices which are not larger are decomposed by JacobiSVD
+  * altogether. The default is 16.
+  */
+#ifndef EIGEN_BDCSVD_THRESHOLD
+#define EIGEN_BDCSVD_THRESHOLD 16
+#endif
+
+/** Defines the outer strides avoided by matrices having the PaddedOuterStride option: when the size in bytes of
+  * an inner vector is a multiple of this value, consecutive inner vectors would map to the same few cache sets,
+  * and the outer stride is thus increased by EIGEN_PADDED_OUTER_STRIDE_EXTRA bytes. The default is 256.
+  */
+#ifndef EIGEN_PADDED_OUTER_STRIDE_ALIASING
+#define EIGEN_PADDED_OUTER_STRIDE_ALIASING 256
+#endif
+
+/** Defines the number of bytes by which the aliasing outer strides of matrices having the PaddedOuterStride option
+  * are increased. It should be a multiple of the packet size. The default is 64, i.e., one cache line.
+  */
+#ifndef EIGEN_PADDED_OUTER_STRIDE_EXTRA
+#define EIGEN_PADDED_OUTER_STRIDE_EXTRA 64
+#endif
 
 /** Defines the default number of registers available for that architecture.
   * Currently it must be 8 or 16. Other values will fail.
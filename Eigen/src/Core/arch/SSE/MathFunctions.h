@@ -381,6 +381,20 @@ Packet4f psqrt<Packet4f>(const Packet4f& _x)
   return pmul(_x,x);
 }
 
+#ifdef EIGEN_VECTORIZE_F16C
+template<> EIGEN_STRONG_INLINE Packet4h plog<Packet4h>(const Packet4h& x)  { return float2half(plog(half2float(x))); }
+template<> EIGEN_STRONG_INLINE Packet4h pexp<Packet4h>(const Packet4h& x)  { return float2half(pexp(half2float(x))); }
+template<> EIGEN_STRONG_INLINE Packet4h psin<Packet4h>(const Packet4h& x)  { return float2half(psin(half2float(x))); }
+template<> EIGEN_STRONG_INLINE Packet4h pcos<Packet4h>(const Packet4h& x)  { return float2half(pcos(half2float(x))); }
+template<> EIGEN_STRONG_INLINE Packet4h psqrt<Packet4h>(const Packet4h& x) { return float2half(_mm_sqrt_ps(half2float(x))); }
+#endif
+
+template<> EIGEN_STRONG_INLINE Packet4bf plog<Packet4bf>(const Packet4bf& x)  { return float2bf(plog(bf2float(x))); }
+template<> EIGEN_STRONG_INLINE Packet4bf pexp<Packet4bf>(const Packet4bf& x)  { return float2bf(pexp(bf2float(x))); }
+template<> EIGEN_STRONG_INLINE Packet4bf psin<Packet4bf>(const Packet4bf& x)  { return float2bf(psin(bf2float(x))); }
+template<> EIGEN_STRONG_INLINE Packet4bf pcos<Packet4bf>(const Packet4bf& x)  { return float2bf(pcos(bf2float(x))); }
+template<> EIGEN_STRONG_INLINE Packet4bf psqrt<Packet4bf>(const Packet4bf& x) { return float2bf(_mm_sqrt_ps(bf2float(x))); }
+
 } // end namespace internal
 
 } // end namespace Eigen
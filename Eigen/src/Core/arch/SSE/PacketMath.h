@@ -68,7 +68,9 @@ template<> struct packet_traits<float>  : default_packet_traits
     HasCos  = EIGEN_FAST_MATH,
     HasLog  = 1,
     HasExp  = 1,
-    HasSqrt = 1
+    HasSqrt = 1,
+    HasCmp  = 1,
+    HasBlend = 1
   };
 };
 template<> struct packet_traits<double> : default_packet_traits
@@ -79,7 +81,9 @@ template<> struct packet_traits<double> : default_packet_traits
     AlignedOnScalar = 1,
     size=2,
 
-    HasDiv    = 1
+    HasDiv    = 1,
+    HasCmp    = 1,
+    HasBlend  = 1
   };
 };
 template<> struct packet_traits<int>    : default_packet_traits
@@ -89,7 +93,12 @@ template<> struct packet_traits<int>    : default_packet_traits
     // FIXME check the Has*
     Vectorizable = 1,
     AlignedOnScalar = 1,
-    size=4
+    size=4,
+
+    HasCmp    = 1,
+    HasBlend  = 1,
+    HasBitwise = 1,
+    HasShift  = 1
   };
 };
 
@@ -169,18 +178,26 @@ template<> EIGEN_STRONG_INLINE Packet4f pmin<Packet4f>(const Packet4f& a, const
 template<> EIGEN_STRONG_INLINE Packet2d pmin<Packet2d>(const Packet2d& a, const Packet2d& b) { return _mm_min_pd(a,b); }
 template<> EIGEN_STRONG_INLINE Packet4i pmin<Packet4i>(const Packet4i& a, const Packet4i& b)
 {
+#ifdef EIGEN_VECTORIZE_SSE4_1
+  return _mm_min_epi32(a,b);
+#else
   // after some bench, this version *is* faster than a scalar implementation
   Packet4i mask = _mm_cmplt_epi32(a,b);
   return _mm_or_si128(_mm_and_si128(mask,a),_mm_andnot_si128(mask,b));
+#endif
 }
 
 template<> EIGEN_STRONG_INLINE Packet4f pmax<Packet4f>(const Packet4f& a, const Packet4f& b) { return _mm_max_ps(a,b); }
 template<> EIGEN_STRONG_INLINE Packet2d pmax<Packet2d>(const Packet2d& a, const Packet2d& b) { return _mm_max_pd(a,b); }
 template<> EIGEN_STRONG_INLINE Packet4i pmax<Packet4i>(const Packet4i& a, const Packet4i& b)
 {
+#ifdef EIGEN_VECTORIZE_SSE4_1
+  return _mm_max_epi32(a,b);
+#else
   // after some bench, this version *is* faster than a scalar implementation
   Packet4i mask = _mm_cmpgt_epi32(a,b);
   return _mm_or_si128(_mm_and_si128(mask,a),_mm_andnot_si128(mask,b));
+#endif
 }
 
 template<> EIGEN_STRONG_INLINE Packet4f pand<Packet4f>(const Packet4f& a, const Packet4f& b) { return _mm_and_ps(a,b); }
@@ -199,6 +216,57 @@ template<> EIGEN_STRONG_INLINE Packet4f pandnot<Packet4f>(const Packet4f& a, con
 template<> EIGEN_STRONG_INLINE Packet2d pandnot<Packet2d>(const Packet2d& a, const Packet2d& b) { return _mm_andnot_pd(a,b); }
 template<> EIGEN_STRONG_INLINE Packet4i pandnot<Packet4i>(const Packet4i& a, const Packet4i& b) { return _mm_andnot_si128(a,b); }
 
+template<int N> EIGEN_STRONG_INLINE Packet4i plogical_shift_left(const Packet4i& a) { return _mm_slli_epi32(a,N); }
+template<int N> EIGEN_STRONG_INLINE Packet4i parithmetic_shift_right(const Packet4i& a) { return _mm_srai_epi32(a,N); }
+template<int N> EIGEN_STRONG_INLINE Packet4i plogical_shift_right(const Packet4i& a) { return _mm_srli_epi32(a,N); }
+
+template<> EIGEN_STRONG_INLINE Packet4f ptrue<Packet4f>(const Packet4f& a) { Packet4i b = _mm_castps_si128(a); return _mm_castsi128_ps(_mm_cmpeq_epi32(b,b)); }
+template<> EIGEN_STRONG_INLINE Packet2d ptrue<Packet2d>(const Packet2d& a) { Packet4i b = _mm_castpd_si128(a); return _mm_castsi128_pd(_mm_cmpeq_epi32(b,b)); }
+template<> EIGEN_STRONG_INLINE Packet4i ptrue<Packet4i>(const Packet4i& a) { return _mm_cmpeq_epi32(a,a); }
+
+template<> EIGEN_STRONG_INLINE Packet4f pcmp_lt<Packet4f>(const Packet4f& a, const Packet4f& b) { return _mm_cmplt_ps(a,b); }
+template<> EIGEN_STRONG_INLINE Packet2d pcmp_lt<Packet2d>(const Packet2d& a, const Packet2d& b) { return _mm_cmplt_pd(a,b); }
+template<> EIGEN_STRONG_INLINE Packet4i pcmp_lt<Packet4i>(const Packet4i& a, const Packet4i& b) { return _mm_cmplt_epi32(a,b); }
+
+template<> EIGEN_STRONG_INLINE Packet4f pcmp_le<Packet4f>(const Packet4f& a, const Packet4f& b) { return _mm_cmple_ps(a,b); }
+template<> EIGEN_STRONG_INLINE Packet2d pcmp_le<Packet2d>(const Packet2d& a, const Packet2d& b) { return _mm_cmple_pd(a,b); }
+template<> EIGEN_STRONG_INLINE Packet4i pcmp_le<Packet4i>(const Packet4i& a, const Packet4i& b) { return _mm_or_si128(_mm_cmplt_epi32(a,b),_mm_cmpeq_epi32(a,b)); }
+
+template<> EIGEN_STRONG_INLINE Packet4f pcmp_eq<Packet4f>(const Packet4f& a, const Packet4f& b) { return _mm_cmpeq_ps(a,b); }
+template<> EIGEN_STRONG_INLINE Packet2d pcmp_eq<Packet2d>(const Packet2d& a, const Packet2d& b) { return _mm_cmpeq_pd(a,b); }
+template<> EIGEN_STRONG_INLINE Packet4i pcmp_eq<Packet4i>(const Packet4i& a, const Packet4i& b) { return _mm_cmpeq_epi32(a,b); }
+
+#ifdef EIGEN_VECTORIZE_SSE4_1
+template<> EIGEN_STRONG_INLINE Packet4f pblend<Packet4f>(const Packet4f& mask, const Packet4f& a, const Packet4f& b) { return _mm_blendv_ps(b,a,mask); }
+template<> EIGEN_STRONG_INLINE Packet2d pblend<Packet2d>(const Packet2d& mask, const Packet2d& a, const Packet2d& b) { return _mm_blendv_pd(b,a,mask); }
+template<> EIGEN_STRONG_INLINE Packet4i pblend<Packet4i>(const Packet4i& mask, const Packet4i& a, const Packet4i& b) { return _mm_blendv_epi8(b,a,mask); }
+#else
+template<> EIGEN_STRONG_INLINE Packet4f pblend<Packet4f>(const Packet4f& mask, const Packet4f& a, const Packet4f& b) { return _mm_or_ps(_mm_and_ps(mask,a),_mm_andnot_ps(mask,b)); }
+template<> EIGEN_STRONG_INLINE Packet2d pblend<Packet2d>(const Packet2d& mask, const Packet2d& a, const Packet2d& b) { return _mm_or_pd(_mm_and_pd(mask,a),_mm_andnot_pd(mask,b)); }
+template<> EIGEN_STRONG_INLINE Packet4i pblend<Packet4i>(const Packet4i& mask, const Packet4i& a, const Packet4i& b) { return _mm_or_si128(_mm_and_si128(mask,a),_mm_andnot_si128(mask,b)); }
+#endif
+
+template<> EIGEN_STRONG_INLINE bool predux_any<Packet4f>(const Packet4f& a) { return _mm_movemask_ps(a) != 0; }
+template<> EIGEN_STRONG_INLINE bool predux_any<Packet2d>(const Packet2d& a) { return _mm_movemask_pd(a) != 0; }
+template<> EIGEN_STRONG_INLINE bool predux_any<Packet4i>(const Packet4i& a) { return _mm_movemask_epi8(a) != 0; }
+
+template<> EIGEN_STRONG_INLINE bool predux_all<Packet4f>(const Packet4f& a) { return _mm_movemask_ps(a) == 0xF; }
+template<> EIGEN_STRONG_INLINE bool predux_all<Packet2d>(const Packet2d& a) { return _mm_movemask_pd(a) == 0x3; }
+template<> EIGEN_STRONG_INLINE bool predux_all<Packet4i>(const Packet4i& a) { return _mm_movemask_epi8(a) == 0xFFFF; }
+
+template<> EIGEN_STRONG_INLINE int predux_count<Packet4f>(const Packet4f& a)
+{
+  int m = _mm_movemask_ps(a);
+  m = (m & 5) + ((m >> 1) & 5);
+  return (m & 3) + (m >> 2);
+}
+template<> EIGEN_STRONG_INLINE int predux_count<Packet2d>(const Packet2d& a)
+{
+  int m = _mm_movemask_pd(a);
+  return (m & 1) + (m >> 1);
+}
+template<> EIGEN_STRONG_INLINE int predux_count<Packet4i>(const Packet4i& a) { return predux_count(_mm_castsi128_ps(a)); }
+
 template<> EIGEN_STRONG_INLINE Packet4f pload<Packet4f>(const float*   from) { EIGEN_DEBUG_ALIGNED_LOAD return _mm_load_ps(from); }
 template<> EIGEN_STRONG_INLINE Packet2d pload<Packet2d>(const double*  from) { EIGEN_DEBUG_ALIGNED_LOAD return _mm_load_pd(from); }
 template<> EIGEN_STRONG_INLINE Packet4i pload<Packet4i>(const int*     from) { EIGEN_DEBUG_ALIGNED_LOAD return _mm_load_si128(reinterpret_cast<const Packet4i*>(from)); }
@@ -293,6 +361,14 @@ template<> EIGEN_STRONG_INLINE void pstore<float>(float*   to, const Packet4f& f
 template<> EIGEN_STRONG_INLINE void pstore<double>(double* to, const Packet2d& from) { EIGEN_DEBUG_ALIGNED_STORE _mm_store_pd(to, from); }
 template<> EIGEN_STRONG_INLINE void pstore<int>(int*       to, const Packet4i& from) { EIGEN_DEBUG_ALIGNED_STORE _mm_store_si128(reinterpret_cast<Packet4i*>(to), from); }
 
+template<> EIGEN_STRONG_INLINE void pstream<float>(float*   to, const Packet4f& from) { EIGEN_DEBUG_ALIGNED_STORE _mm_stream_ps(to, from); }
+template<> EIGEN_STRONG_INLINE void pstream<double>(double* to, const Packet2d& from) { EIGEN_DEBUG_ALIGNED_STORE _mm_stream_pd(to, from); }
+template<> EIGEN_STRONG_INLINE void pstream<int>(int*       to, const Packet4i& from) { EIGEN_DEBUG_ALIGNED_STORE _mm_stream_si128(reinterpret_cast<Packet4i*>(to), from); }
+
+template<> EIGEN_STRONG_INLINE void pstreamfence<Packet4f>() { _mm_sfence(); }
+template<> EIGEN_STRONG_INLINE void pstreamfence<Packet2d>() { _mm_sfence(); }
+template<> EIGEN_STRONG_INLINE void pstreamfence<Packet4i>() { _mm_sfence(); }
+
 template<> EIGEN_STRONG_INLINE void pstoreu<double>(double* to, const Packet2d& from) {
   EIGEN_DEBUG_UNALIGNED_STORE
   _mm_storel_pd((to), from);
@@ -625,6 +701,331 @@ struct palign_impl<Offset,Packet2d>
 };
 #endif
 
+#if defined(__x86_64__) || defined(_M_X64)
+
+// Packets of two 64 bits integers. Since Packet4i is already __m128i, they need their own type.
+struct Packet2l
+{
+  EIGEN_STRONG_INLINE Packet2l() {}
+  EIGEN_STRONG_INLINE Packet2l(const __m128i& a) : v(a) {}
+  EIGEN_STRONG_INLINE operator __m128i() const { return v; }
+  __m128i v;
+};
+
+template<> struct is_arithmetic<Packet2l> { enum { value = true }; };
+
+template<> struct packet_traits<std::ptrdiff_t> : default_packet_traits
+{
+  typedef Packet2l type;
+  enum {
+    Vectorizable = 1,
+    AlignedOnScalar = 1,
+    size=2,
+
+    HasCmp    = 1,
+    HasBlend  = 1,
+    HasBitwise = 1,
+    HasShift  = 1
+  };
+};
+
+template<> struct unpacket_traits<Packet2l> { typedef std::ptrdiff_t type; enum {size=2}; };
+
+template<> EIGEN_STRONG_INLINE Packet2l pset1<Packet2l>(const std::ptrdiff_t& from) { return _mm_set1_epi64x(from); }
+template<> EIGEN_STRONG_INLINE Packet2l plset<std::ptrdiff_t>(const std::ptrdiff_t& a) { return _mm_add_epi64(pset1<Packet2l>(a),_mm_set_epi64x(1,0)); }
+
+template<> EIGEN_STRONG_INLINE Packet2l padd<Packet2l>(const Packet2l& a, const Packet2l& b) { return _mm_add_epi64(a,b); }
+template<> EIGEN_STRONG_INLINE Packet2l psub<Packet2l>(const Packet2l& a, const Packet2l& b) { return _mm_sub_epi64(a,b); }
+template<> EIGEN_STRONG_INLINE Packet2l pnegate(const Packet2l& a) { return _mm_sub_epi64(_mm_setzero_si128(), a); }
+
+template<> EIGEN_STRONG_INLINE Packet2l pmul<Packet2l>(const Packet2l& a, const Packet2l& b)
+{
+  // a*b = lo(a)*lo(b) + ((hi(a)*lo(b) + lo(a)*hi(b)) << 32) modulo 2^64
+  Packet4i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a,32), b), _mm_mul_epu32(a, _mm_srli_epi64(b,32)));
+  return _mm_add_epi64(_mm_mul_epu32(a,b), _mm_slli_epi64(cross,32));
+}
+template<> EIGEN_STRONG_INLINE Packet2l pdiv<Packet2l>(const Packet2l& /*a*/, const Packet2l& /*b*/)
+{ eigen_assert(false && "packet integer division are not supported by SSE");
+  return pset1<Packet2l>(0);
+}
+template<> EIGEN_STRONG_INLINE Packet2l pmadd(const Packet2l& a, const Packet2l& b, const Packet2l& c) { return padd(pmul(a,b), c); }
+
+template<> EIGEN_STRONG_INLINE Packet2l pand<Packet2l>(const Packet2l& a, const Packet2l& b) { return _mm_and_si128(a,b); }
+template<> EIGEN_STRONG_INLINE Packet2l por<Packet2l>(const Packet2l& a, const Packet2l& b) { return _mm_or_si128(a,b); }
+template<> EIGEN_STRONG_INLINE Packet2l pxor<Packet2l>(const Packet2l& a, const Packet2l& b) { return _mm_xor_si128(a,b); }
+template<> EIGEN_STRONG_INLINE Packet2l pandnot<Packet2l>(const Packet2l& a, const Packet2l& b) { return _mm_andnot_si128(a,b); }
+template<> EIGEN_STRONG_INLINE Packet2l ptrue<Packet2l>(const Packet2l& a) { return _mm_cmpeq_epi32(a,a); }
+
+// the sign of each 64 bits coefficient, spread over its 64 bits
+EIGEN_STRONG_INLINE Packet4i psignmask2l(const Packet2l& a) { return vec4i_swizzle1(_mm_srai_epi32(a,31),1,1,3,3); }
+
+template<int N> EIGEN_STRONG_INLINE Packet2l plogical_shift_left(const Packet2l& a) { return _mm_slli_epi64(a,N); }
+template<int N> EIGEN_STRONG_INLINE Packet2l plogical_shift_right(const Packet2l& a) { return _mm_srli_epi64(a,N); }
+template<int N> EIGEN_STRONG_INLINE Packet2l parithmetic_shift_right(const Packet2l& a)
+{
+  // there is no 64 bits arithmetic shift before AVX-512
+  if (N==0) return a;
+  return _mm_or_si128(_mm_srli_epi64(a,N), _mm_slli_epi64(psignmask2l(a),(64-N)%64));
+}
+
+template<> EIGEN_STRONG_INLINE Packet2l pabs(const Packet2l& a)
+{
+  Packet4i aux = psignmask2l(a);
+  return _mm_sub_epi64(_mm_xor_si128(a,aux),aux);
+}
+
+EIGEN_STRONG_INLINE Packet4i pcmpgt2l(const Packet2l& a, const Packet2l& b)
+{
+#ifdef EIGEN_VECTORIZE_SSE4_2
+  return _mm_cmpgt_epi64(a,b);
+#else
+  // when the high halves are equal, the sign of b-a tells whether the low halves compare greater as unsigned
+  Packet4i r = _mm_or_si128(_mm_and_si128(_mm_cmpeq_epi32(a,b), _mm_sub_epi64(b,a)), _mm_cmpgt_epi32(a,b));
+  return vec4i_swizzle1(_mm_srai_epi32(r,31),1,1,3,3);
+#endif
+}
+
+template<> EIGEN_STRONG_INLINE Packet2l pcmp_lt<Packet2l>(const Packet2l& a, const Packet2l& b) { return pcmpgt2l(b,a); }
+template<> EIGEN_STRONG_INLINE Packet2l pcmp_le<Packet2l>(const Packet2l& a, const Packet2l& b) { return _mm_xor_si128(pcmpgt2l(a,b),ptrue(a)); }
+template<> EIGEN_STRONG_INLINE Packet2l pcmp_eq<Packet2l>(const Packet2l& a, const Packet2l& b)
+{
+#ifdef EIGEN_VECTORIZE_SSE4_1
+  return _mm_cmpeq_epi64(a,b);
+#else
+  Packet4i eq = _mm_cmpeq_epi32(a,b);
+  return _mm_and_si128(eq, vec4i_swizzle1(eq,1,0,3,2));
+#endif
+}
+template<> EIGEN_STRONG_INLINE Packet2l pblend<Packet2l>(const Packet2l& mask, const Packet2l& a, const Packet2l& b) { return pblend<Packet4i>(mask,a,b); }
+template<> EIGEN_STRONG_INLINE Packet2l pmin<Packet2l>(const Packet2l& a, const Packet2l& b) { return pblend<Packet4i>(pcmpgt2l(b,a),a,b); }
+template<> EIGEN_STRONG_INLINE Packet2l pmax<Packet2l>(const Packet2l& a, const Packet2l& b) { return pblend<Packet4i>(pcmpgt2l(a,b),a,b); }
+
+template<> EIGEN_STRONG_INLINE bool predux_any<Packet2l>(const Packet2l& a) { return _mm_movemask_pd(_mm_castsi128_pd(a)) != 0; }
+template<> EIGEN_STRONG_INLINE bool predux_all<Packet2l>(const Packet2l& a) { return _mm_movemask_pd(_mm_castsi128_pd(a)) == 0x3; }
+template<> EIGEN_STRONG_INLINE int predux_count<Packet2l>(const Packet2l& a) { return predux_count(_mm_castsi128_pd(a)); }
+
+template<> EIGEN_STRONG_INLINE Packet2l pload<Packet2l>(const std::ptrdiff_t* from) { EIGEN_DEBUG_ALIGNED_LOAD return _mm_load_si128(reinterpret_cast<const __m128i*>(from)); }
+template<> EIGEN_STRONG_INLINE Packet2l ploadu<Packet2l>(const std::ptrdiff_t* from) { EIGEN_DEBUG_UNALIGNED_LOAD return _mm_loadu_si128(reinterpret_cast<const __m128i*>(from)); }
+template<> EIGEN_STRONG_INLINE Packet2l ploaddup<Packet2l>(const std::ptrdiff_t* from) { return pset1<Packet2l>(from[0]); }
+
+template<> EIGEN_STRONG_INLINE void pstore<std::ptrdiff_t>(std::ptrdiff_t* to, const Packet2l& from) { EIGEN_DEBUG_ALIGNED_STORE _mm_store_si128(reinterpret_cast<__m128i*>(to), from); }
+template<> EIGEN_STRONG_INLINE void pstoreu<std::ptrdiff_t>(std::ptrdiff_t* to, const Packet2l& from) { EIGEN_DEBUG_UNALIGNED_STORE _mm_storeu_si128(reinterpret_cast<__m128i*>(to), from); }
+template<> EIGEN_STRONG_INLINE void pstream<std::ptrdiff_t>(std::ptrdiff_t* to, const Packet2l& from) { EIGEN_DEBUG_ALIGNED_STORE _mm_stream_si128(reinterpret_cast<__m128i*>(to), from); }
+template<> EIGEN_STRONG_INLINE void pstreamfence<Packet2l>() { _mm_sfence(); }
+
+template<> EIGEN_STRONG_INLINE std::ptrdiff_t pfirst<Packet2l>(const Packet2l& a) { return _mm_cvtsi128_si64(a); }
+template<> EIGEN_STRONG_INLINE Packet2l preverse(const Packet2l& a) { return _mm_shuffle_epi32(a,0x4E); }
+
+template<> EIGEN_STRONG_INLINE std::ptrdiff_t predux<Packet2l>(const Packet2l& a)
+{
+  return pfirst<Packet2l>(_mm_add_epi64(a, _mm_unpackhi_epi64(a,a)));
+}
+template<> EIGEN_STRONG_INLINE Packet2l preduxp<Packet2l>(const Packet2l* vecs)
+{
+  return _mm_add_epi64(_mm_unpacklo_epi64(vecs[0], vecs[1]), _mm_unpackhi_epi64(vecs[0], vecs[1]));
+}
+template<> EIGEN_STRONG_INLINE std::ptrdiff_t predux_mul<Packet2l>(const Packet2l& a)
+{
+  return pfirst<Packet2l>(a) * pfirst<Packet2l>(_mm_unpackhi_epi64(a,a));
+}
+template<> EIGEN_STRONG_INLINE std::ptrdiff_t predux_min<Packet2l>(const Packet2l& a)
+{
+  std::ptrdiff_t a0 = pfirst<Packet2l>(a), a1 = pfirst<Packet2l>(_mm_unpackhi_epi64(a,a));
+  return a0<a1 ? a0 : a1;
+}
+template<> EIGEN_STRONG_INLINE std::ptrdiff_t predux_max<Packet2l>(const Packet2l& a)
+{
+  std::ptrdiff_t a0 = pfirst<Packet2l>(a), a1 = pfirst<Packet2l>(_mm_unpackhi_epi64(a,a));
+  return a0>a1 ? a0 : a1;
+}
+
+template<int Offset>
+struct palign_impl<Offset,Packet2l>
+{
+  static EIGEN_STRONG_INLINE void run(Packet2l& first, const Packet2l& second)
+  {
+    if (Offset==1)
+      first = _mm_unpacklo_epi64(_mm_unpackhi_epi64(first,first), second);
+  }
+};
+
+#endif // x86_64
+
+#ifdef EIGEN_VECTORIZE_F16C
+
+// Packets of four halves, held in the lower 64 bits of a __m128i. The arithmetic converts them
+// to Packet4f with the F16C instructions and rounds the result back to the nearest halves.
+struct Packet4h
+{
+  EIGEN_STRONG_INLINE Packet4h() {}
+  EIGEN_STRONG_INLINE Packet4h(const __m128i& a) : v(a) {}
+  EIGEN_STRONG_INLINE operator __m128i() const { return v; }
+  __m128i v;
+};
+
+template<> struct is_arithmetic<Packet4h> { enum { value = true }; };
+
+template<> struct packet_traits<half> : default_packet_traits
+{
+  typedef Packet4h type;
+  enum {
+    Vectorizable = 1,
+    AlignedOnScalar = 1,
+    size=4,
+
+    HasDiv    = 1,
+    HasSin  = EIGEN_FAST_MATH,
+    HasCos  = EIGEN_FAST_MATH,
+    HasLog  = 1,
+    HasExp  = 1,
+    HasSqrt = 1
+  };
+};
+
+template<> struct unpacket_traits<Packet4h> { typedef half type; enum {size=4}; };
+
+EIGEN_STRONG_INLINE Packet4f half2float(const Packet4h& a) { return _mm_cvtph_ps(a); }
+EIGEN_STRONG_INLINE Packet4h float2half(const Packet4f& a) { return _mm_cvtps_ph(a, 0); }
+
+template<> EIGEN_STRONG_INLINE Packet4h pset1<Packet4h>(const half& from) { return _mm_set1_epi16(static_cast<short>(from.x)); }
+template<> EIGEN_STRONG_INLINE Packet4h plset<half>(const half& a) { return float2half(plset<float>(float(a))); }
+
+template<> EIGEN_STRONG_INLINE Packet4h padd<Packet4h>(const Packet4h& a, const Packet4h& b) { return float2half(padd(half2float(a),half2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4h psub<Packet4h>(const Packet4h& a, const Packet4h& b) { return float2half(psub(half2float(a),half2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4h pmul<Packet4h>(const Packet4h& a, const Packet4h& b) { return float2half(pmul(half2float(a),half2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4h pdiv<Packet4h>(const Packet4h& a, const Packet4h& b) { return float2half(pdiv(half2float(a),half2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4h pmadd(const Packet4h& a, const Packet4h& b, const Packet4h& c)
+{ return float2half(pmadd(half2float(a),half2float(b),half2float(c))); }
+template<> EIGEN_STRONG_INLINE Packet4h pnegate(const Packet4h& a) { return _mm_xor_si128(a, _mm_set1_epi16(short(0x8000))); }
+template<> EIGEN_STRONG_INLINE Packet4h pconj(const Packet4h& a) { return a; }
+template<> EIGEN_STRONG_INLINE Packet4h pabs(const Packet4h& a) { return _mm_and_si128(a, _mm_set1_epi16(0x7fff)); }
+template<> EIGEN_STRONG_INLINE Packet4h pmin<Packet4h>(const Packet4h& a, const Packet4h& b) { return float2half(pmin(half2float(a),half2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4h pmax<Packet4h>(const Packet4h& a, const Packet4h& b) { return float2half(pmax(half2float(a),half2float(b))); }
+
+template<> EIGEN_STRONG_INLINE Packet4h pload<Packet4h>(const half* from) { EIGEN_DEBUG_ALIGNED_LOAD return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(from)); }
+template<> EIGEN_STRONG_INLINE Packet4h ploadu<Packet4h>(const half* from) { EIGEN_DEBUG_UNALIGNED_LOAD return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(from)); }
+template<> EIGEN_STRONG_INLINE Packet4h ploaddup<Packet4h>(const half* from)
+{ return _mm_set_epi16(0, 0, 0, 0, short(from[1].x), short(from[1].x), short(from[0].x), short(from[0].x)); }
+
+template<> EIGEN_STRONG_INLINE void pstore<half>(half* to, const Packet4h& from) { EIGEN_DEBUG_ALIGNED_STORE _mm_storel_epi64(reinterpret_cast<__m128i*>(to), from); }
+template<> EIGEN_STRONG_INLINE void pstoreu<half>(half* to, const Packet4h& from) { EIGEN_DEBUG_UNALIGNED_STORE _mm_storel_epi64(reinterpret_cast<__m128i*>(to), from); }
+
+template<> EIGEN_STRONG_INLINE half pfirst<Packet4h>(const Packet4h& a) { return half::fromBits(static_cast<unsigned short>(_mm_cvtsi128_si32(a))); }
+template<> EIGEN_STRONG_INLINE Packet4h preverse(const Packet4h& a) { return _mm_shufflelo_epi16(a, 0x1B); }
+
+template<> EIGEN_STRONG_INLINE half predux<Packet4h>(const Packet4h& a) { return half(predux(half2float(a))); }
+template<> EIGEN_STRONG_INLINE half predux_mul<Packet4h>(const Packet4h& a) { return half(predux_mul(half2float(a))); }
+template<> EIGEN_STRONG_INLINE half predux_min<Packet4h>(const Packet4h& a) { return half(predux_min(half2float(a))); }
+template<> EIGEN_STRONG_INLINE half predux_max<Packet4h>(const Packet4h& a) { return half(predux_max(half2float(a))); }
+template<> EIGEN_STRONG_INLINE Packet4h preduxp<Packet4h>(const Packet4h* vecs)
+{
+  Packet4f fvecs[4] = { half2float(vecs[0]), half2float(vecs[1]), half2float(vecs[2]), half2float(vecs[3]) };
+  return float2half(preduxp(fvecs));
+}
+
+template<int Offset>
+struct palign_impl<Offset,Packet4h>
+{
+  static EIGEN_STRONG_INLINE void run(Packet4h& first, const Packet4h& second)
+  {
+    if (Offset!=0)
+      first = _mm_or_si128(_mm_srli_epi64(first, 16*Offset), _mm_slli_epi64(second, 16*(4-Offset)));
+  }
+};
+
+#endif // EIGEN_VECTORIZE_F16C
+
+// Packets of four bfloat16, held in the lower 64 bits of a __m128i. They are widened to Packet4f
+// by a shift, and the float results are rounded to nearest even with integer arithmetic.
+struct Packet4bf
+{
+  EIGEN_STRONG_INLINE Packet4bf() {}
+  EIGEN_STRONG_INLINE Packet4bf(const __m128i& a) : v(a) {}
+  EIGEN_STRONG_INLINE operator __m128i() const { return v; }
+  __m128i v;
+};
+
+template<> struct is_arithmetic<Packet4bf> { enum { value = true }; };
+
+template<> struct packet_traits<bfloat16> : default_packet_traits
+{
+  typedef Packet4bf type;
+  enum {
+    Vectorizable = 1,
+    AlignedOnScalar = 1,
+    size=4,
+
+    HasDiv    = 1,
+    HasSin  = EIGEN_FAST_MATH,
+    HasCos  = EIGEN_FAST_MATH,
+    HasLog  = 1,
+    HasExp  = 1,
+    HasSqrt = 1
+  };
+};
+
+template<> struct unpacket_traits<Packet4bf> { typedef bfloat16 type; enum {size=4}; };
+
+EIGEN_STRONG_INLINE Packet4f bf2float(const Packet4bf& a) { return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), a)); }
+EIGEN_STRONG_INLINE Packet4bf float2bf(const Packet4f& a)
+{
+  const __m128i u = _mm_castps_si128(a);
+  const __m128i lsb = _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(1));
+  __m128i r = _mm_add_epi32(u, _mm_add_epi32(lsb, _mm_set1_epi32(0x7fff)));
+  // NaNs must not be rounded up to infinity, they are made quiet instead
+  const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(a, a));
+  r = _mm_or_si128(_mm_andnot_si128(nan, r), _mm_and_si128(nan, _mm_or_si128(u, _mm_set1_epi32(0x00400000))));
+  // the arithmetic shift keeps the upper halves within the range of the signed saturating pack
+  r = _mm_srai_epi32(r, 16);
+  return _mm_packs_epi32(r, r);
+}
+
+template<> EIGEN_STRONG_INLINE Packet4bf pset1<Packet4bf>(const bfloat16& from) { return _mm_set1_epi16(static_cast<short>(from.x)); }
+template<> EIGEN_STRONG_INLINE Packet4bf plset<bfloat16>(const bfloat16& a) { return float2bf(plset<float>(float(a))); }
+
+template<> EIGEN_STRONG_INLINE Packet4bf padd<Packet4bf>(const Packet4bf& a, const Packet4bf& b) { return float2bf(padd(bf2float(a),bf2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4bf psub<Packet4bf>(const Packet4bf& a, const Packet4bf& b) { return float2bf(psub(bf2float(a),bf2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4bf pmul<Packet4bf>(const Packet4bf& a, const Packet4bf& b) { return float2bf(pmul(bf2float(a),bf2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4bf pdiv<Packet4bf>(const Packet4bf& a, const Packet4bf& b) { return float2bf(pdiv(bf2float(a),bf2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4bf pmadd(const Packet4bf& a, const Packet4bf& b, const Packet4bf& c)
+{ return float2bf(pmadd(bf2float(a),bf2float(b),bf2float(c))); }
+template<> EIGEN_STRONG_INLINE Packet4bf pnegate(const Packet4bf& a) { return _mm_xor_si128(a, _mm_set1_epi16(short(0x8000))); }
+template<> EIGEN_STRONG_INLINE Packet4bf pconj(const Packet4bf& a) { return a; }
+template<> EIGEN_STRONG_INLINE Packet4bf pabs(const Packet4bf& a) { return _mm_and_si128(a, _mm_set1_epi16(0x7fff)); }
+template<> EIGEN_STRONG_INLINE Packet4bf pmin<Packet4bf>(const Packet4bf& a, const Packet4bf& b) { return float2bf(pmin(bf2float(a),bf2float(b))); }
+template<> EIGEN_STRONG_INLINE Packet4bf pmax<Packet4bf>(const Packet4bf& a, const Packet4bf& b) { return float2bf(pmax(bf2float(a),bf2float(b))); }
+
+template<> EIGEN_STRONG_INLINE Packet4bf pload<Packet4bf>(const bfloat16* from) { EIGEN_DEBUG_ALIGNED_LOAD return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(from)); }
+template<> EIGEN_STRONG_INLINE Packet4bf ploadu<Packet4bf>(const bfloat16* from) { EIGEN_DEBUG_UNALIGNED_LOAD return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(from)); }
+template<> EIGEN_STRONG_INLINE Packet4bf ploaddup<Packet4bf>(const bfloat16* from)
+{ return _mm_set_epi16(0, 0, 0, 0, short(from[1].x), short(from[1].x), short(from[0].x), short(from[0].x)); }
+
+template<> EIGEN_STRONG_INLINE void pstore<bfloat16>(bfloat16* to, const Packet4bf& from) { EIGEN_DEBUG_ALIGNED_STORE _mm_storel_epi64(reinterpret_cast<__m128i*>(to), from); }
+template<> EIGEN_STRONG_INLINE void pstoreu<bfloat16>(bfloat16* to, const Packet4bf& from) { EIGEN_DEBUG_UNALIGNED_STORE _mm_storel_epi64(reinterpret_cast<__m128i*>(to), from); }
+
+template<> EIGEN_STRONG_INLINE bfloat16 pfirst<Packet4bf>(const Packet4bf& a) { return bfloat16::fromBits(static_cast<unsigned short>(_mm_cvtsi128_si32(a))); }
+template<> EIGEN_STRONG_INLINE Packet4bf preverse(const Packet4bf& a) { return _mm_shufflelo_epi16(a, 0x1B); }
+
+template<> EIGEN_STRONG_INLINE bfloat16 predux<Packet4bf>(const Packet4bf& a) { return bfloat16(predux(bf2float(a))); }
+template<> EIGEN_STRONG_INLINE bfloat16 predux_mul<Packet4bf>(const Packet4bf& a) { return bfloat16(predux_mul(bf2float(a))); }
+template<> EIGEN_STRONG_INLINE bfloat16 predux_min<Packet4bf>(const Packet4bf& a) { return bfloat16(predux_min(bf2float(a))); }
+template<> EIGEN_STRONG_INLINE bfloat16 predux_max<Packet4bf>(const Packet4bf& a) { return bfloat16(predux_max(bf2float(a))); }
+template<> EIGEN_STRONG_INLINE Packet4bf preduxp<Packet4bf>(const Packet4bf* vecs)
+{
+  Packet4f fvecs[4] = { bf2float(vecs[0]), bf2float(vecs[1]), bf2float(vecs[2]), bf2float(vecs[3]) };
+  return float2bf(preduxp(fvecs));
+}
+
+template<int Offset>
+struct palign_impl<Offset,Packet4bf>
+{
+  static EIGEN_STRONG_INLINE void run(Packet4bf& first, const Packet4bf& second)
+  {
+    if (Offset!=0)
+      first = _mm_or_si128(_mm_srli_epi64(first, 16*Offset), _mm_slli_epi64(second, 16*(4-Offset)));
+  }
+};
+
 } // end namespace internal
 
 } // end namespace Eigen
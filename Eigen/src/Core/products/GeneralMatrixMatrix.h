@@ -16,6 +16,12 @@ namespace internal {
 
 template<typename _LhsScalar, typename _RhsScalar> class level3_blocking;
 
+/** \internal the scalar type of the packed blocks of the operands of a product of \a Scalar,
+  * which are converted to float for the reduced precision types */
+template<typename Scalar> struct gemm_packed_scalar { typedef Scalar type; };
+template<> struct gemm_packed_scalar<half> { typedef float type; };
+template<> struct gemm_packed_scalar<bfloat16> { typedef float type; };
+
 /* Specialization for a row-major destination matrix => simple transposition of the product */
 template<
   typename Index,
@@ -30,7 +36,7 @@ struct general_matrix_matrix_product<Index,LhsScalar,LhsStorageOrder,ConjugateLh
     const RhsScalar* rhs, Index rhsStride,
     ResScalar* res, Index resStride,
     ResScalar alpha,
-    level3_blocking<RhsScalar,LhsScalar>& blocking,
+    level3_blocking<typename gemm_packed_scalar<RhsScalar>::type,typename gemm_packed_scalar<LhsScalar>::type>& blocking,
     GemmParallelInfo<Index>* info = 0)
   {
     // transpose the product such that the result is column major
@@ -373,6 +379,169 @@ class gemm_blocking_space<StorageOrder,_LhsScalar,_RhsScalar,MaxRows, MaxCols, M
     }
 };
 
+/*  Product of reduced precision floating point operands (half, bfloat16) into a col-major destination matrix
+ *    => the blocks of the lhs and the panels of the rhs are converted to float while they are packed,
+ *       and the float kernel accumulates into a float copy of the destination, which is rounded once at the end.
+ *       The blocking space holds float blocks. In a parallel session, each thread converts and packs its own
+ *       columns of the rhs panel into the shared packed panel, so that the rhs is converted only once. */
+template<
+  typename Index, typename Scalar,
+  int LhsStorageOrder, bool ConjugateLhs,
+  int RhsStorageOrder, bool ConjugateRhs>
+struct general_matrix_matrix_product_through_float
+{
+typedef gebp_traits<float,float> Traits;
+typedef Matrix<float,Dynamic,Dynamic> MatrixXf_;
+typedef Map<const Matrix<Scalar,Dynamic,Dynamic,LhsStorageOrder>, 0, OuterStride<> > LhsMap;
+typedef Map<const Matrix<Scalar,Dynamic,Dynamic,RhsStorageOrder>, 0, OuterStride<> > RhsMap;
+typedef Map<Matrix<Scalar,Dynamic,Dynamic>, 0, OuterStride<> > ResMap;
+
+static void run(Index rows, Index cols, Index depth,
+  const Scalar* _lhs, Index lhsStride,
+  const Scalar* _rhs, Index rhsStride,
+  Scalar* _res, Index resStride,
+  Scalar alpha,
+  level3_blocking<float,float>& blocking,
+  GemmParallelInfo<Index>* info = 0)
+{
+  const_blas_data_mapper<Scalar, Index, LhsStorageOrder> lhs(_lhs,lhsStride);
+  const_blas_data_mapper<Scalar, Index, RhsStorageOrder> rhs(_rhs,rhsStride);
+
+  Index kc = blocking.kc();                   // cache block size along the K direction
+  Index mc = (std::min)(rows,blocking.mc());  // cache block size along the M direction
+  // the panels of the rhs are converted by strips of whole micro panels
+  const Index nb = (std::max)(Index(Traits::nr), (mc/Traits::nr)*Traits::nr);
+
+  gemm_pack_lhs<float, Index, Traits::mr, Traits::LhsProgress, ColMajor> pack_lhs;
+  gebp_kernel<float, float, Index, Traits::mr, Traits::nr, ConjugateLhs, ConjugateRhs> gebp;
+
+  std::size_t sizeA = kc*mc;
+  std::size_t sizeB = kc*cols;
+  std::size_t sizeC = kc*(std::max)(mc,nb);
+  std::size_t sizeW = kc*Traits::WorkSpaceFactor;
+
+  ResMap res(_res, rows, cols, OuterStride<>(resStride));
+  MatrixXf_ resf = res.template cast<float>();
+
+#ifdef EIGEN_HAS_OPENMP
+  if(info)
+  {
+    // this is the parallel version, see general_matrix_matrix_product
+    Index tid = omp_get_thread_num();
+    Index threads = omp_get_num_threads();
+
+    ei_declare_aligned_stack_constructed_variable(float, blockA, sizeA, 0);
+    ei_declare_aligned_stack_constructed_variable(float, blockC, sizeC, 0);
+    ei_declare_aligned_stack_constructed_variable(float, blockW, sizeW, 0);
+
+    float* blockB = blocking.blockB();
+    eigen_internal_assert(blockB!=0);
+
+    for(Index k=0; k<depth; k+=kc)
+    {
+      const Index actual_kc = (std::min)(k+kc,depth)-k;
+
+      convert_and_pack_lhs(pack_lhs, blockA, blockC, &lhs(0,k), lhsStride, mc, actual_kc);
+
+      // wait until no other thread uses B'_j, and convert and pack B_k,j to it
+      while(info[tid].users!=0) {}
+      info[tid].users += threads;
+
+      convert_and_pack_rhs(blockB+info[tid].rhs_start*actual_kc, blockC, &rhs(k,info[tid].rhs_start), rhsStride, actual_kc, info[tid].rhs_length, nb);
+
+      info[tid].sync = k;
+
+      for(Index shift=0; shift<threads; ++shift)
+      {
+        Index j = (tid+shift)%threads;
+        if(shift>0)
+          while(info[j].sync!=k) {}
+
+        gebp(resf.data()+info[j].rhs_start*rows, rows, blockA, blockB+info[j].rhs_start*actual_kc,
+             mc, actual_kc, info[j].rhs_length, float(alpha), -1, -1, 0, 0, blockW);
+      }
+
+      for(Index i=mc; i<rows; i+=mc)
+      {
+        const Index actual_mc = (std::min)(i+mc,rows)-i;
+        convert_and_pack_lhs(pack_lhs, blockA, blockC, &lhs(i,k), lhsStride, actual_mc, actual_kc);
+        gebp(resf.data()+i, rows, blockA, blockB, actual_mc, actual_kc, cols, float(alpha), -1, -1, 0, 0, blockW);
+      }
+
+      for(Index j=0; j<threads; ++j)
+        #pragma omp atomic
+        --(info[j].users);
+    }
+  }
+  else
+#endif // EIGEN_HAS_OPENMP
+  {
+    EIGEN_UNUSED_VARIABLE(info);
+
+    ei_declare_aligned_stack_constructed_variable(float, blockA, sizeA, blocking.blockA());
+    ei_declare_aligned_stack_constructed_variable(float, blockB, sizeB, blocking.blockB());
+    ei_declare_aligned_stack_constructed_variable(float, blockC, sizeC, 0);
+    ei_declare_aligned_stack_constructed_variable(float, blockW, sizeW, blocking.blockW());
+
+    for(Index k2=0; k2<depth; k2+=kc)
+    {
+      const Index actual_kc = (std::min)(k2+kc,depth)-k2;
+
+      convert_and_pack_rhs(blockB, blockC, &rhs(k2,0), rhsStride, actual_kc, cols, nb);
+
+      for(Index i2=0; i2<rows; i2+=mc)
+      {
+        const Index actual_mc = (std::min)(i2+mc,rows)-i2;
+        convert_and_pack_lhs(pack_lhs, blockA, blockC, &lhs(i2,k2), lhsStride, actual_mc, actual_kc);
+        gebp(resf.data()+i2, rows, blockA, blockB, actual_mc, actual_kc, cols, float(alpha), -1, -1, 0, 0, blockW);
+      }
+    }
+  }
+
+  res = resf.template cast<Scalar>();
+}
+
+/** \internal converts the \a mc x \a kc block \a lhs of the lhs to float in \a blockC, and packs it into \a blockA */
+template<typename PackLhs>
+static void convert_and_pack_lhs(PackLhs& pack_lhs, float* blockA, float* blockC,
+                                 const Scalar* lhs, Index lhsStride, Index mc, Index kc)
+{
+  Map<MatrixXf_>(blockC, mc, kc) = LhsMap(lhs, mc, kc, OuterStride<>(lhsStride)).template cast<float>();
+  pack_lhs(blockA, blockC, mc, kc, mc);
+}
+
+/** \internal converts the \a kc x \a n panel \a rhs of the rhs to float by strips of \a nb columns in \a blockC,
+  * and packs them into \a blockB */
+static void convert_and_pack_rhs(float* blockB, float* blockC,
+                                 const Scalar* rhs, Index rhsStride, Index kc, Index n, Index nb)
+{
+  const_blas_data_mapper<Scalar, Index, RhsStorageOrder> mapper(rhs,rhsStride);
+  gemm_pack_rhs<float, Index, Traits::nr, ColMajor> pack_rhs;
+  for(Index j2=0; j2<n; j2+=nb)
+  {
+    const Index actual_nb = (std::min)(j2+nb,n)-j2;
+    Map<MatrixXf_>(blockC, kc, actual_nb) = RhsMap(&mapper(0,j2), kc, actual_nb, OuterStride<>(rhsStride)).template cast<float>();
+    pack_rhs(blockB+j2*kc, blockC, kc, kc, actual_nb);
+  }
+}
+};
+
+template<
+  typename Index,
+  int LhsStorageOrder, bool ConjugateLhs,
+  int RhsStorageOrder, bool ConjugateRhs>
+struct general_matrix_matrix_product<Index,half,LhsStorageOrder,ConjugateLhs,half,RhsStorageOrder,ConjugateRhs,ColMajor>
+  : general_matrix_matrix_product_through_float<Index,half,LhsStorageOrder,ConjugateLhs,RhsStorageOrder,ConjugateRhs>
+{};
+
+template<
+  typename Index,
+  int LhsStorageOrder, bool ConjugateLhs,
+  int RhsStorageOrder, bool ConjugateRhs>
+struct general_matrix_matrix_product<Index,bfloat16,LhsStorageOrder,ConjugateLhs,bfloat16,RhsStorageOrder,ConjugateRhs,ColMajor>
+  : general_matrix_matrix_product_through_float<Index,bfloat16,LhsStorageOrder,ConjugateLhs,RhsStorageOrder,ConjugateRhs>
+{};
+
 } // end namespace internal
 
 template<typename Lhs, typename Rhs>
@@ -405,7 +574,8 @@ class GeneralProduct<Lhs, Rhs, GemmProduct>
       Scalar actualAlpha = alpha * LhsBlasTraits::extractScalarFactor(m_lhs)
                                  * RhsBlasTraits::extractScalarFactor(m_rhs);
 
-      typedef internal::gemm_blocking_space<(Dest::Flags&RowMajorBit) ? RowMajor : ColMajor,LhsScalar,RhsScalar,
+      typedef internal::gemm_blocking_space<(Dest::Flags&RowMajorBit) ? RowMajor : ColMajor,
+              typename internal::gemm_packed_scalar<LhsScalar>::type,typename internal::gemm_packed_scalar<RhsScalar>::type,
               Dest::MaxRowsAtCompileTime,Dest::MaxColsAtCompileTime,MaxDepthAtCompileTime> BlockingType;
 
       typedef internal::gemm_functor<
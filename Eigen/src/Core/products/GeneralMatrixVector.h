@@ -545,6 +545,246 @@ EIGEN_DONT_INLINE static void run(
 }
 };
 
+/* Products of reduced precision floating point operands (half, bfloat16):
+ * the result is accumulated in a float copy, which is rounded back once at the end.
+ * When the packets of the operands can be converted to Packet4f, the kernels widen them right after
+ * they are loaded, so that the matrix is read only once at half the bandwidth of a float one.
+ * Otherwise, the matrix is converted to float by blocks of about 8k coefficients for the float kernels.
+ */
+template<typename Index, typename Scalar, int StorageOrder, bool ConjugateLhs, bool ConjugateRhs, int Version,
+         bool Vectorizable = packet_traits<Scalar>::Vectorizable && packet_traits<float>::Vectorizable
+                          && type_casting_traits<Scalar,float>::VectorizedCast
+                          && int(packet_traits<Scalar>::size)==int(packet_traits<float>::size)>
+struct general_matrix_vector_product_through_float;
+
+template<typename Index, typename Scalar, bool ConjugateLhs, bool ConjugateRhs, int Version>
+struct general_matrix_vector_product_through_float<Index,Scalar,ColMajor,ConjugateLhs,ConjugateRhs,Version,false>
+{
+typedef Scalar ResScalar;
+
+EIGEN_DONT_INLINE static void run(
+  Index rows, Index cols,
+  const Scalar* lhs, Index lhsStride,
+  const Scalar* rhs, Index rhsIncr,
+  Scalar* res, Index
+  #ifdef EIGEN_INTERNAL_DEBUGGING
+    resIncr
+  #endif
+  , Scalar alpha)
+{
+  eigen_internal_assert(resIncr==1);
+  typedef Matrix<float,Dynamic,1> VectorXf_;
+  typedef Matrix<Scalar,Dynamic,1> VectorXs_;
+  typedef Matrix<Scalar,Dynamic,Dynamic> MatrixXs_;
+
+  const Index blockCols = (std::max)(Index(1), Index(8192)/(std::max)(rows,Index(1)));
+  ei_declare_aligned_stack_constructed_variable(float, resf, rows, 0);
+  ei_declare_aligned_stack_constructed_variable(float, rhsf, cols, 0);
+  ei_declare_aligned_stack_constructed_variable(float, lhsf, rows*(std::min)(blockCols,cols), 0);
+
+  Map<VectorXf_>(resf, rows) = Map<VectorXs_>(res, rows).template cast<float>();
+  Map<VectorXf_>(rhsf, cols) = float(alpha) * Map<const VectorXs_, 0, InnerStride<> >(rhs, cols, InnerStride<>(rhsIncr)).template cast<float>();
+
+  for(Index j=0; j<cols; j+=blockCols)
+  {
+    const Index actualCols = (std::min)(j+blockCols,cols)-j;
+    Map<Matrix<float,Dynamic,Dynamic> >(lhsf, rows, actualCols)
+      = Map<const MatrixXs_, 0, OuterStride<> >(lhs+j*lhsStride, rows, actualCols, OuterStride<>(lhsStride)).template cast<float>();
+    general_matrix_vector_product<Index,float,ColMajor,ConjugateLhs,float,ConjugateRhs,Version>::run(
+        rows, actualCols, lhsf, rows, rhsf+j, 1, resf, 1, 1.f);
+  }
+
+  Map<VectorXs_>(res, rows) = Map<VectorXf_>(resf, rows).template cast<Scalar>();
+}
+};
+
+template<typename Index, typename Scalar, bool ConjugateLhs, bool ConjugateRhs, int Version>
+struct general_matrix_vector_product_through_float<Index,Scalar,RowMajor,ConjugateLhs,ConjugateRhs,Version,false>
+{
+typedef Scalar ResScalar;
+
+EIGEN_DONT_INLINE static void run(
+  Index rows, Index cols,
+  const Scalar* lhs, Index lhsStride,
+  const Scalar* rhs, Index rhsIncr,
+  Scalar* res, Index resIncr,
+  Scalar alpha)
+{
+  EIGEN_UNUSED_VARIABLE(rhsIncr);
+  eigen_internal_assert(rhsIncr==1);
+  typedef Matrix<float,Dynamic,1> VectorXf_;
+  typedef Matrix<Scalar,Dynamic,1> VectorXs_;
+  typedef Matrix<Scalar,Dynamic,Dynamic,RowMajor> MatrixXs_;
+
+  const Index blockRows = (std::max)(Index(1), Index(8192)/(std::max)(cols,Index(1)));
+  ei_declare_aligned_stack_constructed_variable(float, resf, rows, 0);
+  ei_declare_aligned_stack_constructed_variable(float, rhsf, cols, 0);
+  ei_declare_aligned_stack_constructed_variable(float, lhsf, cols*(std::min)(blockRows,rows), 0);
+
+  Map<VectorXf_>(resf, rows) = Map<const VectorXs_, 0, InnerStride<> >(res, rows, InnerStride<>(resIncr)).template cast<float>();
+  Map<VectorXf_>(rhsf, cols) = Map<const VectorXs_>(rhs, cols).template cast<float>();
+
+  for(Index i=0; i<rows; i+=blockRows)
+  {
+    const Index actualRows = (std::min)(i+blockRows,rows)-i;
+    Map<Matrix<float,Dynamic,Dynamic,RowMajor> >(lhsf, actualRows, cols)
+      = Map<const MatrixXs_, 0, OuterStride<> >(lhs+i*lhsStride, actualRows, cols, OuterStride<>(lhsStride)).template cast<float>();
+    general_matrix_vector_product<Index,float,RowMajor,ConjugateLhs,float,ConjugateRhs,Version>::run(
+        actualRows, cols, lhsf, cols, rhsf, 1, resf+i, 1, float(alpha));
+  }
+
+  Map<VectorXs_, 0, InnerStride<> >(res, rows, InnerStride<>(resIncr)) = Map<VectorXf_>(resf, rows).template cast<Scalar>();
+}
+};
+
+template<typename Index, typename Scalar, bool ConjugateLhs, bool ConjugateRhs, int Version>
+struct general_matrix_vector_product_through_float<Index,Scalar,ColMajor,ConjugateLhs,ConjugateRhs,Version,true>
+{
+typedef Scalar ResScalar;
+typedef typename packet_traits<Scalar>::type Packet;
+typedef typename packet_traits<float>::type FloatPacket;
+enum { PacketSize = packet_traits<float>::size };
+
+static EIGEN_STRONG_INLINE FloatPacket load(const Scalar* from)
+{ return pcast<Packet,FloatPacket>(ploadu<Packet>(from)); }
+
+EIGEN_DONT_INLINE static void run(
+  Index rows, Index cols,
+  const Scalar* lhs, Index lhsStride,
+  const Scalar* rhs, Index rhsIncr,
+  Scalar* res, Index
+  #ifdef EIGEN_INTERNAL_DEBUGGING
+    resIncr
+  #endif
+  , Scalar alpha)
+{
+  eigen_internal_assert(resIncr==1);
+  typedef Matrix<float,Dynamic,1> VectorXf_;
+  typedef Matrix<Scalar,Dynamic,1> VectorXs_;
+
+  ei_declare_aligned_stack_constructed_variable(float, resf, rows, 0);
+  ei_declare_aligned_stack_constructed_variable(float, rhsf, cols, 0);
+  Map<VectorXf_,Aligned>(resf, rows) = Map<VectorXs_>(res, rows).template cast<float>();
+  Map<VectorXf_>(rhsf, cols) = float(alpha) * Map<const VectorXs_, 0, InnerStride<> >(rhs, cols, InnerStride<>(rhsIncr)).template cast<float>();
+
+  const Index peeledRows = (rows/PacketSize)*PacketSize;
+  const Index peeledCols = (cols/4)*4;
+  // four columns at once, which reduces the load/stores of the result by a factor 4
+  for(Index j=0; j<peeledCols; j+=4)
+  {
+    const Scalar *lhs0 = lhs + j*lhsStride, *lhs1 = lhs0 + lhsStride, *lhs2 = lhs1 + lhsStride, *lhs3 = lhs2 + lhsStride;
+    const FloatPacket b0 = pset1<FloatPacket>(rhsf[j]),   b1 = pset1<FloatPacket>(rhsf[j+1]),
+                      b2 = pset1<FloatPacket>(rhsf[j+2]), b3 = pset1<FloatPacket>(rhsf[j+3]);
+    for(Index i=0; i<peeledRows; i+=PacketSize)
+      pstore(&resf[i], padd(pload<FloatPacket>(&resf[i]),
+                            padd(pmadd(load(&lhs0[i]), b0, pmul(load(&lhs1[i]), b1)),
+                                 pmadd(load(&lhs2[i]), b2, pmul(load(&lhs3[i]), b3)))));
+    for(Index i=peeledRows; i<rows; ++i)
+      resf[i] += float(lhs0[i])*rhsf[j] + float(lhs1[i])*rhsf[j+1] + float(lhs2[i])*rhsf[j+2] + float(lhs3[i])*rhsf[j+3];
+  }
+  for(Index j=peeledCols; j<cols; ++j)
+  {
+    const Scalar *lhs0 = lhs + j*lhsStride;
+    const FloatPacket b0 = pset1<FloatPacket>(rhsf[j]);
+    for(Index i=0; i<peeledRows; i+=PacketSize)
+      pstore(&resf[i], pmadd(load(&lhs0[i]), b0, pload<FloatPacket>(&resf[i])));
+    for(Index i=peeledRows; i<rows; ++i)
+      resf[i] += float(lhs0[i])*rhsf[j];
+  }
+
+  Map<VectorXs_>(res, rows) = Map<VectorXf_,Aligned>(resf, rows).template cast<Scalar>();
+}
+};
+
+template<typename Index, typename Scalar, bool ConjugateLhs, bool ConjugateRhs, int Version>
+struct general_matrix_vector_product_through_float<Index,Scalar,RowMajor,ConjugateLhs,ConjugateRhs,Version,true>
+{
+typedef Scalar ResScalar;
+typedef typename packet_traits<Scalar>::type Packet;
+typedef typename packet_traits<float>::type FloatPacket;
+enum { PacketSize = packet_traits<float>::size };
+
+static EIGEN_STRONG_INLINE FloatPacket load(const Scalar* from)
+{ return pcast<Packet,FloatPacket>(ploadu<Packet>(from)); }
+
+EIGEN_DONT_INLINE static void run(
+  Index rows, Index cols,
+  const Scalar* lhs, Index lhsStride,
+  const Scalar* rhs, Index rhsIncr,
+  Scalar* res, Index resIncr,
+  Scalar alpha)
+{
+  EIGEN_UNUSED_VARIABLE(rhsIncr);
+  eigen_internal_assert(rhsIncr==1);
+  typedef Matrix<float,Dynamic,1> VectorXf_;
+  typedef Matrix<Scalar,Dynamic,1> VectorXs_;
+
+  ei_declare_aligned_stack_constructed_variable(float, rhsf, cols, 0);
+  Map<VectorXf_,Aligned>(rhsf, cols) = Map<const VectorXs_>(rhs, cols).template cast<float>();
+  const float falpha = float(alpha);
+
+  const Index peeledCols = (cols/PacketSize)*PacketSize;
+  const Index peeledRows = (rows/4)*4;
+  // four rows at once, which share the loads of the rhs
+  for(Index i=0; i<peeledRows; i+=4)
+  {
+    const Scalar *lhs0 = lhs + i*lhsStride, *lhs1 = lhs0 + lhsStride, *lhs2 = lhs1 + lhsStride, *lhs3 = lhs2 + lhsStride;
+    FloatPacket ptmp0 = pset1<FloatPacket>(0.f), ptmp1 = ptmp0, ptmp2 = ptmp0, ptmp3 = ptmp0;
+    for(Index j=0; j<peeledCols; j+=PacketSize)
+    {
+      const FloatPacket b = pload<FloatPacket>(&rhsf[j]);
+      ptmp0 = pmadd(load(&lhs0[j]), b, ptmp0);
+      ptmp1 = pmadd(load(&lhs1[j]), b, ptmp1);
+      ptmp2 = pmadd(load(&lhs2[j]), b, ptmp2);
+      ptmp3 = pmadd(load(&lhs3[j]), b, ptmp3);
+    }
+    float tmp0 = predux(ptmp0), tmp1 = predux(ptmp1), tmp2 = predux(ptmp2), tmp3 = predux(ptmp3);
+    for(Index j=peeledCols; j<cols; ++j)
+    {
+      tmp0 += float(lhs0[j])*rhsf[j];
+      tmp1 += float(lhs1[j])*rhsf[j];
+      tmp2 += float(lhs2[j])*rhsf[j];
+      tmp3 += float(lhs3[j])*rhsf[j];
+    }
+    res[i*resIncr]     = Scalar(float(res[i*resIncr])     + falpha*tmp0);
+    res[(i+1)*resIncr] = Scalar(float(res[(i+1)*resIncr]) + falpha*tmp1);
+    res[(i+2)*resIncr] = Scalar(float(res[(i+2)*resIncr]) + falpha*tmp2);
+    res[(i+3)*resIncr] = Scalar(float(res[(i+3)*resIncr]) + falpha*tmp3);
+  }
+  for(Index i=peeledRows; i<rows; ++i)
+  {
+    const Scalar *lhs0 = lhs + i*lhsStride;
+    FloatPacket ptmp0 = pset1<FloatPacket>(0.f);
+    for(Index j=0; j<peeledCols; j+=PacketSize)
+      ptmp0 = pmadd(load(&lhs0[j]), pload<FloatPacket>(&rhsf[j]), ptmp0);
+    float tmp0 = predux(ptmp0);
+    for(Index j=peeledCols; j<cols; ++j)
+      tmp0 += float(lhs0[j])*rhsf[j];
+    res[i*resIncr] = Scalar(float(res[i*resIncr]) + falpha*tmp0);
+  }
+}
+};
+
+template<typename Index, bool ConjugateLhs, bool ConjugateRhs, int Version>
+struct general_matrix_vector_product<Index,half,ColMajor,ConjugateLhs,half,ConjugateRhs,Version>
+  : general_matrix_vector_product_through_float<Index,half,ColMajor,ConjugateLhs,ConjugateRhs,Version>
+{};
+
+template<typename Index, bool ConjugateLhs, bool ConjugateRhs, int Version>
+struct general_matrix_vector_product<Index,half,RowMajor,ConjugateLhs,half,ConjugateRhs,Version>
+  : general_matrix_vector_product_through_float<Index,half,RowMajor,ConjugateLhs,ConjugateRhs,Version>
+{};
+
+template<typename Index, bool ConjugateLhs, bool ConjugateRhs, int Version>
+struct general_matrix_vector_product<Index,bfloat16,ColMajor,ConjugateLhs,bfloat16,ConjugateRhs,Version>
+  : general_matrix_vector_product_through_float<Index,bfloat16,ColMajor,ConjugateLhs,ConjugateRhs,Version>
+{};
+
+template<typename Index, bool ConjugateLhs, bool ConjugateRhs, int Version>
+struct general_matrix_vector_product<Index,bfloat16,RowMajor,ConjugateLhs,bfloat16,ConjugateRhs,Version>
+  : general_matrix_vector_product_through_float<Index,bfloat16,RowMajor,ConjugateLhs,ConjugateRhs,Version>
+{};
+
 } // end namespace internal
 
 } // end namespace Eigen
@@ -143,10 +143,20 @@ const unsigned int AlignedBit = 0x80;
 
 const unsigned int NestByRefBit = 0x100;
 
+/** \internal
+  *
+  * means the coefficients of the expression have to be computed in order by a single thread, because it nests a
+  * functor which is not parallel safe, like the sequential LinSpaced or a user functor which does not opt in.
+  * Unlike the other hereditary bits,
+  * it is set as soon as one of the nested expressions has it.
+  * \sa functor_is_parallel_safe */
+const unsigned int ParallelUnsafeBit = 0x200;
+
 // list of flags that are inherited by default
 const unsigned int HereditaryBits = RowMajorBit
                                   | EvalBeforeNestingBit
-                                  | EvalBeforeAssigningBit;
+                                  | EvalBeforeAssigningBit
+                                  | ParallelUnsafeBit;
 
 /** \defgroup enums Enumerations
   * \ingroup Core_Module
@@ -186,7 +196,9 @@ enum {
   /** Object is not correctly aligned for vectorization. */
   Unaligned=0, 
   /** Object is aligned for vectorization. */
-  Aligned=1 
+  Aligned=1,
+  /** \internal Object is aligned for vectorization, and is written with non-temporal stores bypassing the caches. */
+  AlignedStreaming=2
 };
 
 /** \ingroup enums
@@ -260,7 +272,11 @@ enum {
   /** \internal Align the matrix itself if it is vectorizable fixed-size */
   AutoAlign = 0,
   /** \internal Don't require alignment for the matrix itself (the array of coefficients, if dynamically allocated, may still be requested to be aligned) */ // FIXME --- clarify the situation
-  DontAlign = 0x2
+  DontAlign = 0x2,
+  /** Pad the leading dimension of a dynamic-size matrix, so that each column (or row if row major) is aligned and
+    * consecutive columns do not map to the same cache sets. The coefficients are then no longer contiguous in memory,
+    * and outerStride() returns the padded leading dimension. Only allowed for fully dynamic matrices. */
+  PaddedOuterStride = 0x4
 };
 
 /** \ingroup enums
@@ -413,6 +429,17 @@ namespace Architecture
   * Enum used as template parameter in GeneralProduct. */
 enum { CoeffBasedProductMode, LazyCoeffBasedProductMode, OuterProduct, InnerProduct, GemvProduct, GemmProduct };
 
+/** \ingroup enums
+  * Flags selecting how large heap blocks are allocated, see setLargeAllocationPolicy(). */
+enum LargeAllocationPolicy {
+  /** Large blocks are allocated like any other block. */
+  DefaultAllocation = 0x0,
+  /** Large blocks are aligned on huge page boundaries and advised for transparent huge pages (Linux only). */
+  HugePageAllocation = 0x1,
+  /** Large dynamic-size matrices are first touched by the threads which compute their rows in matrix products (OpenMP only). */
+  ParallelFirstTouch = 0x2
+};
+
 /** \internal \ingroup enums
   * Enum used in experimental parallel implementation. */
 enum Action {GetAction, SetAction};
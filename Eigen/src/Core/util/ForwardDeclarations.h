@@ -173,15 +173,21 @@ template<typename Scalar> struct scalar_pow_op;
 template<typename Scalar> struct scalar_inverse_op;
 template<typename Scalar> struct scalar_square_op;
 template<typename Scalar> struct scalar_cube_op;
+template<typename Scalar, int N> struct scalar_shift_left_op;
+template<typename Scalar, int N> struct scalar_shift_right_op;
 template<typename Scalar, typename NewType> struct scalar_cast_op;
 template<typename Scalar> struct scalar_multiple_op;
 template<typename Scalar> struct scalar_quotient1_op;
 template<typename Scalar> struct scalar_min_op;
 template<typename Scalar> struct scalar_max_op;
 template<typename Scalar> struct scalar_random_op;
+template<typename Scalar> struct scalar_normal_random_op;
 template<typename Scalar> struct scalar_add_op;
 template<typename Scalar> struct scalar_constant_op;
 template<typename Scalar> struct scalar_identity_op;
+template<typename Scalar> struct scalar_bitwise_and_op;
+template<typename Scalar> struct scalar_bitwise_or_op;
+template<typename Scalar> struct scalar_bitwise_xor_op;
 
 template<typename LhsScalar,typename RhsScalar=LhsScalar> struct scalar_product_op;
 template<typename LhsScalar,typename RhsScalar> struct scalar_multiple2_op;
@@ -223,8 +229,10 @@ template<typename MatrixType> class HouseholderQR;
 template<typename MatrixType> class ColPivHouseholderQR;
 template<typename MatrixType> class FullPivHouseholderQR;
 template<typename MatrixType, int QRPreconditioner = ColPivHouseholderQRPreconditioner> class JacobiSVD;
+template<typename MatrixType> class BDCSVD;
 template<typename MatrixType, int UpLo = Lower> class LLT;
 template<typename MatrixType, int UpLo = Lower> class LDLT;
+template<typename MatrixType, int UpLo = Lower> class BunchKaufman;
 template<typename VectorsType, typename CoeffsType, int Side=OnTheLeft> class HouseholderSequence;
 template<typename Scalar>     class JacobiRotation;
 
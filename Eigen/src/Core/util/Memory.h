@@ -65,6 +65,26 @@
   #define EIGEN_HAS_MM_MALLOC 0
 #endif
 
+// Huge page backed allocations require madvise(MADV_HUGEPAGE), and a posix_memalign
+// whose result can be released by the same std::free that aligned_free calls.
+#if defined(__linux__) && defined(__GLIBC__) && defined(MADV_HUGEPAGE) && !defined(EIGEN_DONT_USE_HUGE_PAGES) \
+ && ((!EIGEN_ALIGN) || EIGEN_MALLOC_ALREADY_ALIGNED || EIGEN_HAS_POSIX_MEMALIGN)
+  #define EIGEN_HAS_MADV_HUGEPAGE 1
+#else
+  #define EIGEN_HAS_MADV_HUGEPAGE 0
+#endif
+
+// Blocks of at least this many bytes are subject to the policy set by setLargeAllocationPolicy()
+#ifndef EIGEN_LARGE_ALLOCATION_THRESHOLD
+  #define EIGEN_LARGE_ALLOCATION_THRESHOLD (32*1024*1024)
+#endif
+
+#ifndef EIGEN_DEFAULT_LARGE_ALLOCATION_POLICY
+  #define EIGEN_DEFAULT_LARGE_ALLOCATION_POLICY DefaultAllocation
+#endif
+
+#define EIGEN_HUGE_PAGE_SIZE (2*1024*1024)
+
 namespace Eigen {
 
 namespace internal {
@@ -193,14 +213,124 @@ inline void check_that_malloc_is_allowed()
 {}
 #endif
 
+/*****************************************************************************
+*** Allocation policy of large blocks                                      ***
+*****************************************************************************/
+
+/** \internal Gets or sets the LargeAllocationPolicy flags and the size threshold (in bytes) above which they apply. */
+inline void manage_large_allocations(Action action, int* policy, std::ptrdiff_t* threshold)
+{
+  static int m_policy = EIGEN_DEFAULT_LARGE_ALLOCATION_POLICY;
+  static std::ptrdiff_t m_threshold = EIGEN_LARGE_ALLOCATION_THRESHOLD;
+
+  if(action==SetAction)
+  {
+    eigen_internal_assert(policy!=0 && threshold!=0);
+    m_policy = *policy;
+    m_threshold = *threshold;
+  }
+  else if(action==GetAction)
+  {
+    eigen_internal_assert(policy!=0 && threshold!=0);
+    *policy = m_policy;
+    *threshold = m_threshold;
+  }
+  else
+  {
+    eigen_internal_assert(false);
+  }
+}
+
+/** \internal \returns the subset of the LargeAllocationPolicy flags which applies to a block of \a size bytes */
+inline int large_allocation_policy(size_t size)
+{
+  int policy;
+  std::ptrdiff_t threshold;
+  manage_large_allocations(GetAction, &policy, &threshold);
+  return (size>0 && std::ptrdiff_t(size)>=threshold) ? policy : int(DefaultAllocation);
+}
+
+/** \internal Advises the kernel to back the huge page aligned part of [ptr, ptr+size) with transparent huge pages.
+  * This is only a hint: the call is silently ignored if huge pages are not available. */
+inline void advise_huge_pages(void* ptr, size_t size)
+{
+  #if EIGEN_HAS_MADV_HUGEPAGE
+    std::size_t begin = (reinterpret_cast<std::size_t>(ptr) + EIGEN_HUGE_PAGE_SIZE-1) & ~std::size_t(EIGEN_HUGE_PAGE_SIZE-1);
+    std::size_t end   = (reinterpret_cast<std::size_t>(ptr) + size) & ~std::size_t(EIGEN_HUGE_PAGE_SIZE-1);
+    if(end>begin)
+      madvise(reinterpret_cast<void*>(begin), end-begin, MADV_HUGEPAGE);
+  #else
+    EIGEN_UNUSED_VARIABLE(ptr);
+    EIGEN_UNUSED_VARIABLE(size);
+  #endif
+}
+
+/** \internal Allocates \a size bytes aligned on a huge page boundary and advised for transparent huge pages.
+  * The returned block can be released with aligned_free. Returns 0 on failure or if huge pages are not supported.
+  */
+inline void* huge_page_aligned_malloc(size_t size)
+{
+  #if EIGEN_HAS_MADV_HUGEPAGE
+    void *result;
+    if(posix_memalign(&result, EIGEN_HUGE_PAGE_SIZE, size)) return 0;
+    advise_huge_pages(result, size);
+    return result;
+  #else
+    EIGEN_UNUSED_VARIABLE(size);
+    return 0;
+  #endif
+}
+
+inline void manage_multi_threading(Action action, int* v);
+
+/** \internal Writes zeros to the \a innerSize x \a outerSize array of coefficients of \a scalarSize bytes at \a ptr
+  * from the threads parallelize_gemm would use for a product into a matrix of this shape. Like parallelize_gemm, the
+  * inner indices, i.e., the rows of a column-major matrix, are split into one block per thread, and each thread writes
+  * its block in every outer slice. With a first-touch NUMA policy, the rows of the result and of the lhs of a product
+  * are thus placed on the memory node of the thread which computes them. Does nothing outside of OpenMP or from
+  * within a parallel region.
+  */
+inline void parallel_first_touch(void* ptr, size_t scalarSize, std::ptrdiff_t innerSize, std::ptrdiff_t outerSize)
+{
+  #ifdef EIGEN_HAS_OPENMP
+    int threads;
+    manage_multi_threading(GetAction, &threads);
+    // the number of threads and the blocks of rows of parallelize_gemm
+    threads = int((std::min)(std::ptrdiff_t(threads), (std::max)(std::ptrdiff_t(1), innerSize/32)));
+    if(threads<=1 || omp_get_num_threads()>1)
+      return;
+    const std::ptrdiff_t blockInner = (innerSize/threads) & ~std::ptrdiff_t(0x7);
+    char* data = static_cast<char*>(ptr);
+    #pragma omp parallel for schedule(static,1) num_threads(threads)
+    for(int i=0; i<threads; ++i)
+    {
+      const std::ptrdiff_t start = i*blockInner;
+      const std::ptrdiff_t length = (i+1==threads) ? innerSize-start : blockInner;
+      for(std::ptrdiff_t j=0; j<outerSize; ++j)
+        std::memset(data + (j*innerSize+start)*scalarSize, 0, length*scalarSize);
+    }
+  #else
+    EIGEN_UNUSED_VARIABLE(ptr);
+    EIGEN_UNUSED_VARIABLE(scalarSize);
+    EIGEN_UNUSED_VARIABLE(innerSize);
+    EIGEN_UNUSED_VARIABLE(outerSize);
+  #endif
+}
+
 /** \internal Allocates \a size bytes. The returned pointer is guaranteed to have 16 bytes alignment.
+  * Blocks larger than the threshold set by setLargeAllocationPolicy() are allocated according to that policy.
   * On allocation error, the returned pointer is null, and std::bad_alloc is thrown.
   */
 inline void* aligned_malloc(size_t size)
 {
   check_that_malloc_is_allowed();
 
-  void *result;
+  void *result = 0;
+  if(large_allocation_policy(size) & HugePageAllocation)
+    result = huge_page_aligned_malloc(size);
+
+  if(!result)
+  {
   #if !EIGEN_ALIGN
     result = std::malloc(size);
   #elif EIGEN_MALLOC_ALREADY_ALIGNED
@@ -209,11 +339,12 @@ inline void* aligned_malloc(size_t size)
     if(posix_memalign(&result, 16, size)) result = 0;
   #elif EIGEN_HAS_MM_MALLOC
     result = _mm_malloc(size, 16);
-#elif defined(_MSC_VER) && (!defined(_WIN32_WCE))
+  #elif defined(_MSC_VER) && (!defined(_WIN32_WCE))
     result = _aligned_malloc(size, 16);
   #else
     result = handmade_aligned_malloc(size);
   #endif
+  }
 
   if(!result && size)
     throw_std_bad_alloc();
@@ -246,9 +377,20 @@ inline void aligned_free(void *ptr)
 **/
 inline void* aligned_realloc(void *ptr, size_t new_size, size_t old_size)
 {
-  EIGEN_UNUSED_VARIABLE(old_size);
-
   void *result;
+  if(large_allocation_policy(new_size) & HugePageAllocation)
+  {
+    // a plain realloc would not keep the block aligned on a huge page boundary
+    result = huge_page_aligned_malloc(new_size);
+    if(result)
+    {
+      if(ptr)
+        std::memcpy(result, ptr, (std::min)(new_size, old_size));
+      aligned_free(ptr);
+      return result;
+    }
+  }
+
 #if !EIGEN_ALIGN
   result = std::realloc(ptr,new_size);
 #elif EIGEN_MALLOC_ALREADY_ALIGNED
@@ -273,6 +415,9 @@ inline void* aligned_realloc(void *ptr, size_t new_size, size_t old_size)
   if (!result && new_size)
     throw_std_bad_alloc();
 
+  if(large_allocation_policy(new_size) & HugePageAllocation)
+    advise_huge_pages(result, new_size);
+
   return result;
 }
 
@@ -542,6 +687,45 @@ template<typename T> class aligned_stack_memory_handler
 
 } // end namespace internal
 
+/** Sets how heap blocks of at least \a threshold bytes are allocated by %Eigen.
+  * \param policy a combination of the LargeAllocationPolicy flags:
+  *   - HugePageAllocation aligns the blocks on huge page boundaries and advises the kernel to back them with
+  *     transparent huge pages, which reduces TLB misses on multi-gigabyte matrices (Linux only);
+  *   - ParallelFirstTouch zero-fills the coefficients of a new dynamic-size matrix from the threads used by matrix
+  *     products, each thread writing the block of rows it computes in a product, so that on NUMA machines these rows
+  *     are placed on its memory node rather than on the node of the allocating thread (OpenMP only). Scalar types
+  *     which require initialization are not touched.
+  * \param threshold the size in bytes above which the policy applies
+  *
+  * The default policy is DefaultAllocation with a threshold of 32MB. They can be changed at compile time with the
+  * EIGEN_DEFAULT_LARGE_ALLOCATION_POLICY and EIGEN_LARGE_ALLOCATION_THRESHOLD preprocessor tokens.
+  * Note that ParallelFirstTouch adds a parallel pass over the memory of each new large block.
+  * \sa largeAllocationPolicy(), largeAllocationThreshold() */
+inline void setLargeAllocationPolicy(int policy, std::ptrdiff_t threshold = EIGEN_LARGE_ALLOCATION_THRESHOLD)
+{
+  internal::manage_large_allocations(SetAction, &policy, &threshold);
+}
+
+/** \returns the current LargeAllocationPolicy flags
+  * \sa setLargeAllocationPolicy() */
+inline int largeAllocationPolicy()
+{
+  int policy;
+  std::ptrdiff_t threshold;
+  internal::manage_large_allocations(GetAction, &policy, &threshold);
+  return policy;
+}
+
+/** \returns the size in bytes above which the large allocation policy applies
+  * \sa setLargeAllocationPolicy() */
+inline std::ptrdiff_t largeAllocationThreshold()
+{
+  int policy;
+  std::ptrdiff_t threshold;
+  internal::manage_large_allocations(GetAction, &policy, &threshold);
+  return threshold;
+}
+
 /** \internal
   * Declares, allocates and construct an aligned buffer named NAME of SIZE elements of type TYPE on the stack
   * if SIZE is smaller than EIGEN_STACK_ALLOCATION_LIMIT, and if stack allocation is supported by the platform
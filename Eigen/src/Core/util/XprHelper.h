@@ -129,11 +129,12 @@ class compute_matrix_flags
 
           )
       ) ? AlignedBit : 0,
-      packet_access_bit = packet_traits<Scalar>::Vectorizable && aligned_bit ? PacketAccessBit : 0
+      packet_access_bit = packet_traits<Scalar>::Vectorizable && aligned_bit ? PacketAccessBit : 0,
+      linear_access_bit = (Options&PaddedOuterStride) ? 0 : LinearAccessBit
     };
 
   public:
-    enum { ret = LinearAccessBit | LvalueBit | DirectAccessBit | NestByRefBit | packet_access_bit | row_major_bit | aligned_bit };
+    enum { ret = linear_access_bit | LvalueBit | DirectAccessBit | NestByRefBit | packet_access_bit | row_major_bit | aligned_bit };
 };
 
 template<int _Rows, int _Cols> struct size_at_compile_time
@@ -433,6 +434,24 @@ struct plain_diag_type
   >::type type;
 };
 
+/** \internal Computes packets of masks, as returned by pcmp_lt(), from the boolean expression \a XprType,
+  * the operands of which are of type \a Scalar. PacketAccess is true if \a XprType is a vectorizable
+  * comparison, in which case packet<LoadMode>(xpr,row,col) and packet<LoadMode>(xpr,index) return the masks.
+  */
+template<typename XprType, typename Scalar>
+struct cwise_mask
+{
+  enum { PacketAccess = false };
+};
+
+/** \internal \returns in \c type the scalar type of the operands of the comparison \a XprType, or the
+  * scalar type of \a XprType itself if it is not a vectorizable comparison. */
+template<typename XprType>
+struct cwise_mask_scalar
+{
+  typedef typename traits<XprType>::Scalar type;
+};
+
 template<typename ExpressionType>
 struct is_lvalue
 {
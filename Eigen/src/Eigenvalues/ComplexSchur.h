@@ -172,7 +172,8 @@ template<typename _MatrixType> class ComplexSchur
       * matrix to Hessenberg form using the class
       * HessenbergDecomposition. The Hessenberg matrix is then reduced
       * to triangular form by performing QR iterations with a single
-      * shift. The cost of computing the Schur decomposition depends
+      * shift, or multishift QR sweeps on large blocks as explained in
+      * computeFromHessenberg(). The cost of computing the Schur decomposition depends
       * on the number of iterations; as a rough guide, it may be taken
       * on the number of iterations; as a rough guide, it may be taken
       * to be \f$25n^3\f$ complex flops, or \f$10n^3\f$ complex flops
@@ -183,6 +184,32 @@ template<typename _MatrixType> class ComplexSchur
       */
     ComplexSchur& compute(const MatrixType& matrix, bool computeU = true);
 
+    /** \brief Computes Schur decomposition of a Hessenberg matrix H = Z T Z^H
+      *
+      * \param[in] matrixH Matrix in Hessenberg form H
+      * \param[in] matrixQ unitary matrix Q that transform a matrix A to H : A = Q H Q^H
+      * \param[in] computeU Computes the matriX U of the Schur vectors
+      * \returns Reference to \c *this
+      *
+      * This routine assumes that the matrix is already reduced in Hessenberg form matrixH
+      * using either the class HessenbergDecomposition or another mean.
+      * It computes the upper triangular matrix T of the Schur decomposition of H.
+      * When computeU is true, this routine computes the matrix U such that
+      * A = U T U^H =  (QZ) T (QZ)^H = Q H Q^H where A is the initial matrix.
+      *
+      * NOTE Q is referenced if computeU is true; so, if the initial unitary matrix
+      * is not available, the user should give an identity matrix (Q.setIdentity())
+      *
+      * Active blocks of at least EIGEN_COMPLEXSCHUR_MULTISHIFT_THRESHOLD rows are reduced by multishift QR
+      * sweeps with aggressive early deflation, as in LAPACK's xHSEQR: the eigenvalues of a window at the
+      * bottom of the block which have converged are deflated, the others are used as shifts of a chain of
+      * small bulges, and the transformations are accumulated such that they are applied by matrix products.
+      *
+      * \sa compute(const MatrixType&, bool)
+      */
+    template<typename HessMatrixType, typename OrthMatrixType>
+    ComplexSchur& computeFromHessenberg(const MatrixBase<HessMatrixType>& matrixH, const MatrixBase<OrthMatrixType>& matrixQ, bool computeU);
+
     /** \brief Reports whether previous computation was successful.
       *
       * \returns \c Success if computation was succesful, \c NoConvergence otherwise.
@@ -207,9 +234,22 @@ template<typename _MatrixType> class ComplexSchur
     bool m_matUisUptodate;
 
   private:  
+    typedef Matrix<ComplexScalar,Dynamic,Dynamic> ComplexWorkMatrixType;
+    typedef Matrix<ComplexScalar,Dynamic,2> ShiftsType;
+
     bool subdiagonalEntryIsNeglegible(Index i);
     ComplexScalar computeShift(Index iu, Index iter);
     void reduceToTriangularForm(bool computeU);
+    Index aggressiveEarlyDeflation(Index il, Index iu, Index nw, bool computeU, Index maxShifts, ShiftsType& shifts);
+    void performMultishiftQRSweep(Index il, Index iu, bool computeU, const ShiftsType& shifts);
+    Matrix<ComplexScalar,3,1> computeBulgeStart(Index g, const ShiftsType& shifts, Index b);
+    void deflateDuringSweep(Index k, RealScalar smlnum);
+    template<typename VectorType, typename EssentialPart>
+    static void makeScaledHouseholder(const VectorType& v, EssentialPart& ess, ComplexScalar& tau, RealScalar& beta);
+    template<typename EssentialPart>
+    void applyBulgeReflector(Index g, Index ws, Index we, Index iu, const EssentialPart& ess, const ComplexScalar& tau,
+                             ComplexWorkMatrixType& U, ComplexScalar* workspace);
+    static void swapDiagonalEntries(ComplexWorkMatrixType& T, ComplexWorkMatrixType& V, Index j);
     friend struct internal::complex_schur_reduce_to_hessenberg<MatrixType, NumTraits<Scalar>::IsComplex>;
 };
 
@@ -288,6 +328,20 @@ ComplexSchur<MatrixType>& ComplexSchur<MatrixType>::compute(const MatrixType& ma
   return *this;
 }
 
+template<typename MatrixType>
+template<typename HessMatrixType, typename OrthMatrixType>
+ComplexSchur<MatrixType>& ComplexSchur<MatrixType>::computeFromHessenberg(const MatrixBase<HessMatrixType>& matrixH,
+                                                                          const MatrixBase<OrthMatrixType>& matrixQ, bool computeU)
+{
+  m_matUisUptodate = false;
+  eigen_assert(matrixH.cols() == matrixH.rows());
+  m_matT = matrixH.template cast<ComplexScalar>();
+  if(computeU)
+    m_matU = matrixQ.template cast<ComplexScalar>();
+  reduceToTriangularForm(computeU);
+  return *this;
+}
+
 namespace internal {
 
 /* Reduce given matrix to Hessenberg form */
@@ -363,6 +417,42 @@ void ComplexSchur<MatrixType>::reduceToTriangularForm(bool computeU)
       --il;
     }
 
+    if(iu-il+1 >= EIGEN_COMPLEXSCHUR_MULTISHIFT_THRESHOLD)
+    {
+      // number of shifts and size of the deflation window, from LAPACK's xIPARMQ
+      const Index nh = iu-il+1;
+      Index ns = nh<150 ? 10 : nh<590 ? (std::max)(Index(10), nh/Index(std::log(double(nh))/std::log(2.0)+0.5))
+               : nh<3000 ? 64 : nh<6000 ? 128 : 256;
+      ns = (std::min)(ns - ns%2, (nh/6)*2);
+      const Index nw = nh<=500 ? ns : 3*ns/2;
+
+      ShiftsType shifts;
+      const Index nd = aggressiveEarlyDeflation(il, iu, nw, computeU, ns/2, shifts);
+
+      // sweep unless many eigenvalues were deflated, in which case the deflation is repeated first
+      if(nd==0 || (100*nd <= 14*nw && iu-nd-il+1 >= EIGEN_COMPLEXSCHUR_MULTISHIFT_THRESHOLD))
+      {
+        const Index kbot = iu-nd;
+        if(iter%6==0 || shifts.rows()==0)
+        {
+          // exceptional shifts, each bulge getting a double shift
+          shifts.resize((std::max)(Index(1),(std::min)(ns/2,(kbot-il-1)/2)),2);
+          for(Index k = 0; k < shifts.rows(); ++k)
+          {
+            const Index i = kbot-2*k;
+            RealScalar ss = internal::norm1(m_matT.coeff(i,i-1)) + internal::norm1(m_matT.coeff(i-1,i-2));
+            ComplexScalar aa = RealScalar(0.75)*ss + m_matT.coeff(i,i);
+            shifts.coeffRef(k,0) = RealScalar(2)*aa;
+            shifts.coeffRef(k,1) = aa*aa;
+          }
+        }
+        performMultishiftQRSweep(il, kbot, computeU, shifts);
+        // a sweep counts as one iteration per bulge
+        totalIter += shifts.rows() - 1;
+      }
+      continue;
+    }
+
     /* perform the QR step using Givens rotations. The first rotation
        creates a bulge; the (il+2,il) element becomes nonzero. This
        bulge is chased down to the bottom of the active submatrix. */
@@ -393,6 +483,329 @@ void ComplexSchur<MatrixType>::reduceToTriangularForm(bool computeU)
   m_matUisUptodate = computeU;
 }
 
+/** \internal Swaps the adjacent diagonal entries \a j and \a j+1 of the triangular matrix \a T by a unitary
+  * similarity, as in LAPACK's xTREXC, and updates the Schur vectors \a V.
+  */
+template<typename MatrixType>
+void ComplexSchur<MatrixType>::swapDiagonalEntries(ComplexWorkMatrixType& T, ComplexWorkMatrixType& V, Index j)
+{
+  // rotate the eigenvector of the second eigenvalue onto the first unit vector
+  const Index n = T.cols();
+  ComplexScalar t11 = T.coeff(j,j), t22 = T.coeff(j+1,j+1);
+  JacobiRotation<ComplexScalar> rot;
+  rot.makeGivens(T.coeff(j,j+1), t22 - t11);
+  T.rightCols(n-j).applyOnTheLeft(j, j+1, rot.adjoint());
+  T.topRows(j+2).applyOnTheRight(j, j+1, rot);
+  V.applyOnTheRight(j, j+1, rot);
+  T.coeffRef(j,j) = t22;
+  T.coeffRef(j+1,j+1) = t11;
+  T.coeffRef(j+1,j) = ComplexScalar(0);
+}
+
+/** \internal Aggressive early deflation of the window of size \a nw at the bottom of the active block
+  * il:iu, as in LAPACK's xLAQR3.
+  *
+  * The window is reduced to Schur form. Its eigenvalues whose component in the spike, i.e., the
+  * transformed subdiagonal entry coupling the window to the rest of the block, is negligible are
+  * deflated, and the other ones are moved to the top of the window. The window is then brought back to
+  * Hessenberg form, and its deflated part is left triangular.
+  *
+  * Returns the number of deflated eigenvalues, and at most \a maxShifts pairs of shifts, formed from the
+  * undeflated eigenvalues closest to the bottom of the window, in \a shifts as (sum, product) pairs.
+  */
+template<typename MatrixType>
+typename MatrixType::Index ComplexSchur<MatrixType>::aggressiveEarlyDeflation(Index il, Index iu, Index nw, bool computeU,
+                                                                              Index maxShifts, ShiftsType& shifts)
+{
+  const Index size = m_matT.cols();
+  const RealScalar eps = NumTraits<RealScalar>::epsilon();
+  const RealScalar smlnum = (std::numeric_limits<RealScalar>::min)() * (RealScalar(size) / eps);
+  const Index jw = (std::min)(nw, iu-il+1);
+  const Index kwtop = iu-jw+1;
+  const ComplexScalar s = kwtop > il ? m_matT.coeff(kwtop,kwtop-1) : ComplexScalar(0);
+  shifts.resize(0,2);
+
+  // Schur form of the window
+  ComplexWorkMatrixType Tw = m_matT.block(kwtop,kwtop,jw,jw);
+  if(jw > 2)
+    Tw.bottomLeftCorner(jw-2,jw-2).template triangularView<Lower>().setZero();
+  ComplexSchur<ComplexWorkMatrixType> schurOfWindow(jw);
+  schurOfWindow.computeFromHessenberg(Tw, ComplexWorkMatrixType::Identity(jw,jw), true);
+  if(schurOfWindow.info() != Success)
+    return 0;
+  Tw = schurOfWindow.matrixT();
+  ComplexWorkMatrixType V = schurOfWindow.matrixU();
+
+  // deflation checks from the bottom, the undeflatable eigenvalues being moved to the top
+  Index ns = jw, ilst = 0;
+  while(ilst < ns)
+  {
+    RealScalar foo = internal::norm1(Tw.coeff(ns-1,ns-1));
+    if(foo == RealScalar(0))
+      foo = internal::norm1(s);
+    if(internal::norm1(s) * internal::norm1(V.coeff(0,ns-1)) <= (std::max)(smlnum, eps*foo))
+      --ns;
+    else
+    {
+      for(Index j = ns-2; j >= ilst; --j)
+        swapDiagonalEntries(Tw, V, j);
+      ++ilst;
+    }
+  }
+
+  // the shifts are the undeflated eigenvalues, taken by pairs
+  shifts.resize((std::min)(maxShifts,(ns+1)/2),2);
+  for(Index k = 0; k < shifts.rows(); ++k)
+  {
+    const Index i = ns-1-2*k;
+    const ComplexScalar l1 = Tw.coeff(i,i), l2 = i > 0 ? Tw.coeff(i-1,i-1) : l1;
+    shifts.coeffRef(k,0) = l1 + l2;
+    shifts.coeffRef(k,1) = l1 * l2;
+  }
+
+  if(ns == jw)
+    return 0;
+
+  // reduce the undeflated part of the window and the spike back to Hessenberg form
+  ComplexScalar subdiag = ns == 1 ? s * internal::conj(V.coeff(0,0)) : ComplexScalar(0);
+  if(ns > 1)
+  {
+    Matrix<ComplexScalar,Dynamic,1> spikeVector = s * V.row(0).head(ns).adjoint(), ess(ns-1), work(jw);
+    ComplexScalar tau;
+    RealScalar beta;
+    spikeVector.makeHouseholder(ess, tau, beta);
+    Tw.topRows(ns).applyHouseholderOnTheLeft(ess, tau, work.data());
+    Tw.topLeftCorner(ns,ns).applyHouseholderOnTheRight(ess.conjugate(), internal::conj(tau), work.data());
+    V.leftCols(ns).applyHouseholderOnTheRight(ess.conjugate(), internal::conj(tau), work.data());
+
+    HessenbergDecomposition<ComplexWorkMatrixType> hess(Tw.topLeftCorner(ns,ns));
+    ComplexWorkMatrixType Q = hess.matrixQ();
+    Tw.topLeftCorner(ns,ns) = hess.matrixH();
+    Tw.topRightCorner(ns,jw-ns) = Q.adjoint() * Tw.topRightCorner(ns,jw-ns);
+    V.leftCols(ns) = V.leftCols(ns) * Q;
+    subdiag = beta;
+  }
+
+  // copy the window back and apply its transformation to the rest of the matrix
+  if(kwtop > il)
+    m_matT.coeffRef(kwtop,kwtop-1) = subdiag;
+  m_matT.block(kwtop,kwtop,jw,jw) = Tw;
+  if(kwtop > 0)
+    m_matT.block(0,kwtop,kwtop,jw) = m_matT.block(0,kwtop,kwtop,jw) * V;
+  if(iu < size-1)
+    m_matT.block(kwtop,iu+1,jw,size-iu-1) = V.adjoint() * m_matT.block(kwtop,iu+1,jw,size-iu-1);
+  if(computeU)
+    m_matU.middleCols(kwtop,jw) = m_matU.middleCols(kwtop,jw) * V;
+  return jw-ns;
+}
+
+/** \internal \returns the first column, from row \a g, of (T - l1 I)(T - l2 I) where l1 + l2 = shifts(b,0) and
+  * l1 l2 = shifts(b,1), which starts the bulge \a b at row \a g.
+  */
+template<typename MatrixType>
+inline Matrix<typename ComplexSchur<MatrixType>::ComplexScalar,3,1>
+ComplexSchur<MatrixType>::computeBulgeStart(Index g, const ShiftsType& shifts, Index b)
+{
+  const ComplexScalar h00 = m_matT.coeff(g,g), h10 = m_matT.coeff(g+1,g);
+  Matrix<ComplexScalar,3,1> v;
+  v.coeffRef(0) = h00*h00 + m_matT.coeff(g,g+1)*h10 - shifts.coeff(b,0)*h00 + shifts.coeff(b,1);
+  v.coeffRef(1) = h10 * (h00 + m_matT.coeff(g+1,g+1) - shifts.coeff(b,0));
+  v.coeffRef(2) = h10 * m_matT.coeff(g+2,g+1);
+  return v;
+}
+
+/** \internal Sets the subdiagonal entry T(k+1,k) to zero in the course of a multishift sweep if it is negligible
+  * by the conservative criterion of Ahues and Tisseur used by xLAQR5, so that the bulges collapse on the split
+  * rather than spreading round-off errors over it.
+  */
+template<typename MatrixType>
+inline void ComplexSchur<MatrixType>::deflateDuringSweep(Index k, RealScalar smlnum)
+{
+  const RealScalar eps = NumTraits<RealScalar>::epsilon();
+  const RealScalar h10 = internal::norm1(m_matT.coeff(k+1,k));
+  if(h10 == RealScalar(0)
+  || h10 > (std::max)(smlnum, eps * (internal::norm1(m_matT.coeff(k,k)) + internal::norm1(m_matT.coeff(k+1,k+1)))))
+    return;
+  const RealScalar h01 = internal::norm1(m_matT.coeff(k,k+1));
+  const RealScalar d = internal::norm1(m_matT.coeff(k,k) - m_matT.coeff(k+1,k+1));
+  const RealScalar h12 = (std::max)(h10, h01), h21 = (std::min)(h10, h01);
+  const RealScalar h11 = (std::max)(internal::norm1(m_matT.coeff(k+1,k+1)), d);
+  const RealScalar h22 = (std::min)(internal::norm1(m_matT.coeff(k+1,k+1)), d);
+  const RealScalar scale = h11 + h12;
+  const RealScalar tst = h22 * (h11 / scale);
+  if(tst == RealScalar(0) || h21 * (h12 / scale) <= (std::max)(smlnum, eps * tst))
+    m_matT.coeffRef(k+1,k) = ComplexScalar(0);
+}
+
+/** \internal Computes the reflector of \a v as makeHouseholder() does, but from \a v divided by its largest
+  * coefficient, so that the reflector stays unitary when the squares of the coefficients of a bulge which has
+  * nearly vanished underflow.
+  */
+template<typename MatrixType>
+template<typename VectorType, typename EssentialPart>
+inline void ComplexSchur<MatrixType>::makeScaledHouseholder(const VectorType& v, EssentialPart& ess,
+                                                            ComplexScalar& tau, RealScalar& beta)
+{
+  const RealScalar scale = v.cwiseAbs().maxCoeff();
+  if(scale == RealScalar(0))
+  {
+    ess.setZero();
+    tau = ComplexScalar(0);
+    beta = RealScalar(0);
+    return;
+  }
+  (v / scale).makeHouseholder(ess, tau, beta);
+  beta *= scale;
+}
+
+/** \internal Applies the reflector H of a bulge at row \a g as the similarity H T H^*, restricted to the
+  * window ws:we of the active block ending at row \a iu, and accumulates it in \a U.
+  */
+template<typename MatrixType>
+template<typename EssentialPart>
+inline void ComplexSchur<MatrixType>::applyBulgeReflector(Index g, Index ws, Index we, Index iu, const EssentialPart& ess,
+                                                          const ComplexScalar& tau, ComplexWorkMatrixType& U,
+                                                          ComplexScalar* workspace)
+{
+  const Index rs = EssentialPart::SizeAtCompileTime+1;
+  m_matT.block(g, g, rs, we-g+1).applyHouseholderOnTheLeft(ess, tau, workspace);
+  m_matT.block(ws, g, (std::min)(iu,g+3)-ws+1, rs).applyHouseholderOnTheRight(ess.conjugate(), internal::conj(tau), workspace);
+  U.block(0, g-ws, U.rows(), rs).applyHouseholderOnTheRight(ess.conjugate(), internal::conj(tau), workspace);
+}
+
+/** \internal Performs a multishift QR sweep on the active block il:iu, as in LAPACK's xLAQR5.
+  *
+  * Each pair of \a shifts, given by their sum and their product, introduces a 3x3 bulge at the top of the
+  * block. The bulges are chased down together, three rows apart. The reflectors are applied to a window
+  * of the block enclosing the chain of bulges and accumulated into a unitary matrix U, which is then
+  * applied to the rows above and the columns right of the window, and to the Schur vectors, by matrix
+  * products.
+  *
+  * As in xLAQR5, the subdiagonal entries left behind the bulges are deflated as soon as they are negligible, and
+  * a bulge which collapses on such a split is started again from its shifts.
+  */
+template<typename MatrixType>
+void ComplexSchur<MatrixType>::performMultishiftQRSweep(Index il, Index iu, bool computeU, const ShiftsType& shifts)
+{
+  const Index size = m_matT.cols();
+  const RealScalar eps = NumTraits<RealScalar>::epsilon();
+  const RealScalar smlnum = (std::numeric_limits<RealScalar>::min)() * (RealScalar(iu-il+1) / eps);
+  const Index nbBulges = shifts.rows();
+  const Index nbReflectors = iu-il;  // reflectors of size 3 at rows il,...,iu-2 and of size 2 at row iu-1
+  const Index nbSteps = nbReflectors + 3*(nbBulges-1);
+  const Index stepsPerWindow = (std::max)(Index(3)*nbBulges, Index(12));
+  ComplexWorkMatrixType U;
+  Matrix<ComplexScalar,Dynamic,1> workspace(size);
+
+  for(Index s0 = 0; s0 < nbSteps; s0 += stepsPerWindow)
+  {
+    const Index s1 = (std::min)(s0+stepsPerWindow, nbSteps);
+    const Index ws = (std::max)(il, il + s0 - 3*(nbBulges-1) - 1);
+    const Index we = (std::min)(iu, il + s1 + 2);
+    U.setIdentity(we-ws+1, we-ws+1);
+
+    for(Index s = s0; s < s1; ++s)
+    {
+      // the bulge in front goes first, so that each bulge sees the matrix left by the previous one
+      for(Index b = 0; b < nbBulges && s-3*b >= 0; ++b)
+      {
+        const Index k = s-3*b;
+        if(k >= nbReflectors)
+          continue;
+        const Index g = il+k;
+        ComplexScalar tau;
+        RealScalar beta;
+        if(g < iu-1)
+        {
+          Matrix<ComplexScalar,2,1> ess;
+          if(k == 0)
+          {
+            makeScaledHouseholder(computeBulgeStart(g, shifts, b), ess, tau, beta);
+            if(tau != ComplexScalar(0))
+              applyBulgeReflector(g, ws, we, iu, ess, tau, U, workspace.data());
+            continue;
+          }
+          makeScaledHouseholder(m_matT.template block<3,1>(g,g-1), ess, tau, beta);
+          ComplexScalar subdiag = beta;
+          if(m_matT.coeff(g+2,g-1) == ComplexScalar(0) && m_matT.coeff(g+2,g) == ComplexScalar(0)
+          && m_matT.coeff(g+2,g+1) != ComplexScalar(0))
+          {
+            // the bulge collapsed: a new one is started at row g from the same shifts, unless the fill it leaves
+            // in column g-1 is not negligible
+            Matrix<ComplexScalar,2,1> essNew;
+            ComplexScalar tauNew;
+            RealScalar betaNew;
+            makeScaledHouseholder(computeBulgeStart(g, shifts, b), essNew, tauNew, betaNew);
+            const ComplexScalar refsum = tauNew * (m_matT.coeff(g,g-1) + internal::conj(essNew.coeff(0)) * m_matT.coeff(g+1,g-1));
+            if(internal::norm1(m_matT.coeff(g+1,g-1) - refsum * essNew.coeff(0)) + internal::norm1(refsum * essNew.coeff(1))
+               <= eps * (internal::norm1(m_matT.coeff(g-1,g-1)) + internal::norm1(m_matT.coeff(g,g)) + internal::norm1(m_matT.coeff(g+1,g+1))))
+            {
+              ess = essNew;
+              tau = tauNew;
+              subdiag = m_matT.coeff(g,g-1) - refsum;
+            }
+          }
+          m_matT.coeffRef(g,g-1) = subdiag;
+          m_matT.coeffRef(g+1,g-1) = ComplexScalar(0);
+          m_matT.coeffRef(g+2,g-1) = ComplexScalar(0);
+          if(tau != ComplexScalar(0))
+            applyBulgeReflector(g, ws, we, iu, ess, tau, U, workspace.data());
+        }
+        else
+        {
+          Matrix<ComplexScalar,1,1> ess;
+          makeScaledHouseholder(m_matT.template block<2,1>(g,g-1), ess, tau, beta);
+          m_matT.coeffRef(g,g-1) = beta;
+          m_matT.coeffRef(g+1,g-1) = ComplexScalar(0);
+          if(tau != ComplexScalar(0))
+            applyBulgeReflector(g, ws, we, iu, ess, tau, U, workspace.data());
+        }
+      }
+
+      // once all the bulges moved, the subdiagonal entries they reduced are final for this step
+      for(Index b = 0; b < nbBulges && s-3*b >= 0; ++b)
+      {
+        const Index k = s-3*b;
+        if(k > 0 && k < nbReflectors)
+          deflateDuringSweep(il+k-1, smlnum);
+      }
+    }
+
+    // apply the accumulated transformation outside of the window; U is banded, so that each panel of its
+    // columns only combines a range of rows
+    const Index w = we-ws+1;
+    const Index panelSize = (w+3)/4;
+    ComplexWorkMatrixType top = m_matT.block(0, ws, ws, w), right = m_matT.block(ws, we+1, w, size-we-1), Z;
+    if(computeU)
+      Z = m_matU.middleCols(ws, w);
+    for(Index c0 = 0; c0 < w; c0 += panelSize)
+    {
+      const Index cw = (std::min)(panelSize, w-c0);
+      Index r0 = w, r1 = -1;
+      for(Index j = c0; j < c0+cw; ++j)
+        for(Index i = 0; i < w; ++i)
+          if(U.coeff(i,j) != ComplexScalar(0))
+          {
+            r0 = (std::min)(r0, i);
+            r1 = (std::max)(r1, i);
+          }
+      const Index rw = r1-r0+1;
+      m_matT.block(0, ws+c0, ws, cw).noalias() = top.middleCols(r0, rw) * U.block(r0, c0, rw, cw);
+      m_matT.block(ws+c0, we+1, cw, size-we-1).noalias() = U.block(r0, c0, rw, cw).adjoint() * right.middleRows(r0, rw);
+      if(computeU)
+        m_matU.middleCols(ws+c0, cw).noalias() = Z.middleCols(r0, rw) * U.block(r0, c0, rw, cw);
+    }
+  }
+
+  // clean up pollution due to round-off errors
+  for(Index i = il+2; i <= iu; ++i)
+  {
+    m_matT.coeffRef(i,i-2) = ComplexScalar(0);
+    if(i > il+2)
+      m_matT.coeffRef(i,i-3) = ComplexScalar(0);
+  }
+}
+
 } // end namespace Eigen
 
 #endif // EIGEN_COMPLEX_SCHUR_H
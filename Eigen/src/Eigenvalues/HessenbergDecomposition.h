@@ -286,15 +286,91 @@ template<typename _MatrixType> class HessenbergDecomposition
   *
   * Implemented from Golub's "%Matrix Computations", algorithm 8.3.1.
   *
+  * Large matrices are reduced by panels of 32 columns as in LAPACK's xGEHRD: the reflectors of a panel
+  * are accumulated into the compact WY form I - V T V^*, together with Y = A V T, such that the trailing
+  * matrix is updated by matrix-matrix products. The last columns are reduced one at a time.
+  *
   * \sa packedMatrix()
   */
 template<typename MatrixType>
 void HessenbergDecomposition<MatrixType>::_compute(MatrixType& matA, CoeffVectorType& hCoeffs, VectorType& temp)
 {
+  typedef Matrix<Scalar,Dynamic,Dynamic,ColMajor> WorkMatrixType;
+  typedef Matrix<Scalar,Dynamic,1> WorkVectorType;
   assert(matA.rows()==matA.cols());
   Index n = matA.rows();
   temp.resize(n);
-  for (Index i = 0; i<n-1; ++i)
+
+  const Index blockSize = 32;
+  Index k = 0;
+  if(n>=4*blockSize)
+  {
+    // V holds the reflectors of the panel with explicit zeros and ones, Y = A V T has n rows,
+    // and the block reflector of the panel H_{bs-1} ... H_0 is I - V T^* V^*.
+    // The workspace is allocated for the first panel, which is the largest one.
+    WorkMatrixType Vbuf(n-1, blockSize), Y(n, blockSize), T(blockSize, blockSize);
+    WorkMatrixType W(blockSize, n-blockSize), WT(blockSize, n-blockSize);
+    WorkVectorType tmp(blockSize);
+    for(; n-k>2*blockSize; k+=blockSize)
+    {
+      const Index bs = blockSize;
+      const Index vs = n-k-1;
+      Block<WorkMatrixType,Dynamic,Dynamic> V(Vbuf, 0, 0, vs, bs);
+      for(Index i=0; i<bs; ++i)
+      {
+        const Index c = k+i;
+        const Index remainingSize = n-c-1;
+        Block<MatrixType,Dynamic,1> col(matA, k+1, c, vs, 1);
+
+        // apply the previous reflectors of the panel to the current column, from the right then from the left
+        if(i>0)
+        {
+          col.noalias() -= Y.block(k+1,0,vs,i) * V.row(i-1).head(i).adjoint();
+          tmp.head(i).noalias() = V.leftCols(i).adjoint() * col;
+          tmp.head(i) = T.topLeftCorner(i,i).template triangularView<Upper>().adjoint() * tmp.head(i);
+          col.noalias() -= V.leftCols(i) * tmp.head(i);
+        }
+
+        RealScalar beta;
+        Scalar h;
+        matA.col(c).tail(remainingSize).makeHouseholderInPlace(h, beta);
+        matA.coeffRef(c+1,c) = beta;
+        hCoeffs.coeffRef(c) = h;
+        V.col(i).head(i).setZero();
+        V.coeffRef(i,i) = Scalar(1);
+        V.col(i).tail(remainingSize-1) = matA.col(c).tail(remainingSize-1);
+
+        // Y_i = conj(h) (A v - Y V^* v) where the columns of A right of the current one are not updated yet
+        Block<WorkMatrixType,Dynamic,1> y(Y, k+1, i, vs, 1);
+        y.noalias() = matA.block(k+1,c+1,vs,remainingSize) * V.col(i).tail(remainingSize);
+        tmp.head(i).noalias() = V.leftCols(i).adjoint() * V.col(i);
+        y.noalias() -= Y.block(k+1,0,vs,i) * tmp.head(i);
+        y *= internal::conj(h);
+
+        // T_i = -conj(h) T V^* v
+        T.col(i).head(i) = T.topLeftCorner(i,i).template triangularView<Upper>() * tmp.head(i);
+        T.col(i).head(i) *= -internal::conj(h);
+        T.coeffRef(i,i) = internal::conj(h);
+      }
+
+      // the rows above the panel only need the update from the right, A = A - A V T V^*,
+      // which is computed as A = A - (T^* (A V)^*)^* V^*
+      Block<MatrixType,Dynamic,Dynamic> top(matA, 0, k+1, k+1, vs);
+      W.leftCols(k+1).noalias() = V.adjoint() * top.adjoint();
+      WT.leftCols(k+1).noalias() = T.template triangularView<Upper>().adjoint() * W.leftCols(k+1);
+      top.noalias() -= WT.leftCols(k+1).adjoint() * V.adjoint();
+
+      // the trailing columns are updated from the right, then from the left
+      const Index ts = n-k-bs;
+      Block<MatrixType,Dynamic,Dynamic> trailing(matA, k+1, k+bs, vs, ts);
+      trailing.noalias() -= Y.block(k+1,0,vs,bs) * V.bottomRows(ts).adjoint();
+      W.leftCols(ts).noalias() = V.adjoint() * trailing;
+      WT.leftCols(ts).noalias() = T.template triangularView<Upper>().adjoint() * W.leftCols(ts);
+      trailing.noalias() -= V * WT.leftCols(ts);
+    }
+  }
+
+  for (Index i = k; i<n-1; ++i)
   {
     // let's consider the vector v = i-th column starting at position i+1
     Index remainingSize = n-i-1;
@@ -163,6 +163,32 @@ template<typename _MatrixType> class RealSchur
       */
     RealSchur& compute(const MatrixType& matrix, bool computeU = true);
 
+    /** \brief Computes Schur decomposition of a Hessenberg matrix H = Z T Z^T
+      *
+      * \param[in] matrixH Matrix in Hessenberg form H
+      * \param[in] matrixQ orthogonal matrix Q that transform a matrix A to H : A = Q H Q^T
+      * \param[in] computeU Computes the matriX U of the Schur vectors
+      * \returns Reference to \c *this
+      *
+      * This routine assumes that the matrix is already reduced in Hessenberg form matrixH
+      * using either the class HessenbergDecomposition or another mean.
+      * It computes the upper quasi-triangular matrix T of the Schur decomposition of H.
+      * When computeU is true, this routine computes the matrix U such that
+      * A = U T U^T =  (QZ) T (QZ)^T = Q H Q^T where A is the initial matrix.
+      *
+      * NOTE Q is referenced if computeU is true; so, if the initial orthogonal matrix
+      * is not available, the user should give an identity matrix (Q.setIdentity())
+      *
+      * Active blocks of at least EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD rows are reduced by multishift QR
+      * sweeps with aggressive early deflation, as in LAPACK's xHSEQR: the eigenvalues of a window at the
+      * bottom of the block which have converged are deflated, the others are used as shifts of a chain of
+      * small bulges, and the transformations are accumulated such that they are applied by matrix products.
+      *
+      * \sa compute(const MatrixType&, bool)
+      */
+    template<typename HessMatrixType, typename OrthMatrixType>
+    RealSchur& computeFromHessenberg(const HessMatrixType& matrixH, const OrthMatrixType& matrixQ, bool computeU);
+
     /** \brief Reports whether previous computation was successful.
       *
       * \returns \c Success if computation was succesful, \c NoConvergence otherwise.
@@ -190,6 +216,8 @@ template<typename _MatrixType> class RealSchur
     bool m_matUisUptodate;
 
     typedef Matrix<Scalar,3,1> Vector3s;
+    typedef Matrix<Scalar,Dynamic,Dynamic> WorkMatrixType;
+    typedef Matrix<Scalar,Dynamic,2> ShiftsType;
 
     Scalar computeNormOfT();
     Index findSmallSubdiagEntry(Index iu, Scalar norm);
@@ -197,6 +225,17 @@ template<typename _MatrixType> class RealSchur
     void computeShift(Index iu, Index iter, Scalar& exshift, Vector3s& shiftInfo);
     void initFrancisQRStep(Index il, Index iu, const Vector3s& shiftInfo, Index& im, Vector3s& firstHouseholderVector);
     void performFrancisQRStep(Index il, Index im, Index iu, bool computeU, const Vector3s& firstHouseholderVector, Scalar* workspace);
+    Index aggressiveEarlyDeflation(Index il, Index iu, Index nw, bool computeU, Index maxShifts, ShiftsType& shifts);
+    void performMultishiftQRSweep(Index il, Index iu, bool computeU, const ShiftsType& shifts, Scalar* workspace);
+    Vector3s computeBulgeStart(Index g, const ShiftsType& shifts, Index b);
+    void deflateDuringSweep(Index k, Scalar smlnum);
+    template<typename VectorType, typename EssentialPart>
+    static void makeScaledHouseholder(const VectorType& v, EssentialPart& ess, Scalar& tau, Scalar& beta);
+    template<typename EssentialPart>
+    void applyBulgeReflector(Index g, Index ws, Index we, Index iu, const EssentialPart& ess, Scalar tau,
+                             WorkMatrixType& U, Scalar* workspace);
+    static bool swapSchurBlocks(WorkMatrixType& T, WorkMatrixType& V, Index j, Index p, Index q);
+    static bool moveSchurBlock(WorkMatrixType& T, WorkMatrixType& V, Index ifst, Index ilst);
 };
 
 
@@ -207,11 +246,20 @@ RealSchur<MatrixType>& RealSchur<MatrixType>::compute(const MatrixType& matrix,
 
   // Step 1. Reduce to Hessenberg form
   m_hess.compute(matrix);
-  m_matT = m_hess.matrixH();
+
+  // Step 2. Reduce to real Schur form
+  computeFromHessenberg(m_hess.matrixH(), m_hess.matrixQ(), computeU);
+  return *this;
+}
+
+template<typename MatrixType>
+template<typename HessMatrixType, typename OrthMatrixType>
+RealSchur<MatrixType>& RealSchur<MatrixType>::computeFromHessenberg(const HessMatrixType& matrixH, const OrthMatrixType& matrixQ, bool computeU)
+{
+  m_matT = matrixH;
   if (computeU)
-    m_matU = m_hess.matrixQ();
+    m_matU = matrixQ;
 
-  // Step 2. Reduce to real Schur form  
   m_workspaceVector.resize(m_matT.cols());
   Scalar* workspace = &m_workspaceVector.coeffRef(0);
 
@@ -246,6 +294,44 @@ RealSchur<MatrixType>& RealSchur<MatrixType>::compute(const MatrixType& matrix,
         iu -= 2;
         iter = 0;
       }
+      else if (iu-il+1 >= EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD) // Multishift sweep on a large block
+      {
+        iter = iter + 1;
+        totalIter = totalIter + 1;
+        if (totalIter > m_maxIterations * m_matT.cols()) break;
+
+        // number of shifts and size of the deflation window, from LAPACK's xIPARMQ
+        const Index nh = iu-il+1;
+        Index ns = nh<150 ? 10 : nh<590 ? (std::max)(Index(10), nh/Index(std::log(double(nh))/std::log(2.0)+0.5))
+                 : nh<3000 ? 64 : nh<6000 ? 128 : 256;
+        ns = (std::min)(ns - ns%2, (nh/6)*2);
+        const Index nw = nh<=500 ? ns : 3*ns/2;
+
+        ShiftsType shifts;
+        const Index nd = aggressiveEarlyDeflation(il, iu, nw, computeU, ns/2, shifts);
+
+        // sweep unless many eigenvalues were deflated, in which case the deflation is repeated first
+        if (nd==0 || (100*nd <= 14*nw && iu-nd-il+1 >= EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD))
+        {
+          const Index kbot = iu-nd;
+          if (iter%6==0 || shifts.rows()==0)
+          {
+            // exceptional shifts
+            shifts.resize((std::max)(Index(1),(std::min)(ns/2,(kbot-il-1)/2)),2);
+            for (Index k = 0; k < shifts.rows(); ++k)
+            {
+              const Index i = kbot-2*k;
+              Scalar ss = internal::abs(m_matT.coeff(i,i-1)) + internal::abs(m_matT.coeff(i-1,i-2));
+              Scalar aa = Scalar(0.75)*ss + m_matT.coeff(i,i);
+              shifts.coeffRef(k,0) = Scalar(2)*aa;
+              shifts.coeffRef(k,1) = aa*aa + Scalar(0.4375)*ss*ss;
+            }
+          }
+          performMultishiftQRSweep(il, kbot, computeU, shifts, workspace);
+          // a sweep counts as one iteration per bulge
+          totalIter = totalIter + shifts.rows() - 1;
+        }
+      }
       else // No convergence yet
       {
         // The firstHouseholderVector vector has to be initialized to something to get rid of a silly GCC warning (-O1 -Wall -DNDEBUG )
@@ -253,14 +339,14 @@ RealSchur<MatrixType>& RealSchur<MatrixType>::compute(const MatrixType& matrix,
         computeShift(iu, iter, exshift, shiftInfo);
         iter = iter + 1;
         totalIter = totalIter + 1;
-        if (totalIter > m_maxIterations * matrix.cols()) break;
+        if (totalIter > m_maxIterations * m_matT.cols()) break;
         Index im;
         initFrancisQRStep(il, iu, shiftInfo, im, firstHouseholderVector);
         performFrancisQRStep(il, im, iu, computeU, firstHouseholderVector, workspace);
       }
     }
   }
-  if(totalIter <= m_maxIterations * matrix.cols()) 
+  if(totalIter <= m_maxIterations * m_matT.cols())
     m_info = Success;
   else
     m_info = NoConvergence;
@@ -461,6 +547,414 @@ inline void RealSchur<MatrixType>::performFrancisQRStep(Index il, Index im, Inde
   }
 }
 
+/** \internal Swaps the adjacent diagonal blocks of sizes \a p and \a q at row \a j of the quasi-triangular
+  * matrix \a T, and updates the Schur vectors \a V, as in LAPACK's xLAEXC. Returns false if the swap is
+  * rejected because it would not be accurate enough.
+  */
+template<typename MatrixType>
+bool RealSchur<MatrixType>::swapSchurBlocks(WorkMatrixType& T, WorkMatrixType& V, Index j, Index p, Index q)
+{
+  typedef Matrix<Scalar,Dynamic,Dynamic,0,4,4> SmallMatrixType;
+  const Index n = T.cols(), k = p+q;
+
+  if (p==1 && q==1)
+  {
+    // rotate the eigenvector of the second eigenvalue onto the first unit vector
+    Scalar t11 = T.coeff(j,j), t22 = T.coeff(j+1,j+1);
+    JacobiRotation<Scalar> rot;
+    rot.makeGivens(T.coeff(j,j+1), t22 - t11);
+    T.rightCols(n-j).applyOnTheLeft(j, j+1, rot.adjoint());
+    T.topRows(j+2).applyOnTheRight(j, j+1, rot);
+    V.applyOnTheRight(j, j+1, rot);
+    T.coeffRef(j,j) = t22;
+    T.coeffRef(j+1,j+1) = t11;
+    T.coeffRef(j+1,j) = Scalar(0);
+    return true;
+  }
+
+  // solve the Sylvester equation T11 X - X T22 = -T12, such that [X; I] spans the invariant subspace of T22
+  SmallMatrixType S = SmallMatrixType::Zero(p*q, p*q);
+  Matrix<Scalar,Dynamic,1,0,4,1> rhs(p*q);
+  for (Index c = 0; c < q; ++c)
+    for (Index r = 0; r < p; ++r)
+    {
+      rhs.coeffRef(r+c*p) = -T.coeff(j+r, j+p+c);
+      for (Index i = 0; i < p; ++i)
+        S.coeffRef(r+c*p, i+c*p) += T.coeff(j+r, j+i);
+      for (Index i = 0; i < q; ++i)
+        S.coeffRef(r+c*p, r+i*p) -= T.coeff(j+p+i, j+p+c);
+    }
+  FullPivLU<SmallMatrixType> lu(S);
+  if (!lu.isInvertible())
+    return false;
+  Matrix<Scalar,Dynamic,1,0,4,1> x = lu.solve(rhs);
+
+  SmallMatrixType D(k, q);
+  for (Index c = 0; c < q; ++c)
+    D.col(c).head(p) = x.segment(c*p, p);
+  D.bottomRows(q).setIdentity();
+  SmallMatrixType Q = HouseholderQR<SmallMatrixType>(D).householderQ();
+
+  // reject the swap if the block below the diagonal is not negligible
+  SmallMatrixType Tk = Q.transpose() * T.block(j,j,k,k) * Q;
+  const Scalar thresh = (std::max)(Scalar(10) * NumTraits<Scalar>::epsilon() * T.block(j,j,k,k).cwiseAbs().maxCoeff(),
+                                   (std::numeric_limits<Scalar>::min)());
+  if (Tk.bottomLeftCorner(p,q).cwiseAbs().maxCoeff() > thresh)
+    return false;
+
+  T.block(j, j, k, n-j) = Q.transpose() * T.block(j, j, k, n-j);
+  T.block(0, j, j+k, k) = T.block(0, j, j+k, k) * Q;
+  V.middleCols(j, k) = V.middleCols(j, k) * Q;
+  T.block(j+q, j, p, q).setZero();
+  return true;
+}
+
+/** \internal Moves the diagonal block of the quasi-triangular matrix \a T starting at row \a ifst up to row
+  * \a ilst by swapping adjacent blocks. Returns false if a swap is rejected.
+  */
+template<typename MatrixType>
+bool RealSchur<MatrixType>::moveSchurBlock(WorkMatrixType& T, WorkMatrixType& V, Index ifst, Index ilst)
+{
+  const Index n = T.cols();
+  const Index nb = (ifst+1 < n && T.coeff(ifst+1,ifst) != Scalar(0)) ? 2 : 1;
+  Index here = ifst;
+  while (here > ilst)
+  {
+    const Index nbAbove = (here-2 >= ilst && T.coeff(here-1,here-2) != Scalar(0)) ? 2 : 1;
+    if (!swapSchurBlocks(T, V, here-nbAbove, nbAbove, nb))
+      return false;
+    here -= nbAbove;
+  }
+  return true;
+}
+
+/** \internal Aggressive early deflation of the window of size \a nw at the bottom of the active block
+  * il:iu, as in LAPACK's xLAQR3.
+  *
+  * The window is reduced to Schur form. Its eigenvalues whose component in the spike, i.e., the
+  * transformed subdiagonal entry coupling the window to the rest of the block, is negligible are
+  * deflated, and the other ones are moved to the top of the window. The window is then brought back to
+  * Hessenberg form, and its deflated part is left in Schur form with zero subdiagonal entries.
+  *
+  * Returns the number of deflated eigenvalues, and at most \a maxShifts pairs of shifts, formed from the
+  * undeflated eigenvalues closest to the bottom of the window, in \a shifts as (sum, product) pairs.
+  */
+template<typename MatrixType>
+typename MatrixType::Index RealSchur<MatrixType>::aggressiveEarlyDeflation(Index il, Index iu, Index nw, bool computeU,
+                                                                           Index maxShifts, ShiftsType& shifts)
+{
+  const Index size = m_matT.cols();
+  const Scalar eps = NumTraits<Scalar>::epsilon();
+  const Scalar smlnum = (std::numeric_limits<Scalar>::min)() * (Scalar(size) / eps);
+  const Index jw = (std::min)(nw, iu-il+1);
+  const Index kwtop = iu-jw+1;
+  const Scalar s = kwtop > il ? m_matT.coeff(kwtop,kwtop-1) : Scalar(0);
+  shifts.resize(0,2);
+
+  // Schur form of the window
+  WorkMatrixType Tw = m_matT.block(kwtop,kwtop,jw,jw);
+  if (jw > 2)
+    Tw.bottomLeftCorner(jw-2,jw-2).template triangularView<Lower>().setZero();
+  RealSchur<WorkMatrixType> schurOfWindow(jw);
+  schurOfWindow.computeFromHessenberg(Tw, WorkMatrixType::Identity(jw,jw), true);
+  if (schurOfWindow.info() != Success)
+    return 0;
+  Tw = schurOfWindow.matrixT();
+  WorkMatrixType V = schurOfWindow.matrixU();
+
+  // deflation checks from the bottom, the undeflatable blocks being moved to the top
+  Index ns = jw, ilst = 0;
+  while (ilst < ns)
+  {
+    const bool twoByTwo = ns > 1 && Tw.coeff(ns-1,ns-2) != Scalar(0);
+    const Index nb = twoByTwo ? 2 : 1;
+    Scalar foo = internal::abs(Tw.coeff(ns-1,ns-1));
+    if (twoByTwo)
+      foo += internal::sqrt(internal::abs(Tw.coeff(ns-1,ns-2))) * internal::sqrt(internal::abs(Tw.coeff(ns-2,ns-1)));
+    if (foo == Scalar(0))
+      foo = internal::abs(s);
+    Scalar spike = internal::abs(s * V.coeff(0,ns-1));
+    if (twoByTwo)
+      spike = (std::max)(spike, internal::abs(s * V.coeff(0,ns-2)));
+    if (spike <= (std::max)(smlnum, eps*foo))
+      ns -= nb;
+    else
+    {
+      if (!moveSchurBlock(Tw, V, ns-nb, ilst))
+        break;
+      ilst += nb;
+    }
+  }
+
+  // the shifts are the undeflated eigenvalues, real ones being paired
+  shifts.resize(maxShifts,2);
+  Index nbShifts = 0;
+  bool pendingReal = false;
+  Scalar lambda(0);
+  for (Index i = ns-1; i >= 0 && nbShifts < maxShifts; )
+  {
+    if (i > 0 && Tw.coeff(i,i-1) != Scalar(0))
+    {
+      shifts.coeffRef(nbShifts,0) = Tw.coeff(i-1,i-1) + Tw.coeff(i,i);
+      shifts.coeffRef(nbShifts,1) = Tw.coeff(i-1,i-1)*Tw.coeff(i,i) - Tw.coeff(i-1,i)*Tw.coeff(i,i-1);
+      ++nbShifts;
+      i -= 2;
+    }
+    else
+    {
+      if (pendingReal)
+      {
+        shifts.coeffRef(nbShifts,0) = lambda + Tw.coeff(i,i);
+        shifts.coeffRef(nbShifts,1) = lambda * Tw.coeff(i,i);
+        ++nbShifts;
+      }
+      else
+        lambda = Tw.coeff(i,i);
+      pendingReal = !pendingReal;
+      i -= 1;
+    }
+  }
+  if (nbShifts == 0 && pendingReal && maxShifts > 0)
+  {
+    shifts.coeffRef(0,0) = Scalar(2)*lambda;
+    shifts.coeffRef(0,1) = lambda*lambda;
+    nbShifts = 1;
+  }
+  shifts.conservativeResize(nbShifts,2);
+
+  if (ns == jw)
+    return 0;
+
+  // reduce the undeflated part of the window and the spike back to Hessenberg form
+  Scalar subdiag = ns == 1 ? s * V.coeff(0,0) : Scalar(0);
+  if (ns > 1)
+  {
+    Matrix<Scalar,Dynamic,1> spikeVector = s * V.row(0).head(ns).transpose(), ess(ns-1), work(jw);
+    Scalar tau, beta;
+    spikeVector.makeHouseholder(ess, tau, beta);
+    Tw.topRows(ns).applyHouseholderOnTheLeft(ess, tau, work.data());
+    Tw.topLeftCorner(ns,ns).applyHouseholderOnTheRight(ess, tau, work.data());
+    V.leftCols(ns).applyHouseholderOnTheRight(ess, tau, work.data());
+
+    HessenbergDecomposition<WorkMatrixType> hess(Tw.topLeftCorner(ns,ns));
+    WorkMatrixType Q = hess.matrixQ();
+    Tw.topLeftCorner(ns,ns) = hess.matrixH();
+    Tw.topRightCorner(ns,jw-ns) = Q.transpose() * Tw.topRightCorner(ns,jw-ns);
+    V.leftCols(ns) = V.leftCols(ns) * Q;
+    subdiag = beta;
+  }
+
+  // copy the window back and apply its transformation to the rest of the matrix
+  if (kwtop > il)
+    m_matT.coeffRef(kwtop,kwtop-1) = subdiag;
+  m_matT.block(kwtop,kwtop,jw,jw) = Tw;
+  if (kwtop > 0)
+    m_matT.block(0,kwtop,kwtop,jw) = m_matT.block(0,kwtop,kwtop,jw) * V;
+  if (iu < size-1)
+    m_matT.block(kwtop,iu+1,jw,size-iu-1) = V.transpose() * m_matT.block(kwtop,iu+1,jw,size-iu-1);
+  if (computeU)
+    m_matU.middleCols(kwtop,jw) = m_matU.middleCols(kwtop,jw) * V;
+  return jw-ns;
+}
+
+/** \internal \returns the first column, from row \a g, of (T - l1 I)(T - l2 I) where l1 + l2 = shifts(b,0) and
+  * l1 l2 = shifts(b,1), which starts the bulge \a b at row \a g.
+  */
+template<typename MatrixType>
+inline typename RealSchur<MatrixType>::Vector3s RealSchur<MatrixType>::computeBulgeStart(Index g, const ShiftsType& shifts, Index b)
+{
+  const Scalar h00 = m_matT.coeff(g,g), h10 = m_matT.coeff(g+1,g);
+  Vector3s v;
+  v.coeffRef(0) = h00*h00 + m_matT.coeff(g,g+1)*h10 - shifts.coeff(b,0)*h00 + shifts.coeff(b,1);
+  v.coeffRef(1) = h10 * (h00 + m_matT.coeff(g+1,g+1) - shifts.coeff(b,0));
+  v.coeffRef(2) = h10 * m_matT.coeff(g+2,g+1);
+  return v;
+}
+
+/** \internal Sets the subdiagonal entry T(k+1,k) to zero in the course of a multishift sweep if it is negligible
+  * by the conservative criterion of Ahues and Tisseur used by xLAQR5, so that the bulges collapse on the split
+  * rather than spreading round-off errors over it.
+  */
+template<typename MatrixType>
+inline void RealSchur<MatrixType>::deflateDuringSweep(Index k, Scalar smlnum)
+{
+  const Scalar eps = NumTraits<Scalar>::epsilon();
+  const Scalar h10 = internal::abs(m_matT.coeff(k+1,k));
+  if (h10 == Scalar(0)
+   || h10 > (std::max)(smlnum, eps * (internal::abs(m_matT.coeff(k,k)) + internal::abs(m_matT.coeff(k+1,k+1)))))
+    return;
+  const Scalar h01 = internal::abs(m_matT.coeff(k,k+1));
+  const Scalar d = internal::abs(m_matT.coeff(k,k) - m_matT.coeff(k+1,k+1));
+  const Scalar h12 = (std::max)(h10, h01), h21 = (std::min)(h10, h01);
+  const Scalar h11 = (std::max)(internal::abs(m_matT.coeff(k+1,k+1)), d);
+  const Scalar h22 = (std::min)(internal::abs(m_matT.coeff(k+1,k+1)), d);
+  const Scalar scale = h11 + h12;
+  const Scalar tst = h22 * (h11 / scale);
+  if (tst == Scalar(0) || h21 * (h12 / scale) <= (std::max)(smlnum, eps * tst))
+    m_matT.coeffRef(k+1,k) = Scalar(0);
+}
+
+/** \internal Computes the reflector of \a v as makeHouseholder() does, but from \a v divided by its largest
+  * coefficient, so that the reflector stays orthogonal when the squares of the coefficients of a bulge which has
+  * nearly vanished underflow.
+  */
+template<typename MatrixType>
+template<typename VectorType, typename EssentialPart>
+inline void RealSchur<MatrixType>::makeScaledHouseholder(const VectorType& v, EssentialPart& ess, Scalar& tau, Scalar& beta)
+{
+  const Scalar scale = v.cwiseAbs().maxCoeff();
+  if (scale == Scalar(0))
+  {
+    ess.setZero();
+    tau = beta = Scalar(0);
+    return;
+  }
+  (v / scale).makeHouseholder(ess, tau, beta);
+  beta *= scale;
+}
+
+/** \internal Applies the reflector of a bulge at row \a g to the window ws:we of the active block ending at
+  * row \a iu, and accumulates it in \a U.
+  */
+template<typename MatrixType>
+template<typename EssentialPart>
+inline void RealSchur<MatrixType>::applyBulgeReflector(Index g, Index ws, Index we, Index iu, const EssentialPart& ess, Scalar tau,
+                                                       WorkMatrixType& U, Scalar* workspace)
+{
+  const Index rs = EssentialPart::SizeAtCompileTime+1;
+  m_matT.block(g, g, rs, we-g+1).applyHouseholderOnTheLeft(ess, tau, workspace);
+  m_matT.block(ws, g, (std::min)(iu,g+3)-ws+1, rs).applyHouseholderOnTheRight(ess, tau, workspace);
+  U.block(0, g-ws, U.rows(), rs).applyHouseholderOnTheRight(ess, tau, workspace);
+}
+
+/** \internal Performs a multishift QR sweep on the active block il:iu, as in LAPACK's xLAQR5.
+  *
+  * Each pair of \a shifts, given by their sum and their product, introduces a 3x3 bulge at the top of the
+  * block. The bulges are chased down together, three rows apart. The reflectors are applied to a window
+  * of the block enclosing the chain of bulges and accumulated into an orthogonal matrix U, which is then
+  * applied to the rows above and the columns right of the window, and to the Schur vectors, by matrix
+  * products.
+  *
+  * As in xLAQR5, the subdiagonal entries left behind the bulges are deflated as soon as they are negligible, and
+  * a bulge which collapses on such a split is started again from its shifts.
+  */
+template<typename MatrixType>
+void RealSchur<MatrixType>::performMultishiftQRSweep(Index il, Index iu, bool computeU, const ShiftsType& shifts, Scalar* workspace)
+{
+  const Index size = m_matT.cols();
+  const Scalar eps = NumTraits<Scalar>::epsilon();
+  const Scalar smlnum = (std::numeric_limits<Scalar>::min)() * (Scalar(iu-il+1) / eps);
+  const Index nbBulges = shifts.rows();
+  const Index nbReflectors = iu-il;  // reflectors of size 3 at rows il,...,iu-2 and of size 2 at row iu-1
+  const Index nbSteps = nbReflectors + 3*(nbBulges-1);
+  const Index stepsPerWindow = (std::max)(Index(3)*nbBulges, Index(12));
+  WorkMatrixType U;
+
+  for (Index s0 = 0; s0 < nbSteps; s0 += stepsPerWindow)
+  {
+    const Index s1 = (std::min)(s0+stepsPerWindow, nbSteps);
+    const Index ws = (std::max)(il, il + s0 - 3*(nbBulges-1) - 1);
+    const Index we = (std::min)(iu, il + s1 + 2);
+    U.setIdentity(we-ws+1, we-ws+1);
+
+    for (Index s = s0; s < s1; ++s)
+    {
+      // the bulge in front goes first, so that each bulge sees the matrix left by the previous one
+      for (Index b = 0; b < nbBulges && s-3*b >= 0; ++b)
+      {
+        const Index k = s-3*b;
+        if (k >= nbReflectors)
+          continue;
+        const Index g = il+k;
+        Scalar tau, beta;
+        if (g < iu-1)
+        {
+          Matrix<Scalar, 2, 1> ess;
+          if (k == 0)
+          {
+            makeScaledHouseholder(computeBulgeStart(g, shifts, b), ess, tau, beta);
+            if (tau != Scalar(0))
+              applyBulgeReflector(g, ws, we, iu, ess, tau, U, workspace);
+            continue;
+          }
+          makeScaledHouseholder(m_matT.template block<3,1>(g,g-1), ess, tau, beta);
+          if (m_matT.coeff(g+2,g-1) == Scalar(0) && m_matT.coeff(g+2,g) == Scalar(0) && m_matT.coeff(g+2,g+1) != Scalar(0))
+          {
+            // the bulge collapsed: a new one is started at row g from the same shifts, unless the fill it leaves
+            // in column g-1 is not negligible
+            Matrix<Scalar, 2, 1> essNew;
+            Scalar tauNew, betaNew;
+            makeScaledHouseholder(computeBulgeStart(g, shifts, b), essNew, tauNew, betaNew);
+            const Scalar refsum = tauNew * (m_matT.coeff(g,g-1) + essNew.coeff(0) * m_matT.coeff(g+1,g-1));
+            if (internal::abs(m_matT.coeff(g+1,g-1) - refsum * essNew.coeff(0)) + internal::abs(refsum * essNew.coeff(1))
+                <= eps * (internal::abs(m_matT.coeff(g-1,g-1)) + internal::abs(m_matT.coeff(g,g)) + internal::abs(m_matT.coeff(g+1,g+1))))
+            {
+              ess = essNew;
+              tau = tauNew;
+              beta = m_matT.coeff(g,g-1) - refsum;
+            }
+          }
+          m_matT.coeffRef(g,g-1) = beta;
+          m_matT.coeffRef(g+1,g-1) = Scalar(0);
+          m_matT.coeffRef(g+2,g-1) = Scalar(0);
+          if (tau != Scalar(0))
+            applyBulgeReflector(g, ws, we, iu, ess, tau, U, workspace);
+        }
+        else
+        {
+          Matrix<Scalar, 1, 1> ess;
+          makeScaledHouseholder(m_matT.template block<2,1>(g,g-1), ess, tau, beta);
+          m_matT.coeffRef(g,g-1) = beta;
+          m_matT.coeffRef(g+1,g-1) = Scalar(0);
+          if (tau != Scalar(0))
+            applyBulgeReflector(g, ws, we, iu, ess, tau, U, workspace);
+        }
+      }
+
+      // once all the bulges moved, the subdiagonal entries they reduced are final for this step
+      for (Index b = 0; b < nbBulges && s-3*b >= 0; ++b)
+      {
+        const Index k = s-3*b;
+        if (k > 0 && k < nbReflectors)
+          deflateDuringSweep(il+k-1, smlnum);
+      }
+    }
+
+    // apply the accumulated transformation outside of the window; U is banded, so that each panel of its
+    // columns only combines a range of rows
+    const Index w = we-ws+1;
+    const Index panelSize = (w+3)/4;
+    WorkMatrixType top = m_matT.block(0, ws, ws, w), right = m_matT.block(ws, we+1, w, size-we-1), Z;
+    if (computeU)
+      Z = m_matU.middleCols(ws, w);
+    for (Index c0 = 0; c0 < w; c0 += panelSize)
+    {
+      const Index cw = (std::min)(panelSize, w-c0);
+      Index r0 = w, r1 = -1;
+      for (Index j = c0; j < c0+cw; ++j)
+        for (Index i = 0; i < w; ++i)
+          if (U.coeff(i,j) != Scalar(0))
+          {
+            r0 = (std::min)(r0, i);
+            r1 = (std::max)(r1, i);
+          }
+      const Index rw = r1-r0+1;
+      m_matT.block(0, ws+c0, ws, cw).noalias() = top.middleCols(r0, rw) * U.block(r0, c0, rw, cw);
+      m_matT.block(ws+c0, we+1, cw, size-we-1).noalias() = U.block(r0, c0, rw, cw).transpose() * right.middleRows(r0, rw);
+      if (computeU)
+        m_matU.middleCols(ws+c0, cw).noalias() = Z.middleCols(r0, rw) * U.block(r0, c0, rw, cw);
+    }
+  }
+
+  // clean up pollution due to round-off errors
+  for (Index i = il+2; i <= iu; ++i)
+  {
+    m_matT.coeffRef(i,i-2) = Scalar(0);
+    if (i > il+2)
+      m_matT.coeffRef(i,i-3) = Scalar(0);
+  }
+}
+
 } // end namespace Eigen
 
 #endif // EIGEN_REAL_SCHUR_H
@@ -50,6 +50,10 @@ template<typename SolverType,int Size,bool IsComplex> struct direct_selfadjoint_
   *
   * Only the \b lower \b triangular \b part of the input matrix is referenced.
   *
+  * The matrix is first reduced to a real tridiagonal matrix. The eigenvectors of matrices of size
+  * EIGEN_SELFADJOINT_DC_THRESHOLD or more are then computed by divide and conquer, and the others
+  * by implicit QR iterations.
+  *
   * Call the function compute() to compute the eigenvalues and eigenvectors of
   * a given matrix. Alternatively, you can use the
   * SelfAdjointEigenSolver(const MatrixType&, int) constructor which computes
@@ -207,6 +211,53 @@ template<typename _MatrixType> class SelfAdjointEigenSolver
       */
     SelfAdjointEigenSolver& computeDirect(const MatrixType& matrix, int options = ComputeEigenvectors);
 
+    /** \brief Computes a selection of the eigenvalues, and optionally of the eigenvectors, by index
+      *
+      * \param[in]  matrix   Selfadjoint matrix whose eigendecomposition is to
+      *    be computed. Only the lower triangular part of the matrix is referenced.
+      * \param[in]  first    Index of the first selected eigenvalue, the eigenvalues being sorted in
+      *    increasing order.
+      * \param[in]  count    Number of selected eigenvalues.
+      * \param[in]  options  Can be #ComputeEigenvectors (default) or #EigenvaluesOnly.
+      * \returns    Reference to \c *this
+      *
+      * This is a variant of compute(const MatrixType&, int) which only computes the eigenvalues
+      * number \p first to \p first + \p count - 1 in increasing order: eigenvalues() then returns a vector of
+      * size \p count, and eigenvectors() a matrix with \p count columns. For instance, the \c k largest
+      * eigenpairs of a matrix of size \c n are computed by <tt>computeRange(A, n-k, k)</tt>.
+      *
+      * The matrix is first reduced to tridiagonal form, but the orthogonal matrix of this reduction is
+      * not formed. The selected eigenvalues of the tridiagonal matrix are then computed by bisection,
+      * and the corresponding eigenvectors by inverse iteration. These vectors are finally transformed
+      * back by applying the Householder reflectors of the reduction. When \p count is small compared to
+      * the size \f$ n \f$ of the matrix, the cost is dominated by the reduction, that is about
+      * \f$ 4n^3/3 \f$ flops, instead of the \f$ 9n^3 \f$ flops of compute().
+      *
+      * The number of columns of the eigenvectors depends on the selection, so that \p _MatrixType must
+      * have a dynamic number of columns. Since the eigenvectors do not span the whole space,
+      * operatorSqrt() and operatorInverseSqrt() must not be called after this function.
+      *
+      * \sa computeInterval(), compute(const MatrixType&, int)
+      */
+    SelfAdjointEigenSolver& computeRange(const MatrixType& matrix, Index first, Index count, int options = ComputeEigenvectors);
+
+    /** \brief Computes the eigenvalues, and optionally the eigenvectors, within an interval
+      *
+      * \param[in]  matrix   Selfadjoint matrix whose eigendecomposition is to
+      *    be computed. Only the lower triangular part of the matrix is referenced.
+      * \param[in]  lower    Lower bound of the interval.
+      * \param[in]  upper    Upper bound of the interval.
+      * \param[in]  options  Can be #ComputeEigenvectors (default) or #EigenvaluesOnly.
+      * \returns    Reference to \c *this
+      *
+      * This is a variant of computeRange() which selects the eigenvalues \f$ \lambda \f$ such that
+      * \f$ lower \leq \lambda < upper \f$. The number of selected eigenvalues is given by the size of
+      * eigenvalues(), and may be zero.
+      *
+      * \sa computeRange()
+      */
+    SelfAdjointEigenSolver& computeInterval(const MatrixType& matrix, RealScalar lower, RealScalar upper, int options = ComputeEigenvectors);
+
     /** \brief Returns the eigenvectors of given matrix.
       *
       * \returns  A const reference to the matrix whose columns are the eigenvectors.
@@ -351,6 +402,10 @@ template<typename _MatrixType> class SelfAdjointEigenSolver
     #endif // EIGEN2_SUPPORT
 
   protected:
+    SelfAdjointEigenSolver& computeSelected(const MatrixType& matrix, bool byIndex, Index first, Index count,
+                                            RealScalar lower, RealScalar upper, int options);
+
+
     MatrixType m_eivec;
     RealVectorType m_eivalues;
     typename TridiagonalizationType::SubDiagonalType m_subdiag;
@@ -378,6 +433,19 @@ template<typename _MatrixType> class SelfAdjointEigenSolver
 namespace internal {
 template<int StorageOrder,typename RealScalar, typename Scalar, typename Index>
 static void tridiagonal_qr_step(RealScalar* diag, RealScalar* subdiag, Index start, Index end, Scalar* matrixQ, Index n);
+template<int StorageOrder,typename RealScalar, typename Scalar, typename Index>
+static ComputationInfo tridiagonal_qr(RealScalar* diag, RealScalar* subdiag, Index n, Index maxIterations, Scalar* matrixQ);
+template<typename RealScalar, typename Index>
+static ComputationInfo tridiagonal_divide_and_conquer(RealScalar* diag, RealScalar* subdiag, Index n, Index maxIterations,
+                                                      Matrix<RealScalar,Dynamic,Dynamic>& eivec);
+template<typename RealScalar, typename Index>
+static Index tridiagonal_sturm_count(const RealScalar* diag, const RealScalar* subdiag2, Index n, RealScalar x, RealScalar pivmin);
+template<typename RealScalar, typename Index>
+static RealScalar tridiagonal_bisection(const RealScalar* diag, const RealScalar* subdiag2, Index n, Index k,
+                                        RealScalar lower, RealScalar upper, RealScalar pivmin);
+template<typename RealScalar, typename Index>
+static bool tridiagonal_inverse_iteration(const RealScalar* diag, const RealScalar* subdiag, Index n,
+                                          const RealScalar* eivalues, Index k, Matrix<RealScalar,Dynamic,Dynamic>& eivec);
 }
 
 template<typename MatrixType>
@@ -413,40 +481,18 @@ SelfAdjointEigenSolver<MatrixType>& SelfAdjointEigenSolver<MatrixType>
   mat = matrix / scale;
   m_subdiag.resize(n-1);
   internal::tridiagonalization_inplace(mat, diag, m_subdiag, computeEigenvectors);
-  
-  Index end = n-1;
-  Index start = 0;
-  Index iter = 0; // total number of iterations
 
-  while (end>0)
+  if(computeEigenvectors && n>=EIGEN_SELFADJOINT_DC_THRESHOLD)
   {
-    for (Index i = start; i<end; ++i)
-      if (internal::isMuchSmallerThan(internal::abs(m_subdiag[i]),(internal::abs(diag[i])+internal::abs(diag[i+1]))))
-        m_subdiag[i] = 0;
-
-    // find the largest unreduced block
-    while (end>0 && m_subdiag[end-1]==0)
-    {
-      end--;
-    }
-    if (end<=0)
-      break;
-
-    // if we spent too many iterations, we give up
-    iter++;
-    if(iter > m_maxIterations * n) break;
-
-    start = end - 1;
-    while (start>0 && m_subdiag[start-1]!=0)
-      start--;
-
-    internal::tridiagonal_qr_step<MatrixType::Flags&RowMajorBit ? RowMajor : ColMajor>(diag.data(), m_subdiag.data(), start, end, computeEigenvectors ? m_eivec.data() : (Scalar*)0, n);
+    // the eigenvectors of the tridiagonal matrix are real, and are applied to Q at once
+    Matrix<RealScalar,Dynamic,Dynamic> eivecT;
+    m_info = internal::tridiagonal_divide_and_conquer(diag.data(), m_subdiag.data(), n, Index(m_maxIterations), eivecT);
+    if(m_info==Success)
+      m_eivec = m_eivec * eivecT;
   }
-
-  if (iter <= m_maxIterations * n)
-    m_info = Success;
   else
-    m_info = NoConvergence;
+    m_info = internal::tridiagonal_qr<MatrixType::Flags&RowMajorBit ? RowMajor : ColMajor>
+               (diag.data(), m_subdiag.data(), n, Index(m_maxIterations), computeEigenvectors ? m_eivec.data() : (Scalar*)0);
 
   // Sort eigenvalues and corresponding vectors.
   // TODO make the sort optional ?
@@ -474,6 +520,104 @@ SelfAdjointEigenSolver<MatrixType>& SelfAdjointEigenSolver<MatrixType>
   return *this;
 }
 
+template<typename MatrixType>
+SelfAdjointEigenSolver<MatrixType>& SelfAdjointEigenSolver<MatrixType>
+::computeRange(const MatrixType& matrix, Index first, Index count, int options)
+{
+  eigen_assert(first>=0 && count>=0 && first+count<=matrix.cols() && "invalid eigenvalue range");
+  return computeSelected(matrix, true, first, count, RealScalar(0), RealScalar(0), options);
+}
+
+template<typename MatrixType>
+SelfAdjointEigenSolver<MatrixType>& SelfAdjointEigenSolver<MatrixType>
+::computeInterval(const MatrixType& matrix, RealScalar lower, RealScalar upper, int options)
+{
+  return computeSelected(matrix, false, 0, 0, lower, upper, options);
+}
+
+template<typename MatrixType>
+SelfAdjointEigenSolver<MatrixType>& SelfAdjointEigenSolver<MatrixType>
+::computeSelected(const MatrixType& matrix, bool byIndex, Index first, Index count,
+                  RealScalar lower, RealScalar upper, int options)
+{
+  typedef Matrix<RealScalar,Dynamic,1> RealVector;
+  eigen_assert(matrix.cols() == matrix.rows());
+  eigen_assert((options&~(EigVecMask|GenEigMask))==0
+          && (options&EigVecMask)!=EigVecMask
+          && "invalid option parameter");
+  bool computeEigenvectors = (options&ComputeEigenvectors)==ComputeEigenvectors;
+  bool converged = true;
+  Index n = matrix.cols();
+
+  if(n==0)
+  {
+    m_eivalues.resize(0);
+    if(computeEigenvectors)
+      m_eivec.resize(0,0);
+    m_info = Success;
+    m_isInitialized = true;
+    m_eigenvectorsOk = computeEigenvectors;
+    return *this;
+  }
+
+  // map the matrix coefficients to [-1:1] to avoid over- and underflow.
+  RealScalar scale = matrix.cwiseAbs().maxCoeff();
+  if(scale==RealScalar(0)) scale = RealScalar(1);
+  MatrixType mat = matrix / scale;
+  // the Householder reflectors are kept in packed form, they are only applied to the selected eigenvectors
+  typename TridiagonalizationType::CoeffVectorType hCoeffs(n-1);
+  internal::tridiagonalization_inplace(mat, hCoeffs);
+  RealVector diag = mat.diagonal().real();
+  m_subdiag = mat.template diagonal<-1>().real();
+
+  // Gershgorin bounds of the spectrum, and smallest pivot of the Sturm sequences
+  RealVector subdiag2 = m_subdiag.cwiseAbs2();
+  RealScalar pivmin = RealScalar(1), gl = diag.coeff(0), gu = diag.coeff(0);
+  for(Index i=0; i<n; ++i)
+  {
+    RealScalar radius = RealScalar(0);
+    if(i>0)   radius += internal::abs(m_subdiag.coeff(i-1));
+    if(i<n-1) radius += internal::abs(m_subdiag.coeff(i));
+    gl = (std::min)(gl, diag.coeff(i)-radius);
+    gu = (std::max)(gu, diag.coeff(i)+radius);
+    if(i<n-1) pivmin = (std::max)(pivmin, subdiag2.coeff(i));
+  }
+  pivmin *= (std::numeric_limits<RealScalar>::min)();
+  RealScalar margin = RealScalar(2)*RealScalar(n)*NumTraits<RealScalar>::epsilon()*(std::max)(internal::abs(gl),internal::abs(gu))
+                    + RealScalar(2)*pivmin;
+  gl -= margin;
+  gu += margin;
+
+  if(!byIndex)
+  {
+    first = internal::tridiagonal_sturm_count(diag.data(), subdiag2.data(), n, lower/scale, pivmin);
+    count = upper>lower ? internal::tridiagonal_sturm_count(diag.data(), subdiag2.data(), n, upper/scale, pivmin) - first : 0;
+    count = (std::max)(count, Index(0));
+  }
+
+  m_eivalues.resize(count);
+  for(Index k=0; k<count; ++k)
+    m_eivalues.coeffRef(k) = internal::tridiagonal_bisection(diag.data(), subdiag2.data(), n, first+k, gl, gu, pivmin);
+
+  if(computeEigenvectors)
+  {
+    Matrix<RealScalar,Dynamic,Dynamic> eivecT;
+    converged = internal::tridiagonal_inverse_iteration(diag.data(), m_subdiag.data(), n, m_eivalues.data(), count, eivecT);
+    m_eivec = eivecT.template cast<Scalar>();
+    m_eivec.applyOnTheLeft(typename TridiagonalizationType::HouseholderSequenceType(mat, hCoeffs.conjugate())
+                           .setLength(n-1)
+                           .setShift(1));
+  }
+
+  // scale back the eigen values
+  m_eivalues *= scale;
+
+  m_info = converged ? Success : NoConvergence;
+  m_isInitialized = true;
+  m_eigenvectorsOk = computeEigenvectors;
+  return *this;
+}
+
 
 namespace internal {
   
@@ -791,6 +935,514 @@ static void tridiagonal_qr_step(RealScalar* diag, RealScalar* subdiag, Index sta
   }
 }
 
+/** \internal
+  * Diagonalizes the real symmetric tridiagonal matrix of diagonal \a diag and subdiagonal \a subdiag
+  * of size \a n by implicit QR iterations, and applies the rotations to the columns of the n x n matrix
+  * \a matrixQ if it is not null. The eigenvalues are left unsorted in \a diag.
+  */
+template<int StorageOrder,typename RealScalar, typename Scalar, typename Index>
+static ComputationInfo tridiagonal_qr(RealScalar* diag, RealScalar* subdiag, Index n, Index maxIterations, Scalar* matrixQ)
+{
+  Index end = n-1;
+  Index start = 0;
+  Index iter = 0; // total number of iterations
+
+  while (end>0)
+  {
+    for (Index i = start; i<end; ++i)
+      if (isMuchSmallerThan(abs(subdiag[i]),(abs(diag[i])+abs(diag[i+1]))))
+        subdiag[i] = 0;
+
+    // find the largest unreduced block
+    while (end>0 && subdiag[end-1]==0)
+    {
+      end--;
+    }
+    if (end<=0)
+      break;
+
+    // if we spent too many iterations, we give up
+    iter++;
+    if(iter > maxIterations * n) break;
+
+    start = end - 1;
+    while (start>0 && subdiag[start-1]!=0)
+      start--;
+
+    tridiagonal_qr_step<StorageOrder>(diag, subdiag, start, end, matrixQ, n);
+  }
+
+  return iter <= maxIterations * n ? Success : NoConvergence;
+}
+
+/** \internal Orders indices by increasing values. */
+template<typename RealScalar, typename Index> struct tridiagonal_dc_less
+{
+  tridiagonal_dc_less(const RealScalar* values) : m_values(values) {}
+  bool operator()(Index a, Index b) const { return m_values[a] < m_values[b]; }
+  const RealScalar* m_values;
+};
+
+/** \internal
+  * Computes the root of index \a j of the secular equation \f$ 1/\rho + \sum_i z_i^2 / (d_i - \lambda) = 0 \f$,
+  * where the \f$ d_i \f$ are increasing and \f$ \rho > 0 \f$, and stores the differences \f$ d_i - \lambda_j \f$ in
+  * \a delta. The root is searched relatively to its closest pole, and is refined by the two poles rational
+  * approximation of LAPACK's xLAED4 safeguarded by bisection.
+  */
+template<typename RealVector, typename DeltaType>
+static typename RealVector::Scalar tridiagonal_dc_secular_root(const RealVector& d, const RealVector& z, typename RealVector::Scalar rho,
+                                                               typename RealVector::Index j, DeltaType& delta)
+{
+  typedef typename RealVector::Scalar RealScalar;
+  typedef typename RealVector::Index Index;
+  const Index k = d.size();
+  const RealScalar eps = NumTraits<RealScalar>::epsilon();
+  const RealScalar rhoInv = RealScalar(1)/rho;
+
+  // find the closest pole, relatively to which the differences d_i - lambda are accurate
+  Index origin = j;
+  RealScalar lo = 0, hi;
+  if(j<k-1)
+  {
+    RealScalar mid = (d.coeff(j+1)-d.coeff(j))/RealScalar(2);
+    RealScalar g = rhoInv;
+    for(Index i=0; i<k; ++i)
+      g += z.coeff(i)*z.coeff(i) / ((d.coeff(i)-d.coeff(j)) - mid);
+    if(g>=0)
+      hi = mid;
+    else
+    {
+      origin = j+1;
+      lo = -mid;
+      hi = 0;
+    }
+  }
+  else
+    hi = rho*z.squaredNorm();
+
+  for(Index i=0; i<k; ++i)
+    delta.coeffRef(i) = d.coeff(i) - d.coeff(origin);
+
+  RealScalar mu = (lo+hi)/RealScalar(2);
+  for(Index iter=0; iter<100; ++iter)
+  {
+    RealScalar psi = 0, phi = 0, dpsi = 0, dphi = 0, err = 0;
+    for(Index i=0; i<k; ++i)
+    {
+      RealScalar t = z.coeff(i) / (delta.coeff(i) - mu);
+      if(i<=j) { psi += z.coeff(i)*t; dpsi += t*t; }
+      else     { phi += z.coeff(i)*t; dphi += t*t; }
+      err += abs(z.coeff(i)*t);
+    }
+    RealScalar g = rhoInv + psi + phi;
+    if(abs(g) <= RealScalar(8)*eps*(rhoInv + err + abs(mu)*(dpsi+dphi)))
+      break;
+    if(g<0) lo = mu;
+    else    hi = mu;
+
+    // zero of the rational function c + s/(delta_j-x) + S/(delta_j+1-x) matching g and its derivatives
+    RealScalar eta;
+    RealScalar d1 = delta.coeff(j) - mu;
+    if(j<k-1)
+    {
+      RealScalar d2 = delta.coeff(j+1) - mu;
+      RealScalar c = g - d1*dpsi - d2*dphi;
+      RealScalar a = c*(d1+d2) + d1*d1*dpsi + d2*d2*dphi;
+      RealScalar b = g*d1*d2;
+      RealScalar disc = sqrt((std::max)(RealScalar(0), a*a - RealScalar(4)*b*c));
+      if(c==0)      eta = b/a;
+      else if(a<=0) eta = (a-disc)/(RealScalar(2)*c);
+      else          eta = RealScalar(2)*b/(a+disc);
+    }
+    else
+    {
+      RealScalar c = g - d1*dpsi;
+      eta = d1 + d1*d1*dpsi/c;
+    }
+
+    RealScalar next = mu + eta;
+    if(!(next>lo && next<hi))
+      next = (lo+hi)/RealScalar(2);
+    if(next==mu)
+      break;
+    mu = next;
+  }
+
+  for(Index i=0; i<k; ++i)
+    delta.coeffRef(i) -= mu;
+  return d.coeff(origin) + mu;
+}
+
+/** \internal
+  * Computes the eigen decomposition of \f$ D + \rho z z^T \f$, where \a diag holds the diagonal of \f$ D \f$
+  * whose first \a m and last n-m coefficients are increasing, and updates the eigenvectors \a eivec of the
+  * block diagonal matrix whose first \a m rows are only spanned by the first m columns.
+  *
+  * The eigenvalues which are close to a coefficient of \f$ D \f$ are first deflated. The eigenvectors of the
+  * remaining k eigenvalues are computed from the recomputed \f$ z \f$ of Gu and Eisenstat, and are applied
+  * to the first and last rows of \a eivec by two matrix products, which skip the columns known to be zero.
+  */
+template<typename RealScalar, typename Index>
+static void tridiagonal_dc_merge(RealScalar* diag, Matrix<RealScalar,Dynamic,1>& z, RealScalar rho, Index m,
+                                 Matrix<RealScalar,Dynamic,Dynamic>& eivec)
+{
+  typedef Matrix<RealScalar,Dynamic,Dynamic> RealMatrix;
+  typedef Matrix<RealScalar,Dynamic,1> RealVector;
+  typedef Matrix<Index,Dynamic,1> IndexVector;
+  const Index n = eivec.rows();
+
+  // sort the two halves of the diagonal together
+  IndexVector perm(n);
+  for(Index i=0, i1=0, i2=m; i<n; ++i)
+    perm.coeffRef(i) = (i2==n || (i1<m && diag[i1]<=diag[i2])) ? i1++ : i2++;
+
+  RealScalar dmax = 0;
+  for(Index i=0; i<n; ++i)
+    dmax = (std::max)(dmax, abs(diag[i]));
+  const RealScalar tol = RealScalar(8)*NumTraits<RealScalar>::epsilon()*(std::max)(dmax, z.cwiseAbs().maxCoeff());
+
+  // deflate the small components of z, and the close coefficients of D by a rotation zeroing one of
+  // their components of z. The columns of eivec are 0 when they only span the first m rows, 1 when they
+  // span all the rows, and 2 when they only span the last rows.
+  Matrix<int,Dynamic,1> colType(n);
+  for(Index i=0; i<n; ++i)
+    colType.coeffRef(i) = i<m ? 0 : 2;
+  IndexVector nondeflated(n), deflated(n);
+  Index k = 0, nd = 0, pj = -1;
+  for(Index t=0; t<n; ++t)
+  {
+    Index j = perm.coeff(t);
+    if(rho*abs(z.coeff(j)) <= tol)
+    {
+      deflated.coeffRef(nd++) = j;
+      continue;
+    }
+    if(pj<0)
+    {
+      pj = j;
+      continue;
+    }
+    RealScalar s = z.coeff(pj), c = z.coeff(j);
+    RealScalar tau = hypot(c,s);
+    c /= tau;
+    s = -s/tau;
+    if(abs((diag[j]-diag[pj])*c*s) <= tol)
+    {
+      z.coeffRef(j) = tau;
+      z.coeffRef(pj) = 0;
+      RealVector colp = eivec.col(pj);
+      eivec.col(pj) = c*colp + s*eivec.col(j);
+      eivec.col(j) = c*eivec.col(j) - s*colp;
+      if(colType.coeff(pj)!=colType.coeff(j))
+        colType.coeffRef(j) = 1;
+      RealScalar dp = diag[pj]*c*c + diag[j]*s*s;
+      diag[j] = diag[pj]*s*s + diag[j]*c*c;
+      diag[pj] = dp;
+      deflated.coeffRef(nd++) = pj;
+    }
+    else
+      nondeflated.coeffRef(k++) = pj;
+    pj = j;
+  }
+  if(pj>=0)
+    nondeflated.coeffRef(k++) = pj;
+
+  // solve the secular equation of the remaining eigenvalues
+  RealVector d(k), zk(k), lambda(k);
+  for(Index i=0; i<k; ++i)
+  {
+    d.coeffRef(i) = diag[nondeflated.coeff(i)];
+    zk.coeffRef(i) = z.coeff(nondeflated.coeff(i));
+  }
+  RealMatrix delta(k,k);
+  for(Index j=0; j<k; ++j)
+  {
+    typename RealMatrix::ColXpr deltaj = delta.col(j);
+    lambda.coeffRef(j) = tridiagonal_dc_secular_root(d, zk, rho, j, deltaj);
+  }
+
+  // recompute z from the computed eigenvalues, such that the eigenvectors are numerically orthogonal
+  RealMatrix U(k,k);
+  for(Index i=0; i<k; ++i)
+  {
+    RealScalar zi2 = -delta.coeff(i,i);
+    for(Index j=0; j<k; ++j)
+      if(j!=i)
+        zi2 *= delta.coeff(i,j) / (d.coeff(i)-d.coeff(j));
+    RealScalar zi = sqrt(abs(zi2)/rho);
+    if(zk.coeff(i)<0)
+      zi = -zi;
+    for(Index j=0; j<k; ++j)
+      U.coeffRef(i,j) = zi / delta.coeff(i,j);
+  }
+  for(Index j=0; j<k; ++j)
+    U.col(j).normalize();
+
+  // group the nondeflated columns by type, and apply U to the rows they span
+  Index counts[3] = {0, 0, 0};
+  for(Index i=0; i<k; ++i)
+    ++counts[colType.coeff(nondeflated.coeff(i))];
+  Index offsets[3] = {0, counts[0], counts[0]+counts[1]};
+  RealMatrix Q(n,k), Ug(k,k);
+  for(Index i=0; i<k; ++i)
+  {
+    Index g = offsets[colType.coeff(nondeflated.coeff(i))]++;
+    Q.col(g) = eivec.col(nondeflated.coeff(i));
+    Ug.row(g) = U.row(i);
+  }
+  RealMatrix V(n,k);
+  V.topRows(m).noalias() = Q.topLeftCorner(m,counts[0]+counts[1]) * Ug.topRows(counts[0]+counts[1]);
+  V.bottomRows(n-m).noalias() = Q.bottomRightCorner(n-m,counts[1]+counts[2]) * Ug.bottomRows(counts[1]+counts[2]);
+
+  // gather the eigenvalues and eigenvectors by increasing eigenvalues
+  RealVector values(n);
+  values.head(k) = lambda;
+  for(Index i=0; i<nd; ++i)
+    values.coeffRef(k+i) = diag[deflated.coeff(i)];
+  IndexVector order(n);
+  for(Index i=0; i<n; ++i)
+    order.coeffRef(i) = i;
+  std::sort(order.data(), order.data()+n, tridiagonal_dc_less<RealScalar,Index>(values.data()));
+  RealMatrix result(n,n);
+  for(Index i=0; i<n; ++i)
+  {
+    Index o = order.coeff(i);
+    diag[i] = values.coeff(o);
+    if(o<k) result.col(i) = V.col(o);
+    else    result.col(i) = eivec.col(deflated.coeff(o-k));
+  }
+  eivec.swap(result);
+}
+
+/** \internal
+  * Computes the eigenvalues and eigenvectors of the real symmetric tridiagonal matrix of diagonal \a diag
+  * and subdiagonal \a subdiag of size \a n by Cuppen's divide and conquer method.
+  *
+  * The matrix is split in halves modified by a rank one correction, whose eigen decompositions are computed
+  * recursively and then merged by tridiagonal_dc_merge(). Matrices of 32 rows or less are diagonalized by
+  * tridiagonal_qr(). On output, \a diag holds the eigenvalues in increasing order, and \a eivec the
+  * corresponding eigenvectors.
+  */
+template<typename RealScalar, typename Index>
+static ComputationInfo tridiagonal_divide_and_conquer(RealScalar* diag, RealScalar* subdiag, Index n, Index maxIterations,
+                                                      Matrix<RealScalar,Dynamic,Dynamic>& eivec)
+{
+  typedef Matrix<RealScalar,Dynamic,Dynamic> RealMatrix;
+  typedef Matrix<RealScalar,Dynamic,1> RealVector;
+
+  if(n<=32)
+  {
+    eivec.setIdentity(n,n);
+    ComputationInfo info = tridiagonal_qr<ColMajor>(diag, subdiag, n, maxIterations, eivec.data());
+    if(info!=Success)
+      return info;
+    for(Index i=0; i<n-1; ++i)
+    {
+      Index k = i;
+      for(Index j=i+1; j<n; ++j)
+        if(diag[j]<diag[k])
+          k = j;
+      if(k!=i)
+      {
+        std::swap(diag[i], diag[k]);
+        eivec.col(i).swap(eivec.col(k));
+      }
+    }
+    return Success;
+  }
+
+  // T = diag(T1,T2) + |beta| u u^T where u = e_m-1 + sign(beta) e_m
+  const Index m = n/2;
+  const RealScalar beta = subdiag[m-1];
+  diag[m-1] -= abs(beta);
+  diag[m]   -= abs(beta);
+
+  RealMatrix Q1, Q2;
+  ComputationInfo info = tridiagonal_divide_and_conquer(diag, subdiag, m, maxIterations, Q1);
+  if(info!=Success)
+    return info;
+  info = tridiagonal_divide_and_conquer(diag+m, subdiag+m, n-m, maxIterations, Q2);
+  if(info!=Success)
+    return info;
+
+  // z = Q^T u / sqrt(2) has a unit norm
+  const RealScalar invSqrt2 = RealScalar(1)/sqrt(RealScalar(2));
+  RealVector z(n);
+  z.head(m) = invSqrt2 * Q1.row(m-1).transpose();
+  z.tail(n-m) = (beta<0 ? -invSqrt2 : invSqrt2) * Q2.row(0).transpose();
+
+  eivec.setZero(n,n);
+  eivec.topLeftCorner(m,m) = Q1;
+  eivec.bottomRightCorner(n-m,n-m) = Q2;
+  tridiagonal_dc_merge(diag, z, RealScalar(2)*abs(beta), m, eivec);
+  return Success;
+}
+
+/** \internal
+  * \returns the number of eigenvalues smaller than \a x of the real symmetric tridiagonal matrix of diagonal
+  * \a diag and squared subdiagonal \a subdiag2, that is the number of negative pivots of the LDL^T
+  * factorization of T - x I. Pivots smaller than \a pivmin in magnitude are replaced by -\a pivmin.
+  */
+template<typename RealScalar, typename Index>
+static Index tridiagonal_sturm_count(const RealScalar* diag, const RealScalar* subdiag2, Index n, RealScalar x, RealScalar pivmin)
+{
+  Index count = 0;
+  RealScalar q = diag[0] - x;
+  for(Index i=1; ; ++i)
+  {
+    if(abs(q)<=pivmin) q = -pivmin;
+    if(q<RealScalar(0)) ++count;
+    if(i==n) break;
+    q = diag[i] - x - subdiag2[i-1]/q;
+  }
+  return count;
+}
+
+/** \internal
+  * \returns the eigenvalue number \a k, in increasing order, of the real symmetric tridiagonal matrix of
+  * diagonal \a diag and squared subdiagonal \a subdiag2, computed by bisection of the interval
+  * [\a lower, \a upper] which must contain it.
+  */
+template<typename RealScalar, typename Index>
+static RealScalar tridiagonal_bisection(const RealScalar* diag, const RealScalar* subdiag2, Index n, Index k,
+                                        RealScalar lower, RealScalar upper, RealScalar pivmin)
+{
+  const RealScalar eps = NumTraits<RealScalar>::epsilon();
+  while(upper-lower > RealScalar(2)*eps*(std::max)(abs(lower),abs(upper)) + pivmin)
+  {
+    RealScalar mid = RealScalar(0.5)*(lower+upper);
+    if(mid<=lower || mid>=upper)
+      break;
+    if(tridiagonal_sturm_count(diag, subdiag2, n, mid, pivmin)>k)
+      upper = mid;
+    else
+      lower = mid;
+  }
+  return RealScalar(0.5)*(lower+upper);
+}
+
+/** \internal
+  * Computes in the columns of \a eivec the eigenvectors of the real symmetric tridiagonal matrix of diagonal
+  * \a diag and subdiagonal \a subdiag associated to the \a k eigenvalues \a eivalues sorted in increasing
+  * order, by inverse iteration.
+  *
+  * As in LAPACK's xSTEIN, T - lambda I is factorized by Gaussian elimination with partial pivoting, and the
+  * vectors of eigenvalues closer than 1e-3 times the norm of T are orthogonalized against each other at
+  * each iteration. The starting vectors are pseudo random, so that the result does not depend on rand().
+  * A vector has converged once the solution grows above sqrt(0.1/n) times the scaled right-hand side, and
+  * two more iterations are done after that.
+  *
+  * \returns false if some vector did not converge within 5 iterations.
+  */
+template<typename RealScalar, typename Index>
+static bool tridiagonal_inverse_iteration(const RealScalar* diag, const RealScalar* subdiag, Index n,
+                                          const RealScalar* eivalues, Index k, Matrix<RealScalar,Dynamic,Dynamic>& eivec)
+{
+  typedef Matrix<RealScalar,Dynamic,1> RealVector;
+  const RealScalar eps = NumTraits<RealScalar>::epsilon();
+  eivec.resize(n,k);
+  if(n==1)
+  {
+    eivec.setOnes();
+    return true;
+  }
+
+  RealScalar norm = RealScalar(0);
+  for(Index i=0; i<n; ++i)
+    norm = (std::max)(norm, abs(diag[i]) + (i>0 ? abs(subdiag[i-1]) : RealScalar(0)) + (i<n-1 ? abs(subdiag[i]) : RealScalar(0)));
+  if(norm==RealScalar(0))
+    norm = RealScalar(1);
+  const RealScalar tiny = eps*norm;
+  const RealScalar ortol = RealScalar(1e-3)*norm;
+
+  // U has two superdiagonals u1 and u2, L is unit with multipliers l, applied after swapping rows i and i+1 if swapped(i)
+  RealVector u0(n), u1(n), u2(n), l(n), x(n);
+  Matrix<bool,Dynamic,1> swapped(n);
+  unsigned int seed = 1;
+  Index clusterStart = 0;
+  RealScalar shift = RealScalar(0);
+  const RealScalar growth = sqrt(RealScalar(0.1)/RealScalar(n));
+  bool converged = true;
+
+  for(Index j=0; j<k; ++j)
+  {
+    // perturb equal eigenvalues so that the shifted matrices differ
+    RealScalar previous = shift;
+    shift = eivalues[j];
+    if(j>0 && shift-previous<RealScalar(10)*tiny)
+      shift = previous + RealScalar(10)*tiny;
+    if(j==0 || shift-previous>ortol)
+      clusterStart = j;
+
+    for(Index i=0; i<n; ++i)
+    {
+      u0.coeffRef(i) = diag[i] - shift;
+      u1.coeffRef(i) = i<n-1 ? subdiag[i] : RealScalar(0);
+      u2.coeffRef(i) = RealScalar(0);
+    }
+    for(Index i=0; i<n-1; ++i)
+    {
+      RealScalar e = subdiag[i];
+      swapped.coeffRef(i) = abs(u0.coeff(i))<abs(e);
+      if(!swapped.coeff(i))
+      {
+        if(u0.coeff(i)==RealScalar(0))
+          u0.coeffRef(i) = tiny;
+        l.coeffRef(i) = e/u0.coeff(i);
+        u0.coeffRef(i+1) -= l.coeff(i)*u1.coeff(i);
+      }
+      else
+      {
+        l.coeffRef(i) = u0.coeff(i)/e;
+        u0.coeffRef(i) = e;
+        RealScalar t = u1.coeff(i);
+        u1.coeffRef(i) = u0.coeff(i+1);
+        u0.coeffRef(i+1) = t - l.coeff(i)*u1.coeff(i);
+        u2.coeffRef(i) = u1.coeff(i+1);
+        u1.coeffRef(i+1) = -l.coeff(i)*u2.coeff(i);
+      }
+    }
+    for(Index i=0; i<n; ++i)
+      if(abs(u0.coeff(i))<tiny)
+        u0.coeffRef(i) = u0.coeff(i)<RealScalar(0) ? -tiny : tiny;
+
+    for(Index i=0; i<n; ++i)
+    {
+      seed = seed*1103515245u + 12345u;
+      x.coeffRef(i) = RealScalar(int((seed>>16)&0x7fff))/RealScalar(16384) - RealScalar(1);
+    }
+
+    // as in xSTEIN, the right-hand side is scaled so that a converged solution is large, and its growth is checked
+    const RealScalar scale = RealScalar(n)*norm*(std::max)(eps, abs(u0.coeff(n-1)));
+    int checks = 0;
+    for(int iter=0; iter<5 && checks<3; ++iter)
+    {
+      x *= scale/x.cwiseAbs().maxCoeff();
+      for(Index i=0; i<n-1; ++i)
+      {
+        if(swapped.coeff(i))
+          std::swap(x.coeffRef(i), x.coeffRef(i+1));
+        x.coeffRef(i+1) -= l.coeff(i)*x.coeff(i);
+      }
+      for(Index i=n-1; i>=0; --i)
+      {
+        RealScalar t = x.coeff(i);
+        if(i+1<n) t -= u1.coeff(i)*x.coeff(i+1);
+        if(i+2<n) t -= u2.coeff(i)*x.coeff(i+2);
+        x.coeffRef(i) = t/u0.coeff(i);
+      }
+      for(Index i=clusterStart; i<j; ++i)
+        x -= eivec.col(i).dot(x) * eivec.col(i);
+      if(x.cwiseAbs().maxCoeff()>=growth)
+        ++checks;
+    }
+    if(checks<3)
+      converged = false;
+    eivec.col(j) = x.normalized();
+  }
+  return converged;
+}
+
 } // end namespace internal
 
 } // end namespace Eigen
@@ -24,6 +24,8 @@ struct traits<TridiagonalizationMatrixTReturnType<MatrixType> >
 
 template<typename MatrixType, typename CoeffVectorType>
 void tridiagonalization_inplace(MatrixType& matA, CoeffVectorType& hCoeffs);
+template<typename MatrixType, typename CoeffVectorType>
+void tridiagonalization_inplace_blocked(MatrixType& matA, CoeffVectorType& hCoeffs);
 }
 
 /** \eigenvalues_module \ingroup Eigenvalues_Module
@@ -338,12 +340,23 @@ namespace internal {
   * \f$ v_i \f$ is the Householder vector defined by
   *       \f$ v_i = [ 0, \ldots, 0, 1, matA(i+2,i), \ldots, matA(N-1,i) ]^T \f$.
   *
-  * Implemented from Golub's "Matrix Computations", algorithm 8.3.1.
+  * Implemented from Golub's "Matrix Computations", algorithm 8.3.1, with the
+  * block reduction of LAPACK's xSYTRD for large matrices.
   *
   * \sa Tridiagonalization::packedMatrix()
   */
 template<typename MatrixType, typename CoeffVectorType>
 void tridiagonalization_inplace(MatrixType& matA, CoeffVectorType& hCoeffs)
+{
+  tridiagonalization_inplace_blocked(matA, hCoeffs);
+}
+
+/** \internal
+  * Unblocked version of tridiagonalization_inplace(), which does one selfadjoint matrix-vector product
+  * and one rank-2 update per column.
+  */
+template<typename MatrixType, typename CoeffVectorType>
+void tridiagonalization_inplace_unblocked(MatrixType& matA, CoeffVectorType& hCoeffs)
 {
   typedef typename MatrixType::Index Index;
   typedef typename MatrixType::Scalar Scalar;
@@ -376,6 +389,84 @@ void tridiagonalization_inplace(MatrixType& matA, CoeffVectorType& hCoeffs)
   }
 }
 
+/** \internal
+  * Blocked version of tridiagonalization_inplace().
+  *
+  * The columns are reduced by panels of \c bs columns, whose reflectors \f$ V \f$ are accumulated together
+  * with \f$ W \f$ such that the trailing matrix is updated once per panel as \f$ A -= V W^* + W V^* \f$.
+  * This halves the number of passes over the trailing matrix, and does half of the flops through matrix-matrix
+  * products. The last columns are reduced by tridiagonalization_inplace_unblocked().
+  */
+template<typename MatrixType, typename CoeffVectorType>
+void tridiagonalization_inplace_blocked(MatrixType& matA, CoeffVectorType& hCoeffs)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::RealScalar RealScalar;
+  typedef Matrix<Scalar,Dynamic,Dynamic,ColMajor> WorkMatrixType;
+  typedef Matrix<Scalar,Dynamic,1> WorkVectorType;
+  Index n = matA.rows();
+  eigen_assert(n==matA.cols());
+  eigen_assert(n==hCoeffs.size()+1 || n==1);
+
+  const Index blockSize = 32;
+  Index k = 0;
+  if(n>=4*blockSize)
+  {
+    WorkMatrixType W(n, blockSize);
+    WorkVectorType tmp(blockSize), betas(blockSize);
+    for(; n-k>2*blockSize; k+=blockSize)
+    {
+      const Index bs = blockSize;
+      for(Index i=0; i<bs; ++i)
+      {
+        const Index c = k+i;
+        const Index remainingSize = n-c-1;
+
+        // update the current column with the previous reflectors of the panel
+        if(i>0)
+        {
+          matA.col(c).tail(n-c).noalias() -= matA.block(c,k,n-c,i) * W.row(c-k).head(i).adjoint();
+          matA.col(c).tail(n-c).noalias() -= W.block(c-k,0,n-c,i) * matA.row(c).segment(k,i).adjoint();
+        }
+
+        RealScalar beta;
+        Scalar h;
+        matA.col(c).tail(remainingSize).makeHouseholderInPlace(h, beta);
+        matA.col(c).coeffRef(c+1) = 1;
+        betas.coeffRef(i) = beta;
+        hCoeffs.coeffRef(c) = h;
+
+        // w = conj(h) (A - V W^* - W V^*) v, where A is the trailing matrix which is not updated yet
+        Block<MatrixType,Dynamic,1> v(matA, c+1, c, remainingSize, 1);
+        Block<WorkMatrixType,Dynamic,1> w(W, c+1-k, i, remainingSize, 1);
+        w.noalias() = matA.bottomRightCorner(remainingSize,remainingSize).template selfadjointView<Lower>() * v;
+        if(i>0)
+        {
+          tmp.head(i).noalias() = W.block(c+1-k,0,remainingSize,i).adjoint() * v;
+          w.noalias() -= matA.block(c+1,k,remainingSize,i) * tmp.head(i);
+          tmp.head(i).noalias() = matA.block(c+1,k,remainingSize,i).adjoint() * v;
+          w.noalias() -= W.block(c+1-k,0,remainingSize,i) * tmp.head(i);
+        }
+        w *= conj(h);
+        w += (conj(h)*Scalar(-0.5)*(w.dot(v))) * v;
+      }
+
+      // update the trailing matrix, the subdiagonal coefficient of the last reflector being still one
+      const Index ts = n-k-bs;
+      matA.block(k+bs,k+bs,ts,ts).template triangularView<Lower>() -= matA.block(k+bs,k,ts,bs) * W.block(bs,0,ts,bs).adjoint();
+      matA.block(k+bs,k+bs,ts,ts).template triangularView<Lower>() -= W.block(bs,0,ts,bs) * matA.block(k+bs,k,ts,bs).adjoint();
+
+      for(Index i=0; i<bs; ++i)
+        matA.coeffRef(k+i+1,k+i) = betas.coeff(i);
+    }
+  }
+
+  Block<MatrixType,Dynamic,Dynamic> tailA(matA, k, k, n-k, n-k);
+  VectorBlock<CoeffVectorType> tailCoeffs(hCoeffs, k, n-k-1);
+  tridiagonalization_inplace_unblocked(tailA, tailCoeffs);
+}
+
 // forward declaration, implementation at the end of this file
 template<typename MatrixType,
          int Size=MatrixType::ColsAtCompileTime,
@@ -61,6 +61,39 @@ void apply_block_householder_on_the_left(MatrixType& mat, const VectorsType& vec
   mat.noalias() -= V * tmp;
 }
 
+/** \internal
+  * Computes \a mat = H \a mat, where H = H_0 H_1 ... H_k-1 is the product of the Householder reflectors
+  * H_i = I - hCoeffs(i) v_i v_i^* whose essential parts are stored below the diagonal of the columns of
+  * \a vectors. The reflectors are applied by blocks of \a blockSize, each of them by three matrix products.
+  */
+template<typename MatrixType,typename VectorsType,typename CoeffsType>
+void apply_householder_sequence_on_the_left_blocked(MatrixType& mat, const VectorsType& vectors, const CoeffsType& hCoeffs,
+                                                    typename MatrixType::Index blockSize)
+{
+  typedef typename MatrixType::Index Index;
+  typedef Matrix<typename MatrixType::Scalar, Dynamic, Dynamic> DenseType;
+  const Index nbVecs = hCoeffs.size();
+  if(nbVecs==0)
+    return;
+
+  DenseType panel, T, tmp;
+  for(Index k = ((nbVecs-1)/blockSize)*blockSize; k >= 0; k -= blockSize)
+  {
+    const Index bs = (std::min)(blockSize, nbVecs-k);
+    const Index rs = vectors.rows()-k;
+    panel = vectors.block(k,k,rs,bs);
+    panel.template triangularView<StrictlyUpper>().setZero();
+    panel.diagonal().setOnes();
+    T.resize(bs,bs);
+    make_block_householder_triangular_factor(T, panel, hCoeffs.segment(k,bs));
+
+    // mat -= V T V^* mat
+    tmp.noalias() = panel.adjoint() * mat.bottomRows(rs);
+    tmp = T.template triangularView<Upper>() * tmp;
+    mat.bottomRows(rs).noalias() -= panel * tmp;
+  }
+}
+
 } // end namespace internal
 
 } // end namespace Eigen
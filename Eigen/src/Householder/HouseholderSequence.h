@@ -231,7 +231,10 @@ template<typename VectorsType, typename CoeffsType, int Side> class HouseholderS
       evalTo(dst, workspace);
     }
 
-    /** \internal */
+    /** \internal
+      * MatrixBase::applyHouseholderOnTheRight() multiplies by \f$ I - h \bar v v^T \f$, the transpose of the reflection,
+      * hence the Householder vectors are conjugated when the reflections are applied from the right.
+      */
     template<typename Dest, typename Workspace>
     void evalTo(Dest& dst, Workspace& workspace) const
     {
@@ -248,7 +251,7 @@ template<typename VectorsType, typename CoeffsType, int Side> class HouseholderS
           Index cornerSize = rows() - k - m_shift;
           if(m_trans)
             dst.bottomRightCorner(cornerSize, cornerSize)
-               .applyHouseholderOnTheRight(essentialVector(k), m_coeffs.coeff(k), workspace.data());
+               .applyHouseholderOnTheRight(essentialVector(k).conjugate(), m_coeffs.coeff(k), workspace.data());
           else
             dst.bottomRightCorner(cornerSize, cornerSize)
                .applyHouseholderOnTheLeft(essentialVector(k), m_coeffs.coeff(k), workspace.data());
@@ -268,7 +271,7 @@ template<typename VectorsType, typename CoeffsType, int Side> class HouseholderS
           Index cornerSize = rows() - k - m_shift;
           if(m_trans)
             dst.bottomRightCorner(cornerSize, cornerSize)
-               .applyHouseholderOnTheRight(essentialVector(k), m_coeffs.coeff(k), &workspace.coeffRef(0));
+               .applyHouseholderOnTheRight(essentialVector(k).conjugate(), m_coeffs.coeff(k), &workspace.coeffRef(0));
           else
             dst.bottomRightCorner(cornerSize, cornerSize)
                .applyHouseholderOnTheLeft(essentialVector(k), m_coeffs.coeff(k), &workspace.coeffRef(0));
@@ -292,7 +295,7 @@ template<typename VectorsType, typename CoeffsType, int Side> class HouseholderS
       {
         Index actual_k = m_trans ? m_length-k-1 : k;
         dst.rightCols(rows()-m_shift-actual_k)
-           .applyHouseholderOnTheRight(essentialVector(actual_k), m_coeffs.coeff(actual_k), workspace.data());
+           .applyHouseholderOnTheRight(essentialVector(actual_k).conjugate(), m_coeffs.coeff(actual_k), workspace.data());
       }
     }
 
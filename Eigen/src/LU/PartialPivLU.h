@@ -280,15 +280,95 @@ struct partial_lu_impl
     return first_zero_pivot;
   }
 
+  /** \internal performs the LU decomposition in-place of the panel represented
+    * by the variables \a rows, \a cols, \a lu_data, and \a lu_stride using a
+    * recursive algorithm: the left half of the columns is factorized, the right half
+    * is updated by a triangular solve and a matrix product, and then factorized.
+    * The panel must not be wider than tall.
+    *
+    * The row transpositions and \a nb_transpositions are returned as in unblocked_lu().
+    *
+    * \returns The index of the first pivot which is exactly zero if any, or a negative number otherwise.
+    */
+  static Index recursive_lu(Index rows, Index cols, Scalar* lu_data, Index luStride, PivIndex* row_transpositions, PivIndex& nb_transpositions)
+  {
+    MapLU lu1(lu_data,StorageOrder==RowMajor?rows:luStride,StorageOrder==RowMajor?luStride:cols);
+    MatrixType lu(lu1,0,0,rows,cols);
+    eigen_assert(rows>=cols);
+
+    if(cols<=16)
+      return unblocked_lu(lu, row_transpositions, nb_transpositions);
+
+    Index n1 = cols/2;
+    Index n2 = cols-n1;
+
+    // partition the panel:
+    // lu  = A11 | A12
+    //       A21 | A22
+    BlockType A_0(lu,0,0,rows,n1);
+    BlockType A_1(lu,0,n1,rows,n2);
+    BlockType A11(lu,0,0,n1,n1);
+    BlockType A12(lu,0,n1,n1,n2);
+    BlockType A21(lu,n1,0,rows-n1,n1);
+    BlockType A22(lu,n1,n1,rows-n1,n2);
+
+    PivIndex nb_transpositions_in_half;
+    Index first_zero_pivot = recursive_lu(rows, n1, lu_data, luStride, row_transpositions, nb_transpositions_in_half);
+    nb_transpositions = nb_transpositions_in_half;
+
+    for(Index i=0; i<n1; ++i)
+      A_1.row(i).swap(A_1.row(row_transpositions[i]));
+    A11.template triangularView<UnitLower>().solveInPlace(A12);
+    A22.noalias() -= A21 * A12;
+
+    Index ret = recursive_lu(rows-n1, n2, &lu.coeffRef(n1,n1), luStride, row_transpositions+n1, nb_transpositions_in_half);
+    if(ret>=0 && first_zero_pivot<0)
+      first_zero_pivot = n1+ret;
+    nb_transpositions += nb_transpositions_in_half;
+
+    for(Index i=n1; i<cols; ++i)
+    {
+      Index piv = (row_transpositions[i] += n1);
+      A_0.row(i).swap(A_0.row(piv));
+    }
+    return first_zero_pivot;
+  }
+
+  /** \internal applies the row transpositions of the factorized panel made of the \a bs columns starting at \a k
+    * to the \a n columns of \a lu starting at \a c0, and updates them accordingly.
+    */
+  static void update_trailing(MatrixType& lu, Index k, Index bs, Index c0, Index n, const PivIndex* row_transpositions)
+  {
+    if(n<=0)
+      return;
+    Index trows = lu.rows() - k - bs;
+    BlockType A_2(lu,0,c0,lu.rows(),n);
+    BlockType A11(lu,k,k,bs,bs);
+    BlockType A12(lu,k,c0,bs,n);
+    BlockType A21(lu,k+bs,k,trows,bs);
+    BlockType A22(lu,k+bs,c0,trows,n);
+
+    for(Index i=k; i<k+bs; ++i)
+      A_2.row(i).swap(A_2.row(row_transpositions[i]));
+
+    // A12 = A11^-1 A12
+    A11.template triangularView<UnitLower>().solveInPlace(A12);
+
+    A22.noalias() -= A21 * A12;
+  }
+
   /** \internal performs the LU decomposition in-place of the matrix represented
     * by the variables \a rows, \a cols, \a lu_data, and \a lu_stride using a
-    * recursive, blocked algorithm.
+    * blocked algorithm whose panels are factorized by recursive_lu().
     *
     * In addition, this function returns the row transpositions in the
     * vector \a row_transpositions which must have a size equal to the number
     * of columns of the matrix \a lu, and an integer \a nb_transpositions
     * which returns the actual number of transpositions.
     *
+    * When OpenMP is enabled, the update of the trailing matrix is done with look-ahead: one thread updates
+    * and factorizes the next panel while the other ones update the remaining columns.
+    *
     * \returns The index of the first pivot which is exactly zero if any, or a negative number otherwise.
     *
     * \note This very low level interface using pointers, etc. is to:
@@ -318,50 +398,79 @@ struct partial_lu_impl
     }
 
     nb_transpositions = 0;
-    int first_zero_pivot = -1;
+    Index first_zero_pivot = -1;
+
+    // factorize the first panel, the next ones are factorized during the update of the previous one
+    PivIndex nb_transpositions_in_panel;
+    Index ret = recursive_lu(rows, (std::min)(size,blockSize), lu_data, luStride, row_transpositions, nb_transpositions_in_panel);
+
     for(Index k = 0; k < size; k+=blockSize)
     {
       Index bs = (std::min)(size-k,blockSize); // actual size of the block
       Index trows = rows - k - bs; // trailing rows
       Index tsize = size - k - bs; // trailing size
 
-      // partition the matrix:
-      //                          A00 | A01 | A02
-      // lu  = A_0 | A_1 | A_2 =  A10 | A11 | A12
-      //                          A20 | A21 | A22
-      BlockType A_0(lu,0,0,rows,k);
-      BlockType A_2(lu,0,k+bs,rows,tsize);
-      BlockType A11(lu,k,k,bs,bs);
-      BlockType A12(lu,k,k+bs,bs,tsize);
-      BlockType A21(lu,k+bs,k,trows,bs);
-      BlockType A22(lu,k+bs,k+bs,trows,tsize);
-
-      PivIndex nb_transpositions_in_panel;
-      // recursively call the blocked LU algorithm on [A11^T A21^T]^T
-      // with a very small blocking size:
-      Index ret = blocked_lu(trows+bs, bs, &lu.coeffRef(k,k), luStride,
-                   row_transpositions+k, nb_transpositions_in_panel, 16);
       if(ret>=0 && first_zero_pivot==-1)
         first_zero_pivot = k+ret;
-
       nb_transpositions += nb_transpositions_in_panel;
+
       // update permutations and apply them to A_0
+      BlockType A_0(lu,0,0,rows,k);
       for(Index i=k; i<k+bs; ++i)
       {
         Index piv = (row_transpositions[i] += k);
         A_0.row(i).swap(A_0.row(piv));
       }
 
-      if(trows)
+      if(!trows)
+        break;
+
+      // partition the trailing columns into the next panel and the remaining ones:
+      // lu  = A_0 | A11 | A12 | A13
+      //           | A21 | A22 | A23
+      Index k1 = k + bs;
+      Index bs1 = (std::min)(tsize,blockSize);
+      Index rsize = tsize - bs1;
+      Scalar* next_panel = &lu.coeffRef(k1,k1);
+      PivIndex* next_transpositions = row_transpositions + k1;
+      ret = -1;
+      nb_transpositions_in_panel = 0;
+
+      Index threads = 1;
+#ifdef EIGEN_HAS_OPENMP
+      if(omp_get_num_threads()==1)
+        threads = (std::min)(Index(nbThreads()), 1 + rsize/32);
+#endif
+      if(threads>1)
       {
-        // apply permutations to A_2
-        for(Index i=k;i<k+bs; ++i)
-          A_2.row(i).swap(A_2.row(row_transpositions[i]));
-
-        // A12 = A11^-1 A12
-        A11.template triangularView<UnitLower>().solveInPlace(A12);
-
-        A22.noalias() -= A21 * A12;
+#ifdef EIGEN_HAS_OPENMP
+        #pragma omp parallel num_threads(threads)
+        {
+          Index t = omp_get_thread_num();
+          Index workers = omp_get_num_threads() - 1;
+          if(t==0)
+          {
+            update_trailing(lu, k, bs, k1, bs1, row_transpositions);
+            if(bs1>0)
+              ret = recursive_lu(rows-k1, bs1, next_panel, luStride, next_transpositions, nb_transpositions_in_panel);
+          }
+          if(workers==0)
+            update_trailing(lu, k, bs, k1+bs1, rsize, row_transpositions);
+          else if(t>0)
+          {
+            Index chunk = ((rsize+workers-1)/workers + 3) & ~Index(3);
+            Index c0 = (std::min)((t-1)*chunk, rsize);
+            update_trailing(lu, k, bs, k1+bs1+c0, (std::min)(chunk, rsize-c0), row_transpositions);
+          }
+        }
+#endif
+      }
+      else
+      {
+        update_trailing(lu, k, bs, k1, bs1, row_transpositions);
+        if(bs1>0)
+          ret = recursive_lu(rows-k1, bs1, next_panel, luStride, next_transpositions, nb_transpositions_in_panel);
+        update_trailing(lu, k, bs, k1+bs1, rsize, row_transpositions);
       }
     }
     return first_zero_pivot;
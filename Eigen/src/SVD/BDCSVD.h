@@ -0,0 +1,754 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef EIGEN_BDCSVD_H
+#define EIGEN_BDCSVD_H
+
+namespace Eigen {
+
+namespace internal {
+
+/** \internal Orders indices by increasing values. */
+template<typename RealScalar, typename Index> struct bdcsvd_less
+{
+  bdcsvd_less(const RealScalar* values) : m_values(values) {}
+  bool operator()(Index a, Index b) const { return m_values[a] < m_values[b]; }
+  const RealScalar* m_values;
+};
+
+/** \internal
+  * Computes the root \f$ \sigma_j \f$ of index \a j of the secular equation \f$ 1 + \sum_i z_i^2 / (d_i^2 - \sigma^2) = 0 \f$,
+  * where the \f$ d_i \f$ are nonnegative and increasing, and stores the differences \f$ d_i - \sigma_j \f$ in \a delta.
+  * The equation is solved for \f$ \sigma^2 \f$ relatively to the square of its closest pole, whose differences with
+  * the other squared poles are computed as products, and is refined by the two poles rational approximation of
+  * LAPACK's xLASD4 safeguarded by bisection.
+  */
+template<typename RealVector, typename DeltaType>
+static typename RealVector::Scalar bdcsvd_secular_root(const RealVector& d, const RealVector& z, typename RealVector::Index j,
+                                                       DeltaType& delta)
+{
+  typedef typename RealVector::Scalar RealScalar;
+  typedef typename RealVector::Index Index;
+  const Index k = d.size();
+  const RealScalar eps = NumTraits<RealScalar>::epsilon();
+
+  // find the closest pole, relatively to which the differences d_i^2 - sigma^2 are accurate
+  Index origin = j;
+  RealScalar lo = 0, hi;
+  if(j<k-1)
+  {
+    RealScalar mid = (d.coeff(j+1)-d.coeff(j))*(d.coeff(j+1)+d.coeff(j))/RealScalar(2);
+    RealScalar g = 1;
+    for(Index i=0; i<k; ++i)
+      g += z.coeff(i)*z.coeff(i) / ((d.coeff(i)-d.coeff(j))*(d.coeff(i)+d.coeff(j)) - mid);
+    if(g>=0)
+      hi = mid;
+    else
+    {
+      origin = j+1;
+      lo = -mid;
+      hi = 0;
+    }
+  }
+  else
+    hi = z.squaredNorm();
+
+  const RealScalar pole = d.coeff(origin);
+  RealVector delta2(k);
+  for(Index i=0; i<k; ++i)
+    delta2.coeffRef(i) = (d.coeff(i)-pole)*(d.coeff(i)+pole);
+
+  // tau = sigma^2 - pole^2
+  RealScalar tau = (lo+hi)/RealScalar(2);
+  for(Index iter=0; iter<100; ++iter)
+  {
+    RealScalar psi = 0, phi = 0, dpsi = 0, dphi = 0, err = 0;
+    for(Index i=0; i<k; ++i)
+    {
+      RealScalar t = z.coeff(i) / (delta2.coeff(i) - tau);
+      if(i<=j) { psi += z.coeff(i)*t; dpsi += t*t; }
+      else     { phi += z.coeff(i)*t; dphi += t*t; }
+      err += abs(z.coeff(i)*t);
+    }
+    RealScalar g = RealScalar(1) + psi + phi;
+    if(abs(g) <= RealScalar(8)*eps*(RealScalar(1) + err + abs(tau)*(dpsi+dphi)))
+      break;
+    if(g<0) lo = tau;
+    else    hi = tau;
+
+    // zero of the rational function c + s/(delta_j-x) + S/(delta_j+1-x) matching g and its derivatives
+    RealScalar eta;
+    RealScalar d1 = delta2.coeff(j) - tau;
+    if(j<k-1)
+    {
+      RealScalar d2 = delta2.coeff(j+1) - tau;
+      RealScalar c = g - d1*dpsi - d2*dphi;
+      RealScalar a = c*(d1+d2) + d1*d1*dpsi + d2*d2*dphi;
+      RealScalar b = g*d1*d2;
+      RealScalar disc = sqrt((std::max)(RealScalar(0), a*a - RealScalar(4)*b*c));
+      if(c==0)      eta = b/a;
+      else if(a<=0) eta = (a-disc)/(RealScalar(2)*c);
+      else          eta = RealScalar(2)*b/(a+disc);
+    }
+    else
+    {
+      RealScalar c = g - d1*dpsi;
+      eta = d1 + d1*d1*dpsi/c;
+    }
+
+    RealScalar next = tau + eta;
+    if(!(next>lo && next<hi))
+      next = (lo+hi)/RealScalar(2);
+    if(next==tau)
+      break;
+    tau = next;
+  }
+
+  // sigma = pole + mu, where mu is accurate even when sigma is close to the pole
+  const RealScalar mu = tau / (pole + sqrt((std::max)(RealScalar(0), pole*pole + tau)));
+  for(Index i=0; i<k; ++i)
+    delta.coeffRef(i) = (d.coeff(i)-pole) - mu;
+  return pole + mu;
+}
+
+/** \internal
+  * Computes the product of the columns \a nondeflated of \a Q by \a W, where the columns of \a Q of type 0 are zero
+  * below the row \a split, and those of type 2 are zero above it. The columns are grouped by type, such that
+  * the top and bottom rows are computed by two matrix products which skip the blocks known to be zero.
+  */
+template<typename RealMatrix, typename IndexVector>
+static void bdcsvd_apply(const RealMatrix& Q, const Matrix<int,Dynamic,1>& colType, const IndexVector& nondeflated,
+                         const RealMatrix& W, typename RealMatrix::Index split, RealMatrix& dst)
+{
+  typedef typename RealMatrix::Index Index;
+  const Index k = W.cols(), rows = Q.rows();
+  Index counts[3] = {0, 0, 0};
+  for(Index i=0; i<k; ++i)
+    ++counts[colType.coeff(nondeflated.coeff(i))];
+  Index offsets[3] = {0, counts[0], counts[0]+counts[1]};
+  RealMatrix Qg(rows,k), Wg(k,k);
+  for(Index i=0; i<k; ++i)
+  {
+    Index g = offsets[colType.coeff(nondeflated.coeff(i))]++;
+    Qg.col(g) = Q.col(nondeflated.coeff(i));
+    Wg.row(g) = W.row(i);
+  }
+  dst.resize(rows,k);
+  dst.topRows(split).noalias() = Qg.topLeftCorner(split,counts[0]+counts[1]) * Wg.topRows(counts[0]+counts[1]);
+  dst.bottomRows(rows-split).noalias() = Qg.bottomRightCorner(rows-split,counts[1]+counts[2]) * Wg.bottomRows(counts[1]+counts[2]);
+}
+
+/** \internal
+  * Computes the singular value decomposition of the matrix \f$ M \f$ whose first row is \a z and whose other rows
+  * are zero but for the coefficients \a d on the diagonal, where \a d(0) is 0 and the next \a m and last n-m-1
+  * coefficients are increasing, and updates the left and right singular vectors \a U and \a V of the block diagonal
+  * matrix of which \f$ M \f$ is the middle factor. The first \a m+1 rows of \a U and \a V are only spanned by
+  * their first \a m+1 columns, but for the column 0 of \a V.
+  *
+  * As for the tridiagonal divide and conquer, the singular values which are close to a coefficient of \a d are
+  * first deflated, and the singular vectors of the remaining ones are computed from the recomputed \a z of Gu and
+  * Eisenstat. On output, \a d holds the singular values in increasing order.
+  */
+template<typename RealScalar, typename Index>
+static void bdcsvd_merge(Matrix<RealScalar,Dynamic,1>& d, Matrix<RealScalar,Dynamic,1>& z, Index m,
+                         Matrix<RealScalar,Dynamic,Dynamic>& U, Matrix<RealScalar,Dynamic,Dynamic>& V)
+{
+  typedef Matrix<RealScalar,Dynamic,Dynamic> RealMatrix;
+  typedef Matrix<RealScalar,Dynamic,1> RealVector;
+  typedef Matrix<Index,Dynamic,1> IndexVector;
+  const Index n = d.size();
+
+  RealScalar tol = RealScalar(8)*NumTraits<RealScalar>::epsilon()*(std::max)(d.maxCoeff(), z.cwiseAbs().maxCoeff());
+  if(tol==RealScalar(0))
+    return;
+  if(abs(z.coeff(0))<=tol)
+    z.coeffRef(0) = tol;
+
+  // sort the two halves of the diagonal together, after d(0)
+  IndexVector perm(n);
+  perm.coeffRef(0) = 0;
+  for(Index i=1, i1=1, i2=m+1; i<n; ++i)
+    perm.coeffRef(i) = (i2==n || (i1<=m && d.coeff(i1)<=d.coeff(i2))) ? i1++ : i2++;
+
+  // deflate the small components of z, and the close coefficients of d by a rotation zeroing one of their
+  // components of z. The columns of U and V are 0 when they only span the first m+1 rows, 1 when they span
+  // all the rows, and 2 when they only span the last rows.
+  Matrix<int,Dynamic,1> colTypeU(n), colTypeV(n);
+  for(Index i=0; i<n; ++i)
+    colTypeU.coeffRef(i) = colTypeV.coeffRef(i) = i<=m ? 0 : 2;
+  if(!V.col(0).tail(V.rows()-m-1).isZero(0))
+    colTypeV.coeffRef(0) = 1;
+  IndexVector nondeflated(n), deflated(n);
+  Index k = 1, nd = 0, pj = -1;
+  nondeflated.coeffRef(0) = 0;
+  for(Index t=1; t<n; ++t)
+  {
+    Index j = perm.coeff(t);
+    if(abs(z.coeff(j)) <= tol)
+    {
+      deflated.coeffRef(nd++) = j;
+      continue;
+    }
+    if(pj<0)
+    {
+      pj = j;
+      continue;
+    }
+    RealScalar s = z.coeff(pj), c = z.coeff(j);
+    RealScalar tau = hypot(c,s);
+    c /= tau;
+    s = -s/tau;
+    if(abs((d.coeff(j)-d.coeff(pj))*c*s) <= tol)
+    {
+      z.coeffRef(j) = tau;
+      z.coeffRef(pj) = 0;
+      RealVector colp = U.col(pj);
+      U.col(pj) = c*colp + s*U.col(j);
+      U.col(j) = c*U.col(j) - s*colp;
+      colp = V.col(pj);
+      V.col(pj) = c*colp + s*V.col(j);
+      V.col(j) = c*V.col(j) - s*colp;
+      if(colTypeU.coeff(pj)!=colTypeU.coeff(j))
+        colTypeU.coeffRef(j) = 1;
+      if(colTypeV.coeff(pj)!=colTypeV.coeff(j))
+        colTypeV.coeffRef(j) = 1;
+      RealScalar dp = d.coeff(pj)*c*c + d.coeff(j)*s*s;
+      d.coeffRef(j) = d.coeff(pj)*s*s + d.coeff(j)*c*c;
+      d.coeffRef(pj) = dp;
+      deflated.coeffRef(nd++) = pj;
+    }
+    else
+      nondeflated.coeffRef(k++) = pj;
+    pj = j;
+  }
+  if(pj>=0)
+    nondeflated.coeffRef(k++) = pj;
+
+  // solve the secular equation of the remaining singular values, the smallest pole being kept away from 0
+  RealVector dk(k), zk(k), sigma(k);
+  for(Index i=0; i<k; ++i)
+  {
+    dk.coeffRef(i) = d.coeff(nondeflated.coeff(i));
+    zk.coeffRef(i) = z.coeff(nondeflated.coeff(i));
+  }
+  if(k>1)
+    dk.coeffRef(1) = (std::max)(dk.coeff(1), k>2 ? (std::min)(tol, dk.coeff(2))/RealScalar(2) : tol/RealScalar(2));
+  RealMatrix delta(k,k);
+  for(Index j=0; j<k; ++j)
+  {
+    typename RealMatrix::ColXpr deltaj = delta.col(j);
+    sigma.coeffRef(j) = bdcsvd_secular_root(dk, zk, j, deltaj);
+  }
+
+  // recompute z from the computed singular values, such that the singular vectors are numerically orthogonal
+  RealMatrix Um(k,k), Vm(k,k);
+  for(Index i=0; i<k; ++i)
+  {
+    RealScalar zi2 = -delta.coeff(i,i)*(dk.coeff(i)+sigma.coeff(i));
+    for(Index j=0; j<k; ++j)
+      if(j!=i)
+        zi2 *= -delta.coeff(i,j)*(dk.coeff(i)+sigma.coeff(j)) / ((dk.coeff(j)-dk.coeff(i))*(dk.coeff(j)+dk.coeff(i)));
+    RealScalar zi = sqrt(abs(zi2));
+    if(zk.coeff(i)<0)
+      zi = -zi;
+    for(Index j=0; j<k; ++j)
+    {
+      Vm.coeffRef(i,j) = zi / (delta.coeff(i,j)*(dk.coeff(i)+sigma.coeff(j)));
+      Um.coeffRef(i,j) = i==0 ? RealScalar(-1) : dk.coeff(i)*Vm.coeff(i,j);
+    }
+  }
+  for(Index j=0; j<k; ++j)
+  {
+    Um.col(j).normalize();
+    Vm.col(j).normalize();
+  }
+
+  RealMatrix Uk, Vk;
+  bdcsvd_apply(U, colTypeU, nondeflated, Um, m+1, Uk);
+  bdcsvd_apply(V, colTypeV, nondeflated, Vm, m+1, Vk);
+
+  // gather the singular values and vectors by increasing singular values
+  RealVector values(n);
+  values.head(k) = sigma;
+  for(Index i=0; i<nd; ++i)
+    values.coeffRef(k+i) = d.coeff(deflated.coeff(i));
+  IndexVector order(n);
+  for(Index i=0; i<n; ++i)
+    order.coeffRef(i) = i;
+  std::sort(order.data(), order.data()+n, bdcsvd_less<RealScalar,Index>(values.data()));
+  RealMatrix resultU(U.rows(),n), resultV(V.rows(),n);
+  for(Index i=0; i<n; ++i)
+  {
+    Index o = order.coeff(i);
+    d.coeffRef(i) = values.coeff(o);
+    if(o<k)
+    {
+      resultU.col(i) = Uk.col(o);
+      resultV.col(i) = Vk.col(o);
+    }
+    else
+    {
+      resultU.col(i) = U.col(deflated.coeff(o-k));
+      resultV.col(i) = V.col(deflated.coeff(o-k));
+    }
+  }
+  U.swap(resultU);
+  V.leftCols(n) = resultV;
+}
+
+/** \internal
+  * Computes the singular value decomposition \f$ B = U S V^T \f$ of the n x (n+\a sqre) upper bidiagonal matrix of
+  * diagonal \a diag and superdiagonal \a superdiag by the divide and conquer method of Gu and Eisenstat.
+  *
+  * The middle row of B splits it into an upper bidiagonal matrix having one more column than rows and a smaller
+  * one, whose decompositions are computed recursively and then merged by bdcsvd_merge(). Blocks of at most
+  * EIGEN_BDCSVD_THRESHOLD rows are decomposed by JacobiSVD. On output, \a values holds the singular values in
+  * increasing order, and when \a sqre is true the last column of \a V spans the kernel of B.
+  */
+template<typename RealScalar, typename Index>
+static void bdcsvd_divide(const RealScalar* diag, const RealScalar* superdiag, Index n, bool sqre,
+                          Matrix<RealScalar,Dynamic,1>& values, Matrix<RealScalar,Dynamic,Dynamic>& U,
+                          Matrix<RealScalar,Dynamic,Dynamic>& V)
+{
+  typedef Matrix<RealScalar,Dynamic,Dynamic> RealMatrix;
+  typedef Matrix<RealScalar,Dynamic,1> RealVector;
+  const Index cols = sqre ? n+1 : n;
+
+  if(n<=(std::max)(Index(EIGEN_BDCSVD_THRESHOLD), Index(3)))
+  {
+    RealMatrix B = RealMatrix::Zero(n,cols);
+    for(Index i=0; i<n; ++i)
+    {
+      B.coeffRef(i,i) = diag[i];
+      if(i+1<cols)
+        B.coeffRef(i,i+1) = superdiag[i];
+    }
+    JacobiSVD<RealMatrix> svd(B, ComputeFullU|ComputeFullV);
+    values = svd.singularValues().reverse();
+    U = svd.matrixU().rowwise().reverse();
+    V = svd.matrixV();
+    V.leftCols(n) = svd.matrixV().leftCols(n).rowwise().reverse();
+    return;
+  }
+
+  // B = [B1 0; alpha e_m^T beta e_0^T; 0 B2] where B1 has m rows and m+1 columns
+  const Index m = n/2, r = n-m-1;
+  RealVector values1, values2;
+  RealMatrix U1, V1, U2, V2;
+  bdcsvd_divide(diag, superdiag, m, true, values1, U1, V1);
+  bdcsvd_divide(diag+m+1, superdiag+m+1, r, sqre, values2, U2, V2);
+  const RealScalar alpha = diag[m], beta = superdiag[m];
+
+  // rotate the kernels of B1 and B2 such that only one of them has a nonzero component in the middle row
+  RealScalar za = alpha*V1.coeff(m,m), zb = sqre ? beta*V2.coeff(0,r) : RealScalar(0);
+  RealScalar rho = 0, c = 1, s = 0;
+  if(za!=RealScalar(0) || zb!=RealScalar(0))
+  {
+    rho = hypot(za,zb);
+    c = za/rho;
+    s = zb/rho;
+  }
+
+  // B = U M V^T where M has the first row z and the diagonal d
+  RealVector d(n), z(n);
+  d.coeffRef(0) = 0;
+  z.coeffRef(0) = rho;
+  d.segment(1,m) = values1;
+  z.segment(1,m) = alpha*V1.row(m).head(m).transpose();
+  d.tail(r) = values2;
+  z.tail(r) = beta*V2.row(0).head(r).transpose();
+
+  U.setZero(n,n);
+  U.coeffRef(m,0) = 1;
+  U.block(0,1,m,m) = U1;
+  U.bottomRightCorner(r,r) = U2;
+  V.setZero(cols,cols);
+  V.col(0).head(m+1) = c*V1.col(m);
+  V.block(0,1,m+1,m) = V1.leftCols(m);
+  V.block(m+1,m+1,V2.rows(),r) = V2.leftCols(r);
+  if(sqre)
+  {
+    V.col(0).tail(r+1) = s*V2.col(r);
+    V.col(n).head(m+1) = -s*V1.col(m);
+    V.col(n).tail(r+1) = c*V2.col(r);
+  }
+
+  bdcsvd_merge(d, z, m, U, V);
+  values.swap(d);
+}
+
+} // end namespace internal
+
+/** \ingroup SVD_Module
+  *
+  *
+  * \class BDCSVD
+  *
+  * \brief Bidiagonal divide and conquer SVD decomposition of a rectangular matrix
+  *
+  * \param MatrixType the type of the matrix of which we are computing the SVD decomposition
+  *
+  * This class computes the same decomposition \f$ A = U S V^* \f$ as JacobiSVD, and has the same API: singular
+  * values are sorted in decreasing order, only the singular values are computed by default, and full or thin
+  * \a U and \a V can be asked for by the computation options.
+  *
+  * The matrix is first reduced to a real upper bidiagonal matrix by Householder transformations. The singular
+  * value decomposition of the bidiagonal matrix is then computed by the divide and conquer method of Gu and
+  * Eisenstat, as LAPACK's xBDSDC does, whose blocks of at most EIGEN_BDCSVD_THRESHOLD rows are decomposed by
+  * JacobiSVD. Finally, the singular vectors are obtained by applying the Householder transformations by blocks.
+  * As most of the work is done by matrix products, this is much faster than JacobiSVD for large matrices, at the
+  * cost of a somewhat lower accuracy for the smallest singular values. Matrices of at most
+  * EIGEN_BDCSVD_THRESHOLD rows or columns are decomposed by JacobiSVD altogether.
+  *
+  * \sa class JacobiSVD, MatrixBase::bdcSvd()
+  */
+template<typename _MatrixType> class BDCSVD
+{
+  public:
+
+    typedef _MatrixType MatrixType;
+    typedef typename MatrixType::Scalar Scalar;
+    typedef typename NumTraits<typename MatrixType::Scalar>::Real RealScalar;
+    typedef typename MatrixType::Index Index;
+    enum {
+      RowsAtCompileTime = MatrixType::RowsAtCompileTime,
+      ColsAtCompileTime = MatrixType::ColsAtCompileTime,
+      MaxRowsAtCompileTime = MatrixType::MaxRowsAtCompileTime,
+      MaxColsAtCompileTime = MatrixType::MaxColsAtCompileTime,
+      MatrixOptions = MatrixType::Options
+    };
+
+    typedef Matrix<Scalar, RowsAtCompileTime, RowsAtCompileTime,
+                   MatrixOptions, MaxRowsAtCompileTime, MaxRowsAtCompileTime>
+            MatrixUType;
+    typedef Matrix<Scalar, ColsAtCompileTime, ColsAtCompileTime,
+                   MatrixOptions, MaxColsAtCompileTime, MaxColsAtCompileTime>
+            MatrixVType;
+    typedef typename internal::plain_diag_type<MatrixType, RealScalar>::type SingularValuesType;
+
+    /** \brief Default Constructor.
+      *
+      * The default constructor is useful in cases in which the user intends to
+      * perform decompositions via BDCSVD::compute(const MatrixType&).
+      */
+    BDCSVD()
+      : m_isInitialized(false),
+        m_isAllocated(false),
+        m_computationOptions(0),
+        m_rows(-1), m_cols(-1)
+    {}
+
+    /** \brief Default Constructor with memory preallocation
+      *
+      * Like the default constructor but with preallocation of the internal data
+      * according to the specified problem size.
+      * \sa BDCSVD()
+      */
+    BDCSVD(Index rows, Index cols, unsigned int computationOptions = 0)
+      : m_isInitialized(false),
+        m_isAllocated(false),
+        m_computationOptions(0),
+        m_rows(-1), m_cols(-1)
+    {
+      allocate(rows, cols, computationOptions);
+    }
+
+    /** \brief Constructor performing the decomposition of given matrix.
+     *
+     * \param matrix the matrix to decompose
+     * \param computationOptions optional parameter allowing to specify if you want full or thin U or V unitaries to be computed.
+     *                           By default, none is computed. This is a bit-field, the possible bits are #ComputeFullU, #ComputeThinU,
+     *                           #ComputeFullV, #ComputeThinV.
+     *
+     * Thin unitaries are only available if your matrix type has a Dynamic number of columns (for example MatrixXf).
+     */
+    BDCSVD(const MatrixType& matrix, unsigned int computationOptions = 0)
+      : m_isInitialized(false),
+        m_isAllocated(false),
+        m_computationOptions(0),
+        m_rows(-1), m_cols(-1)
+    {
+      compute(matrix, computationOptions);
+    }
+
+    /** \brief Method performing the decomposition of given matrix using custom options.
+     *
+     * \param matrix the matrix to decompose
+     * \param computationOptions optional parameter allowing to specify if you want full or thin U or V unitaries to be computed.
+     *                           By default, none is computed. This is a bit-field, the possible bits are #ComputeFullU, #ComputeThinU,
+     *                           #ComputeFullV, #ComputeThinV.
+     *
+     * Thin unitaries are only available if your matrix type has a Dynamic number of columns (for example MatrixXf).
+     */
+    BDCSVD& compute(const MatrixType& matrix, unsigned int computationOptions);
+
+    /** \brief Method performing the decomposition of given matrix using current options.
+     *
+     * \param matrix the matrix to decompose
+     *
+     * This method uses the current \a computationOptions, as already passed to the constructor or to compute(const MatrixType&, unsigned int).
+     */
+    BDCSVD& compute(const MatrixType& matrix)
+    {
+      return compute(matrix, m_computationOptions);
+    }
+
+    /** \returns the \a U matrix.
+     *
+     * For the SVD decomposition of a n-by-p matrix, letting \a m be the minimum of \a n and \a p,
+     * the U matrix is n-by-n if you asked for #ComputeFullU, and is n-by-m if you asked for #ComputeThinU.
+     *
+     * The \a m first columns of \a U are the left singular vectors of the matrix being decomposed.
+     *
+     * This method asserts that you asked for \a U to be computed.
+     */
+    const MatrixUType& matrixU() const
+    {
+      eigen_assert(m_isInitialized && "BDCSVD is not initialized.");
+      eigen_assert(computeU() && "This BDCSVD decomposition didn't compute U. Did you ask for it?");
+      return m_matrixU;
+    }
+
+    /** \returns the \a V matrix.
+     *
+     * For the SVD decomposition of a n-by-p matrix, letting \a m be the minimum of \a n and \a p,
+     * the V matrix is p-by-p if you asked for #ComputeFullV, and is p-by-m if you asked for ComputeThinV.
+     *
+     * The \a m first columns of \a V are the right singular vectors of the matrix being decomposed.
+     *
+     * This method asserts that you asked for \a V to be computed.
+     */
+    const MatrixVType& matrixV() const
+    {
+      eigen_assert(m_isInitialized && "BDCSVD is not initialized.");
+      eigen_assert(computeV() && "This BDCSVD decomposition didn't compute V. Did you ask for it?");
+      return m_matrixV;
+    }
+
+    /** \returns the vector of singular values.
+     *
+     * For the SVD decomposition of a n-by-p matrix, letting \a m be the minimum of \a n and \a p, the
+     * returned vector has size \a m.  Singular values are always sorted in decreasing order.
+     */
+    const SingularValuesType& singularValues() const
+    {
+      eigen_assert(m_isInitialized && "BDCSVD is not initialized.");
+      return m_singularValues;
+    }
+
+    /** \returns true if \a U (full or thin) is asked for in this SVD decomposition */
+    inline bool computeU() const { return m_computeFullU || m_computeThinU; }
+    /** \returns true if \a V (full or thin) is asked for in this SVD decomposition */
+    inline bool computeV() const { return m_computeFullV || m_computeThinV; }
+
+    /** \returns a (least squares) solution of \f$ A x = b \f$ using the current SVD decomposition of A.
+      *
+      * \param b the right-hand-side of the equation to solve.
+      *
+      * \note Solving requires both U and V to be computed. Thin U and V are enough, there is no need for full U or V.
+      *
+      * \note SVD solving is implicitly least-squares. Thus, this method serves both purposes of exact solving and least-squares solving.
+      * In other words, the returned solution is guaranteed to minimize the Euclidean norm \f$ \Vert A x - b \Vert \f$.
+      */
+    template<typename Rhs>
+    inline const internal::solve_retval<BDCSVD, Rhs>
+    solve(const MatrixBase<Rhs>& b) const
+    {
+      eigen_assert(m_isInitialized && "BDCSVD is not initialized.");
+      eigen_assert(computeU() && computeV() && "BDCSVD::solve() requires both unitaries U and V to be computed (thin unitaries suffice).");
+      return internal::solve_retval<BDCSVD, Rhs>(*this, b.derived());
+    }
+
+    /** \returns the number of singular values that are not exactly 0 */
+    Index nonzeroSingularValues() const
+    {
+      eigen_assert(m_isInitialized && "BDCSVD is not initialized.");
+      return m_nonzeroSingularValues;
+    }
+
+    inline Index rows() const { return m_rows; }
+    inline Index cols() const { return m_cols; }
+
+  private:
+    void allocate(Index rows, Index cols, unsigned int computationOptions);
+
+  protected:
+    MatrixUType m_matrixU;
+    MatrixVType m_matrixV;
+    SingularValuesType m_singularValues;
+    bool m_isInitialized, m_isAllocated;
+    bool m_computeFullU, m_computeThinU;
+    bool m_computeFullV, m_computeThinV;
+    unsigned int m_computationOptions;
+    Index m_nonzeroSingularValues, m_rows, m_cols, m_diagSize;
+};
+
+template<typename MatrixType>
+void BDCSVD<MatrixType>::allocate(Index rows, Index cols, unsigned int computationOptions)
+{
+  eigen_assert(rows >= 0 && cols >= 0);
+
+  if (m_isAllocated &&
+      rows == m_rows &&
+      cols == m_cols &&
+      computationOptions == m_computationOptions)
+  {
+    return;
+  }
+
+  m_rows = rows;
+  m_cols = cols;
+  m_isInitialized = false;
+  m_isAllocated = true;
+  m_computationOptions = computationOptions;
+  m_computeFullU = (computationOptions & ComputeFullU) != 0;
+  m_computeThinU = (computationOptions & ComputeThinU) != 0;
+  m_computeFullV = (computationOptions & ComputeFullV) != 0;
+  m_computeThinV = (computationOptions & ComputeThinV) != 0;
+  eigen_assert(!(m_computeFullU && m_computeThinU) && "BDCSVD: you can't ask for both full and thin U");
+  eigen_assert(!(m_computeFullV && m_computeThinV) && "BDCSVD: you can't ask for both full and thin V");
+  eigen_assert(EIGEN_IMPLIES(m_computeThinU || m_computeThinV, MatrixType::ColsAtCompileTime==Dynamic) &&
+              "BDCSVD: thin U and V are only available when your matrix has a dynamic number of columns.");
+  m_diagSize = (std::min)(m_rows, m_cols);
+  m_singularValues.resize(m_diagSize);
+  m_matrixU.resize(m_rows, m_computeFullU ? m_rows
+                          : m_computeThinU ? m_diagSize
+                          : 0);
+  m_matrixV.resize(m_cols, m_computeFullV ? m_cols
+                          : m_computeThinV ? m_diagSize
+                          : 0);
+}
+
+template<typename MatrixType>
+BDCSVD<MatrixType>&
+BDCSVD<MatrixType>::compute(const MatrixType& matrix, unsigned int computationOptions)
+{
+  typedef Matrix<Scalar,Dynamic,Dynamic> WorkMatrixType;
+  typedef Matrix<RealScalar,Dynamic,Dynamic> RealMatrix;
+  typedef Matrix<RealScalar,Dynamic,1> RealVector;
+
+  allocate(matrix.rows(), matrix.cols(), computationOptions);
+
+  if(m_diagSize <= EIGEN_BDCSVD_THRESHOLD)
+  {
+    JacobiSVD<MatrixType> svd(matrix, computationOptions);
+    m_singularValues = svd.singularValues();
+    if(computeU()) m_matrixU = svd.matrixU();
+    if(computeV()) m_matrixV = svd.matrixV();
+    m_nonzeroSingularValues = svd.nonzeroSingularValues();
+    m_isInitialized = true;
+    return *this;
+  }
+
+  /*** step 1. Reduce the matrix, or its adjoint if it has more columns than rows, to an upper bidiagonal matrix ***/
+
+  RealScalar scale = matrix.cwiseAbs().maxCoeff();
+  if(scale==RealScalar(0))
+    scale = RealScalar(1);
+  const bool transposed = m_cols > m_rows;
+  WorkMatrixType work;
+  if(transposed) work = matrix.adjoint() / scale;
+  else           work = matrix / scale;
+  internal::UpperBidiagonalization<WorkMatrixType> bidiagonalization(work);
+  const Index n = m_diagSize;
+
+  /*** step 2. Compute the singular value decomposition of the bidiagonal matrix by divide and conquer ***/
+
+  // the first row of the band storage holds the superdiagonal from its second coefficient
+  RealVector diag = bidiagonalization.bidiagonal().diagonal().transpose();
+  RealVector superdiag = bidiagonalization.bidiagonal().coeffs().row(0).segment(1,n-1).transpose();
+  RealVector values;
+  RealMatrix Ub, Vb;
+  internal::bdcsvd_divide(diag.data(), superdiag.data(), n, false, values, Ub, Vb);
+  m_singularValues = scale * values.reverse();
+
+  /*** step 3. Apply the Householder transformations of the bidiagonalization to the singular vectors ***/
+
+  const bool computeLeft = transposed ? computeV() : computeU();
+  const bool computeRight = transposed ? computeU() : computeV();
+  const bool fullLeft = transposed ? m_computeFullV : m_computeFullU;
+  const Index blockSize = 32;
+  if(computeLeft)
+  {
+    const Index rows = work.rows();
+    WorkMatrixType left = WorkMatrixType::Zero(rows, fullLeft ? rows : n);
+    left.topLeftCorner(n,n) = Ub.rowwise().reverse().template cast<Scalar>();
+    if(fullLeft)
+      left.bottomRightCorner(rows-n,rows-n).setIdentity();
+    internal::apply_householder_sequence_on_the_left_blocked(left, bidiagonalization.householder(),
+                                                             bidiagonalization.householder().diagonal().conjugate(), blockSize);
+    if(transposed) m_matrixV = left;
+    else           m_matrixU = left;
+  }
+  if(computeRight)
+  {
+    WorkMatrixType right = Vb.rowwise().reverse().template cast<Scalar>();
+    // this is UpperBidiagonalization::householderV(), whose Householder vectors are the conjugates of the stored
+    // rows, applied by blocks
+    Block<WorkMatrixType> rightTail(right, 1, 0, n-1, n);
+    internal::apply_householder_sequence_on_the_left_blocked(rightTail,
+                                                             bidiagonalization.householder().block(0,1,n-1,n-1).adjoint(),
+                                                             bidiagonalization.householder().template diagonal<1>().head(n-1), blockSize);
+    if(transposed) m_matrixU = right;
+    else           m_matrixV = right;
+  }
+
+  m_nonzeroSingularValues = m_diagSize;
+  while(m_nonzeroSingularValues>0 && m_singularValues.coeff(m_nonzeroSingularValues-1)==RealScalar(0))
+    --m_nonzeroSingularValues;
+
+  m_isInitialized = true;
+  return *this;
+}
+
+namespace internal {
+template<typename _MatrixType, typename Rhs>
+struct solve_retval<BDCSVD<_MatrixType>, Rhs>
+  : solve_retval_base<BDCSVD<_MatrixType>, Rhs>
+{
+  typedef BDCSVD<_MatrixType> BDCSVDType;
+  EIGEN_MAKE_SOLVE_HELPERS(BDCSVDType,Rhs)
+
+  template<typename Dest> void evalTo(Dest& dst) const
+  {
+    eigen_assert(rhs().rows() == dec().rows());
+
+    // A = U S V^*
+    // So A^{-1} = V S^{-1} U^*
+
+    Index diagSize = (std::min)(dec().rows(), dec().cols());
+    typename BDCSVDType::SingularValuesType invertedSingVals(diagSize);
+
+    Index nonzeroSingVals = dec().nonzeroSingularValues();
+    invertedSingVals.head(nonzeroSingVals) = dec().singularValues().head(nonzeroSingVals).array().inverse();
+    invertedSingVals.tail(diagSize - nonzeroSingVals).setZero();
+
+    dst = dec().matrixV().leftCols(diagSize)
+        * invertedSingVals.asDiagonal()
+        * dec().matrixU().leftCols(diagSize).adjoint()
+        * rhs();
+  }
+};
+} // end namespace internal
+
+/** \svd_module
+  *
+  * \return the singular value decomposition of \c *this computed by bidiagonalization
+  * and divide and conquer.
+  *
+  * \sa class BDCSVD
+  */
+template<typename Derived>
+BDCSVD<typename MatrixBase<Derived>::PlainObject>
+MatrixBase<Derived>::bdcSvd(unsigned int computationOptions) const
+{
+  return BDCSVD<PlainObject>(*this, computationOptions);
+}
+
+} // end namespace Eigen
+
+#endif // EIGEN_BDCSVD_H
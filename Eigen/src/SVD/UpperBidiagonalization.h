@@ -39,7 +39,7 @@ template<typename _MatrixType> class UpperBidiagonalization
               CwiseUnaryOp<internal::scalar_conjugate_op<Scalar>, const Diagonal<const MatrixType,0> >
             > HouseholderUSequenceType;
     typedef HouseholderSequence<
-              const MatrixType,
+              const typename internal::remove_all<typename MatrixType::ConjugateReturnType>::type,
               Diagonal<const MatrixType,1>,
               OnTheRight
             > HouseholderVSequenceType;
@@ -74,7 +74,9 @@ template<typename _MatrixType> class UpperBidiagonalization
     const HouseholderVSequenceType householderV() // const here gives nasty errors and i'm lazy
     {
       eigen_assert(m_isInitialized && "UpperBidiagonalization is not initialized.");
-      return HouseholderVSequenceType(m_householder, m_householder.const_derived().template diagonal<1>())
+      // the rows were reduced by the transposes of their reflections, hence the Householder vectors of V are the
+      // conjugates of the stored ones
+      return HouseholderVSequenceType(m_householder.conjugate(), m_householder.const_derived().template diagonal<1>())
              .setLength(m_householder.cols()-1)
              .setShift(1);
     }
@@ -97,7 +99,89 @@ UpperBidiagonalization<_MatrixType>& UpperBidiagonalization<_MatrixType>::comput
 
   ColVectorType temp(rows);
 
-  for (Index k = 0; /* breaks at k==cols-1 below */ ; ++k)
+  const Index blockSize = 32;
+  Index k = 0;
+  if(cols>=4*blockSize)
+  {
+    typedef Matrix<Scalar,Dynamic,Dynamic,ColMajor> WorkMatrixType;
+    typedef Matrix<Scalar,Dynamic,1> WorkVectorType;
+    // While a panel is reduced, the trailing matrix is kept as A - V Y^* - X W^*, where the columns of V and W
+    // hold the left and right reflectors of the panel with explicit zeros and ones, so that only the current
+    // row and column are updated. The rows of V and X start at row k, the rows of W and Y at column k.
+    WorkMatrixType V, W, X, Y;
+    WorkVectorType tmp(blockSize);
+    for(; cols-k>2*blockSize; k+=blockSize)
+    {
+      const Index bs = blockSize;
+      V.setZero(rows-k, bs);
+      X.setZero(rows-k, bs);
+      W.setZero(cols-k, bs);
+      Y.setZero(cols-k, bs);
+      for(Index i=0; i<bs; ++i)
+      {
+        const Index c = k+i;
+        const Index remainingRows = rows - c;
+        const Index remainingCols = cols - c - 1;
+
+        // update the current column and construct the left householder transform
+        Block<MatrixType,Dynamic,1> col(m_householder, c, c, remainingRows, 1);
+        if(i>0)
+        {
+          col.noalias() -= V.block(i,0,remainingRows,i) * Y.row(i).head(i).adjoint();
+          col.noalias() -= X.block(i,0,remainingRows,i) * W.row(i).head(i).adjoint();
+        }
+        col.makeHouseholderInPlace(m_householder.coeffRef(c,c),
+                                   m_bidiagonal.template diagonal<0>().coeffRef(c));
+        const Scalar tauLeft = m_householder.coeff(c,c);
+        V.coeffRef(i,i) = Scalar(1);
+        V.col(i).tail(remainingRows-1) = m_householder.col(c).tail(remainingRows-1);
+
+        // y = conj(tau) (A - V Y^* - X W^*)^* v
+        Block<WorkMatrixType,Dynamic,1> y(Y, i+1, i, remainingCols, 1);
+        y.noalias() = m_householder.block(c,c+1,remainingRows,remainingCols).adjoint() * V.col(i).tail(remainingRows);
+        if(i>0)
+        {
+          tmp.head(i).noalias() = V.block(i,0,remainingRows,i).adjoint() * V.col(i).tail(remainingRows);
+          y.noalias() -= Y.block(i+1,0,remainingCols,i) * tmp.head(i);
+          tmp.head(i).noalias() = X.block(i,0,remainingRows,i).adjoint() * V.col(i).tail(remainingRows);
+          y.noalias() -= W.block(i+1,0,remainingCols,i) * tmp.head(i);
+        }
+        y *= internal::conj(tauLeft);
+
+        // update the current row and construct the right householder transform
+        Block<MatrixType,1,Dynamic> row(m_householder, c, c+1, 1, remainingCols);
+        row.noalias() -= V.row(i).head(i+1) * Y.block(i+1,0,remainingCols,i+1).adjoint();
+        if(i>0)
+          row.noalias() -= X.row(i).head(i) * W.block(i+1,0,remainingCols,i).adjoint();
+        row.makeHouseholderInPlace(m_householder.coeffRef(c,c+1),
+                                   m_bidiagonal.template diagonal<1>().coeffRef(c));
+        const Scalar tauRight = m_householder.coeff(c,c+1);
+        W.coeffRef(i+1,i) = Scalar(1);
+        W.col(i).tail(remainingCols-1) = m_householder.row(c).tail(remainingCols-1).adjoint();
+
+        // x = tau (A - V Y^* - X W^*) w
+        Block<WorkMatrixType,Dynamic,1> x(X, i+1, i, remainingRows-1, 1);
+        x.noalias() = m_householder.block(c+1,c+1,remainingRows-1,remainingCols) * W.col(i).tail(remainingCols);
+        tmp.head(i+1).noalias() = Y.block(i+1,0,remainingCols,i+1).adjoint() * W.col(i).tail(remainingCols);
+        x.noalias() -= V.block(i+1,0,remainingRows-1,i+1) * tmp.head(i+1);
+        if(i>0)
+        {
+          tmp.head(i).noalias() = W.block(i+1,0,remainingCols,i).adjoint() * W.col(i).tail(remainingCols);
+          x.noalias() -= X.block(i+1,0,remainingRows-1,i) * tmp.head(i);
+        }
+        x *= tauRight;
+      }
+
+      // apply the whole panel to the trailing matrix
+      const Index trailingRows = rows-k-bs;
+      const Index trailingCols = cols-k-bs;
+      Block<MatrixType,Dynamic,Dynamic> trailing(m_householder, k+bs, k+bs, trailingRows, trailingCols);
+      trailing.noalias() -= V.bottomRows(trailingRows) * Y.bottomRows(trailingCols).adjoint();
+      trailing.noalias() -= X.bottomRows(trailingRows) * W.bottomRows(trailingCols).adjoint();
+    }
+  }
+
+  for (; /* breaks at k==cols-1 below */ ; ++k)
   {
     Index remainingRows = rows - k;
     Index remainingCols = cols - k - 1;
@@ -199,3 +199,45 @@ operator||(const EIGEN_CURRENT_STORAGE_BASE_CLASS<OtherDerived> &other) const
                       THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_OF_BOOL);
   return CwiseBinaryOp<internal::scalar_boolean_or_op, const Derived, const OtherDerived>(derived(),other.derived());
 }
+
+/** \returns an expression of the coefficient-wise bitwise and of *this and \a other
+  *
+  * \warning this operator is for expressions of integers only.
+  *
+  * \sa operator|(), operator^(), shiftLeft(), shiftRight()
+  */
+template<typename OtherDerived>
+EIGEN_STRONG_INLINE const CwiseBinaryOp<internal::scalar_bitwise_and_op<Scalar>, const Derived, const OtherDerived>
+operator&(const EIGEN_CURRENT_STORAGE_BASE_CLASS<OtherDerived> &other) const
+{
+  EIGEN_STATIC_ASSERT(NumTraits<Scalar>::IsInteger, THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_OF_INTEGERS);
+  return CwiseBinaryOp<internal::scalar_bitwise_and_op<Scalar>, const Derived, const OtherDerived>(derived(), other.derived());
+}
+
+/** \returns an expression of the coefficient-wise bitwise or of *this and \a other
+  *
+  * \warning this operator is for expressions of integers only.
+  *
+  * \sa operator&(), operator^(), shiftLeft(), shiftRight()
+  */
+template<typename OtherDerived>
+EIGEN_STRONG_INLINE const CwiseBinaryOp<internal::scalar_bitwise_or_op<Scalar>, const Derived, const OtherDerived>
+operator|(const EIGEN_CURRENT_STORAGE_BASE_CLASS<OtherDerived> &other) const
+{
+  EIGEN_STATIC_ASSERT(NumTraits<Scalar>::IsInteger, THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_OF_INTEGERS);
+  return CwiseBinaryOp<internal::scalar_bitwise_or_op<Scalar>, const Derived, const OtherDerived>(derived(), other.derived());
+}
+
+/** \returns an expression of the coefficient-wise bitwise xor of *this and \a other
+  *
+  * \warning this operator is for expressions of integers only.
+  *
+  * \sa operator&(), operator|(), shiftLeft(), shiftRight()
+  */
+template<typename OtherDerived>
+EIGEN_STRONG_INLINE const CwiseBinaryOp<internal::scalar_bitwise_xor_op<Scalar>, const Derived, const OtherDerived>
+operator^(const EIGEN_CURRENT_STORAGE_BASE_CLASS<OtherDerived> &other) const
+{
+  EIGEN_STATIC_ASSERT(NumTraits<Scalar>::IsInteger, THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_OF_INTEGERS);
+  return CwiseBinaryOp<internal::scalar_bitwise_xor_op<Scalar>, const Derived, const OtherDerived>(derived(), other.derived());
+}
@@ -186,6 +186,35 @@ cube() const
   return derived();
 }
 
+/** \returns an expression of the coefficients of *this shifted to the left by \a N bits.
+  *
+  * \warning this method is for expressions of integers only.
+  *
+  * \sa shiftRight(), operator&()
+  */
+template<int N>
+inline const CwiseUnaryOp<internal::scalar_shift_left_op<Scalar,N>, const Derived>
+shiftLeft() const
+{
+  EIGEN_STATIC_ASSERT(NumTraits<Scalar>::IsInteger, THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_OF_INTEGERS);
+  return derived();
+}
+
+/** \returns an expression of the coefficients of *this shifted to the right by \a N bits.
+  * As for the \c >> operator of the scalar type, the sign bit of signed integers is propagated.
+  *
+  * \warning this method is for expressions of integers only.
+  *
+  * \sa shiftLeft(), operator&()
+  */
+template<int N>
+inline const CwiseUnaryOp<internal::scalar_shift_right_op<Scalar,N>, const Derived>
+shiftRight() const
+{
+  EIGEN_STATIC_ASSERT(NumTraits<Scalar>::IsInteger, THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_OF_INTEGERS);
+  return derived();
+}
+
 #define EIGEN_MAKE_SCALAR_CWISE_UNARY_OP(METHOD_NAME,FUNCTOR) \
   inline const CwiseUnaryOp<std::binder2nd<FUNCTOR<Scalar> >, const Derived> \
   METHOD_NAME(const Scalar& s) const { \
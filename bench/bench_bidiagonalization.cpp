@@ -0,0 +1,78 @@
+
+// g++ -DNDEBUG -O3 -I.. bench_bidiagonalization.cpp -o bench_bidiagonalization && ./bench_bidiagonalization
+// options:
+//  -DSCALAR=float
+//  -DTRIES=3
+// Compares the blocked reduction to upper bidiagonal form performed by internal::UpperBidiagonalization,
+// which applies the reflectors of panels to the trailing matrix by matrix products, to the unblocked
+// reduction applying each reflector in turn. Both are timed on square matrices of size 1000 to 4000.
+
+#include <iostream>
+#include <Eigen/SVD>
+#include <bench/BenchTimer.h>
+using namespace Eigen;
+
+#ifndef SCALAR
+#define SCALAR double
+#endif
+
+#ifndef TRIES
+#define TRIES 1
+#endif
+
+typedef SCALAR Scalar;
+typedef Matrix<Scalar,Dynamic,Dynamic> Mat;
+
+// the reference reduction, one reflector at a time
+EIGEN_DONT_INLINE void bidiagonalize_unblocked(Mat& A, Matrix<Scalar,Dynamic,1>& diag, Matrix<Scalar,Dynamic,1>& superdiag)
+{
+  typedef Mat::Index Index;
+  typedef NumTraits<Scalar>::Real RealScalar;
+  Index rows = A.rows(), cols = A.cols();
+  Matrix<Scalar,Dynamic,1> temp(rows);
+  diag.resize(cols);
+  superdiag.resize(cols-1);
+  for(Index k = 0; ; ++k)
+  {
+    Index remainingRows = rows - k;
+    Index remainingCols = cols - k - 1;
+    RealScalar beta;
+    A.col(k).tail(remainingRows).makeHouseholderInPlace(A.coeffRef(k,k), beta);
+    diag(k) = beta;
+    A.bottomRightCorner(remainingRows, remainingCols)
+     .applyHouseholderOnTheLeft(A.col(k).tail(remainingRows-1), A.coeff(k,k), temp.data());
+    if(k == cols-1) break;
+    A.row(k).tail(remainingCols).makeHouseholderInPlace(A.coeffRef(k,k+1), beta);
+    superdiag(k) = beta;
+    A.bottomRightCorner(remainingRows-1, remainingCols)
+     .applyHouseholderOnTheRight(A.row(k).tail(remainingCols-1).transpose(), A.coeff(k,k+1), temp.data());
+  }
+}
+
+int main()
+{
+  for(int size = 1000; size <= 4000; size += 1000)
+  {
+    Mat A = Mat::Random(size,size);
+    BenchTimer tBlocked, tUnblocked;
+    Matrix<Scalar,Dynamic,1> diag, superdiag;
+    for(int t = 0; t < TRIES; ++t)
+    {
+      tBlocked.start();
+      internal::UpperBidiagonalization<Mat> ubd(A);
+      tBlocked.stop();
+
+      Mat B = A;
+      tUnblocked.start();
+      bidiagonalize_unblocked(B, diag, superdiag);
+      tUnblocked.stop();
+
+      if(t == 0)
+        std::cout << "size " << size << "  difference of the factors: "
+                  << (ubd.householder() - B).cwiseAbs().maxCoeff() << "\n";
+    }
+    std::cout << "  blocked:   " << tBlocked.best() << "s\n";
+    std::cout << "  unblocked: " << tUnblocked.best() << "s\n";
+  }
+  return 0;
+}
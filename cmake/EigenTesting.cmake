@@ -243,6 +243,12 @@ macro(ei_testing_print_summary)
       message(STATUS "SSE4.2:            Using architecture defaults")
     endif()
 
+    if(EIGEN_TEST_F16C)
+      message(STATUS "F16C:              ON")
+    else()
+      message(STATUS "F16C:              Using architecture defaults")
+    endif()
+
     if(EIGEN_TEST_ALTIVEC)
       message(STATUS "Altivec:           ON")
     else()
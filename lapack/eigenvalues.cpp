@@ -10,10 +10,36 @@
 #include "common.h"
 #include <Eigen/Eigenvalues>
 
-// computes an LU factorization of a general M-by-N matrix A using partial pivoting with row interchanges
-EIGEN_LAPACK_FUNC(syev,(char *jobz, char *uplo, int* n, Scalar* a, int *lda, Scalar* w, Scalar* /*work*/, int* lwork, int *info))
+// computes the eigenvalues in w and, if jobz is 'V', the eigenvectors in a of the selfadjoint matrix stored in the
+// uplo triangle of a, which must not be empty, and returns the LAPACK info code.
+static int selfadjoint_eigen_solve(char *jobz, char *uplo, int* n, Scalar* a, int *lda, Scalar* w)
+{
+  PlainMatrixType mat(*n,*n);
+  if(UPLO(*uplo)==UP) mat = matrix(a,*n,*n,*lda).adjoint();
+  else                mat = matrix(a,*n,*n,*lda);
+
+  // SelfAdjointEigenSolver computes the eigenvectors by divide and conquer above EIGEN_SELFADJOINT_DC_THRESHOLD
+  bool computeVectors = *jobz=='V' || *jobz=='v';
+  SelfAdjointEigenSolver<PlainMatrixType> eig(mat,computeVectors?ComputeEigenvectors:EigenvaluesOnly);
+
+  if(eig.info()==NoConvergence)
+  {
+    vector(w,*n).setZero();
+    if(computeVectors)
+      matrix(a,*n,*n,*lda).setIdentity();
+    return 1;
+  }
+
+  vector(w,*n) = eig.eigenvalues();
+  if(computeVectors)
+    matrix(a,*n,*n,*lda) = eig.eigenvectors();
+
+  return 0;
+}
+
+// computes all eigenvalues and, optionally, eigenvectors of a real symmetric matrix A
+EIGEN_LAPACK_FUNC(syev,(char *jobz, char *uplo, int* n, Scalar* a, int *lda, Scalar* w, Scalar* work, int* lwork, int *info))
 {
-  // TODO exploit the work buffer
   bool query_size = *lwork==-1;
   
   *info = 0;
@@ -23,57 +49,54 @@ EIGEN_LAPACK_FUNC(syev,(char *jobz, char *uplo, int* n, Scalar* a, int *lda, Sca
   else  if(*lda<std::max(1,*n))                         *info = -5;
   else  if((!query_size) && *lwork<std::max(1,3**n-1))  *info = -8;
   
-//   if(*info==0)
-//   {
-//     int nb = ILAENV( 1, 'SSYTRD', UPLO, N, -1, -1, -1 )
-//          LWKOPT = MAX( 1, ( NB+2 )*N )
-//          WORK( 1 ) = LWKOPT
-// *
-//          IF( LWORK.LT.MAX( 1, 3*N-1 ) .AND. .NOT.LQUERY )
-//      $      INFO = -8
-//       END IF
-// *
-//       IF( INFO.NE.0 ) THEN
-//          CALL XERBLA( 'SSYEV ', -INFO )
-//          RETURN
-//       ELSE IF( LQUERY ) THEN
-//          RETURN
-//       END IF
-  
   if(*info!=0)
   {
     int e = -*info;
     return xerbla_(SCALAR_SUFFIX_UP"SYEV ", &e, 6);
   }
   
+  work[0] = Scalar(std::max(1,3**n-1));
   if(query_size)
-  {
-    *lwork = 0;
     return 0;
-  }
   
   if(*n==0)
     return 0;
   
-  PlainMatrixType mat(*n,*n);
-  if(UPLO(*uplo)==UP) mat = matrix(a,*n,*n,*lda).adjoint();
-  else                mat = matrix(a,*n,*n,*lda);
-  
+  *info = selfadjoint_eigen_solve(jobz, uplo, n, a, lda, w);
+  return 0;
+}
+
+// computes all eigenvalues and, optionally, eigenvectors of a real symmetric matrix A,
+// the eigenvectors being computed by divide and conquer
+EIGEN_LAPACK_FUNC(syevd,(char *jobz, char *uplo, int* n, Scalar* a, int *lda, Scalar* w, Scalar* work, int* lwork, int* iwork, int* liwork, int *info))
+{
+  bool query_size = *lwork==-1 || *liwork==-1;
   bool computeVectors = *jobz=='V' || *jobz=='v';
-  SelfAdjointEigenSolver<PlainMatrixType> eig(mat,computeVectors?ComputeEigenvectors:EigenvaluesOnly);
-  
-  if(eig.info()==NoConvergence)
+  int minwork  = *n<=1 ? 1 : computeVectors ? 1+6**n+2**n**n : 2**n+1;
+  int miniwork = *n<=1 || !computeVectors ? 1 : 3+5**n;
+
+  *info = 0;
+        if(*jobz!='N' && *jobz!='V')                    *info = -1;
+  else  if(UPLO(*uplo)==INVALID)                        *info = -2;
+  else  if(*n<0)                                        *info = -3;
+  else  if(*lda<std::max(1,*n))                         *info = -5;
+  else  if((!query_size) && *lwork<minwork)             *info = -8;
+  else  if((!query_size) && *liwork<miniwork)           *info = -10;
+
+  if(*info!=0)
   {
-    vector(w,*n).setZero();
-    if(computeVectors)
-      matrix(a,*n,*n,*lda).setIdentity();
-    //*info = 1;
-    return 0;
+    int e = -*info;
+    return xerbla_(SCALAR_SUFFIX_UP"SYEVD ", &e, 7);
   }
-  
-  vector(w,*n) = eig.eigenvalues();
-  if(computeVectors)
-    matrix(a,*n,*n,*lda) = eig.eigenvectors();
-  
+
+  work[0] = Scalar(minwork);
+  iwork[0] = miniwork;
+  if(query_size)
+    return 0;
+
+  if(*n==0)
+    return 0;
+
+  *info = selfadjoint_eigen_solve(jobz, uplo, n, a, lda, w);
   return 0;
 }
@@ -131,6 +131,30 @@ template<typename ArrayType> void comparisons(const ArrayType& m)
   // even shorter version:
   VERIFY_IS_APPROX( (m1.abs()<mid).select(0,m1), m3);
 
+  // vectorized selections must exactly match the scalar ones, including on ties
+  m2(r,c) = m1(r,c);
+  Scalar s = m1(r,c);
+  for (int j=0; j<cols; ++j)
+  for (int i=0; i<rows; ++i)
+  {
+    VERIFY_IS_EQUAL( ((m1<m2).select(m1,m2*2))(i,j), m1(i,j)<m2(i,j) ? m1(i,j) : m2(i,j)*2 );
+    VERIFY_IS_EQUAL( ((m1<=m2).select(m1,m2*2))(i,j), m1(i,j)<=m2(i,j) ? m1(i,j) : m2(i,j)*2 );
+    VERIFY_IS_EQUAL( ((m1>m2).select(m1,m2*2))(i,j), m1(i,j)>m2(i,j) ? m1(i,j) : m2(i,j)*2 );
+    VERIFY_IS_EQUAL( ((m1>=m2).select(m1,m2*2))(i,j), m1(i,j)>=m2(i,j) ? m1(i,j) : m2(i,j)*2 );
+    VERIFY_IS_EQUAL( ((m1==m2).select(m1,m2*2))(i,j), m1(i,j)==m2(i,j) ? m1(i,j) : m2(i,j)*2 );
+  }
+  m3 = (m1<m2).select(m1,m2*2);
+  for (int j=0; j<cols; ++j)
+  for (int i=0; i<rows; ++i)
+    VERIFY_IS_EQUAL( m3(i,j), m1(i,j)<m2(i,j) ? m1(i,j) : m2(i,j)*2 );
+  m3 = (m1>=s).select(s,m1);
+  VERIFY( (m3 == (m1.min)(s)).all() );
+  m3 = (m1==s).select(m2,0);
+  VERIFY_IS_EQUAL( m3(r,c), m2(r,c) );
+  VERIFY_IS_EQUAL( (m3!=0).count(), (m1==s).count() );
+  m3.matrix() = m1.matrix().cwiseEqual(s).select(m2.matrix(),m1.matrix());
+  VERIFY( (m3 == (m1==s).select(m2,m1)).all() );
+
   // count
   VERIFY(((m1.abs()+1)>RealScalar(0.1)).count() == rows*cols);
 
@@ -140,6 +164,27 @@ template<typename ArrayType> void comparisons(const ArrayType& m)
   RealScalar a = m1.abs().mean();
   VERIFY( (m1<-a || m1>a).count() == (m1.abs()>a).count());
 
+  // vectorized boolean reductions must match the scalar ones
+  Index n1 = 0, n2 = 0;
+  for (int j=0; j<cols; ++j)
+  for (int i=0; i<rows; ++i)
+  {
+    if (m1(i,j)<m2(i,j)) ++n1;
+    if (m1(i,j)!=s || m2(i,j)>=s) ++n2;
+    VERIFY_IS_EQUAL( ((m1!=m2).select(m1,m2*2))(i,j), m1(i,j)!=m2(i,j) ? m1(i,j) : m2(i,j)*2 );
+  }
+  VERIFY_IS_EQUAL( (m1<m2).count(), n1 );
+  VERIFY_IS_EQUAL( (m1<m2).any(), n1>0 );
+  VERIFY_IS_EQUAL( (m1<m2).all(), n1==rows*cols );
+  VERIFY_IS_EQUAL( (m1!=s || m2>=s).count(), n2 );
+  VERIFY_IS_EQUAL( (m1!=s || m2>=s).all(), n2==rows*cols );
+  VERIFY_IS_EQUAL( (m1.block(0,0,rows,cols/2+1)!=s).count(), rows*(cols/2+1) - (m1.block(0,0,rows,cols/2+1)==s).count() );
+  VERIFY( !(m1!=m1).any() );
+  VERIFY( (m1==m1).all() );
+  VERIFY( (m1==s).any() );
+  VERIFY( (m1.transpose()==s).any() );
+  VERIFY( !(m1!=s && m1==s).any() );
+
   typedef Array<typename ArrayType::Index, Dynamic, 1> ArrayOfIndices;
 
   // TODO allows colwise/rowwise for array
@@ -209,6 +254,16 @@ template<typename ArrayType> void array_real(const ArrayType& m)
   s1 += Scalar(tiny);
   m1 += ArrayType::Constant(rows,cols,Scalar(tiny));
   VERIFY_IS_APPROX(s1/m1, s1 * m1.inverse());
+
+  // NaN detection
+  m3 = m1;
+  VERIFY( !(m3 != m3).any() );
+  Index r = internal::random<Index>(0, rows-1),
+        c = internal::random<Index>(0, cols-1);
+  m3(r,c) = std::numeric_limits<RealScalar>::quiet_NaN();
+  VERIFY( (m3 != m3).any() );
+  VERIFY( !(m3 == m3).all() );
+  VERIFY_IS_EQUAL( (m3 != m3).count(), 1 );
 }
 
 template<typename ArrayType> void array_complex(const ArrayType& m)
@@ -259,6 +314,40 @@ template<typename ArrayType> void min_max(const ArrayType& m)
 
 }
 
+template<typename ArrayType> void array_integer(const ArrayType& m)
+{
+  typedef typename ArrayType::Index Index;
+  typedef typename ArrayType::Scalar Scalar;
+
+  Index rows = m.rows();
+  Index cols = m.cols();
+
+  // large enough for the products to overflow 32 bits, small enough not to overflow Scalar
+  const Scalar range = Scalar(1) << (4*sizeof(Scalar)-2);
+  ArrayType m1(rows, cols), m2(rows, cols), m3(rows, cols);
+  for (Index j=0; j<cols; ++j)
+  for (Index i=0; i<rows; ++i)
+  {
+    m1(i,j) = internal::random<Scalar>(-range,range);
+    m2(i,j) = internal::random<Scalar>(-range,range);
+  }
+
+  m3 = (m1 * m2 + m1) - m2.abs();
+  for (Index j=0; j<cols; ++j)
+  for (Index i=0; i<rows; ++i)
+    VERIFY_IS_EQUAL( m3(i,j), (m1(i,j)*m2(i,j) + m1(i,j)) - internal::abs(m2(i,j)) );
+
+  m3 = ((m1 & m2) | m1.template shiftRight<3>()) ^ m2.template shiftLeft<2>();
+  for (Index j=0; j<cols; ++j)
+  for (Index i=0; i<rows; ++i)
+    VERIFY_IS_EQUAL( m3(i,j), ((m1(i,j) & m2(i,j)) | (m1(i,j) >> 3)) ^ (m2(i,j) << 2) );
+
+  // histogram style binning
+  m3 = (m1 - m1.minCoeff()).template shiftRight<4>() & ArrayType::Constant(rows, cols, 15);
+  VERIFY( (m3 >= 0).all() && (m3 < 16).all() );
+  VERIFY_IS_EQUAL( (m1.min)(m2).sum() + (m1.max)(m2).sum(), m1.sum() + m2.sum() );
+}
+
 void test_array()
 {
   for(int i = 0; i < g_repeat; i++) {
@@ -289,6 +378,11 @@ void test_array()
     CALL_SUBTEST_3( array_real(Array44d()) );
     CALL_SUBTEST_5( array_real(ArrayXXf(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
   }
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_2( array_integer(Array22i()) );
+    CALL_SUBTEST_6( array_integer(ArrayXXi(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_7( array_integer(Array<std::ptrdiff_t,Dynamic,Dynamic>(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+  }
   for(int i = 0; i < g_repeat; i++) {
     CALL_SUBTEST_4( array_complex(ArrayXXcf(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
   }
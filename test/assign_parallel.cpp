@@ -0,0 +1,126 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "main.h"
+
+// The parallel and the sequential assignments must give exactly the same coefficients.
+template<typename Dst, typename Src>
+void check_parallel_assign(const Dst& dst, const Src& src)
+{
+  const int threads = nbThreads();
+  setNbThreads(1);
+  dst.const_cast_derived() = src;
+  typename Dst::PlainObject ref = dst;
+  setNbThreads(threads);
+  dst.const_cast_derived().setZero();
+  dst.const_cast_derived() = src;
+  VERIFY((dst == ref).all());
+}
+
+template<typename ArrayType> void assign_parallel_linear(typename ArrayType::Index size)
+{
+  typedef typename ArrayType::Scalar Scalar;
+  ArrayType a = ArrayType::Random(size), b = ArrayType::Random(size), c = ArrayType::Random(size);
+  ArrayType d = ArrayType::Random(size) + Scalar(2);
+  ArrayType r(size);
+
+  check_parallel_assign(r, b.exp() * c + d.log());
+  check_parallel_assign(r, a * Scalar(2));
+  check_parallel_assign(r, (a*a).sqrt() - c);
+
+  // unaligned destination and source
+  check_parallel_assign(r.segment(1, size-3), b.segment(2, size-3).exp() + a.segment(1, size-3));
+}
+
+template<typename MatrixType> void assign_parallel_inner(typename MatrixType::Index cols)
+{
+  typename MatrixType::Index rows = MatrixType::RowsAtCompileTime;
+  MatrixType a = MatrixType::Random(rows, cols), b = MatrixType::Random(rows, cols);
+  MatrixType r(rows, cols);
+  check_parallel_assign(r.array(), a.array().exp() * b.array() + a.array().sin());
+}
+
+template<typename ArrayType> void assign_parallel_partial_redux(typename ArrayType::Index rows)
+{
+  typedef typename ArrayType::Scalar Scalar;
+  ArrayType a = ArrayType::Random(rows, 1024);
+  Array<Scalar,1,Dynamic> r(1024);
+  check_parallel_assign(r, a.colwise().sum());
+  check_parallel_assign(r, a.colwise().maxCoeff());
+  check_parallel_assign(r.transpose(), a.transpose().rowwise().prod());
+}
+
+// The sequential LinSpaced keeps its position in the functor: it must never be split among threads, and each
+// expression can only be evaluated once.
+template<typename ArrayType> void assign_parallel_linspaced(typename ArrayType::Index size)
+{
+  typedef typename ArrayType::Scalar Scalar;
+  ArrayType a = ArrayType::Random(size);
+  ArrayType r(size), ref(size);
+  const int threads = nbThreads();
+  for(int k = 0; k < 3; ++k)
+  {
+    for(int t = 1; t <= 4; t += 3)
+    {
+      setNbThreads(t);
+      ArrayType& dst = t==1 ? ref : r;
+      if(k==0)      dst = ArrayType::LinSpaced(Sequential, size, Scalar(-1), Scalar(1));
+      else if(k==1) dst = ArrayType::LinSpaced(Sequential, size, Scalar(0), Scalar(2)) * a.abs();
+      else          dst = (a>Scalar(0)).select(a, ArrayType::LinSpaced(Sequential, size, Scalar(0), Scalar(1)));
+    }
+    VERIFY((r == ref).all());
+  }
+  setNbThreads(threads);
+}
+
+// A user functor with a state is evaluated in order by a single thread unless it opts in.
+template<typename Scalar> struct counting_op
+{
+  counting_op() : m_count(0) {}
+  Scalar operator()(const Scalar& a) const { return a + Scalar(m_count++); }
+  Scalar operator()(const Scalar& a, const Scalar& b) const { return a - b * Scalar(m_count++); }
+  mutable DenseIndex m_count;
+};
+
+template<typename ArrayType> void assign_parallel_stateful(typename ArrayType::Index size)
+{
+  typedef typename ArrayType::Scalar Scalar;
+  typedef typename ArrayType::Index Index;
+  ArrayType a = ArrayType::Random(size), b = ArrayType::Random(size);
+  ArrayType r(size);
+  const int threads = nbThreads();
+  setNbThreads(4);
+  VERIFY(int(internal::traits<CwiseUnaryOp<counting_op<Scalar>,ArrayType> >::Flags) & ParallelUnsafeBit);
+  VERIFY(!(int(internal::traits<CwiseUnaryOp<internal::scalar_exp_op<Scalar>,ArrayType> >::Flags) & ParallelUnsafeBit));
+
+  r = a.abs().unaryExpr(counting_op<Scalar>());
+  for(Index i = 0; i < size; ++i)
+    VERIFY(r(i) == std::abs(a(i)) + Scalar(i));
+
+  r = a.binaryExpr(b * Scalar(2), counting_op<Scalar>()) + a;
+  for(Index i = 0; i < size; ++i)
+    VERIFY(r(i) == (a(i) - (b(i) * Scalar(2)) * Scalar(i)) + a(i));
+  setNbThreads(threads);
+}
+
+void test_assign_parallel()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    int size = internal::random<int>(100000,400000);
+    CALL_SUBTEST_1( assign_parallel_linear<ArrayXf>(size) );
+    CALL_SUBTEST_2( assign_parallel_linear<ArrayXd>(size) );
+    CALL_SUBTEST_3( assign_parallel_linear<ArrayXcd>(size/4) );
+    CALL_SUBTEST_4( (assign_parallel_inner<Matrix<float,8,Dynamic> >(size/8)) );
+    CALL_SUBTEST_4( (assign_parallel_inner<Matrix<double,4,Dynamic> >(size/4)) );
+    CALL_SUBTEST_5( (assign_parallel_partial_redux<Array<float,Dynamic,Dynamic,RowMajor> >(size/1024)) );
+    CALL_SUBTEST_5( (assign_parallel_partial_redux<Array<double,Dynamic,Dynamic,RowMajor> >(size/1024)) );
+  }
+  CALL_SUBTEST_1( assign_parallel_linspaced<ArrayXf>(1<<20) );
+  CALL_SUBTEST_2( assign_parallel_linspaced<ArrayXd>(1<<20) );
+  CALL_SUBTEST_1( assign_parallel_stateful<ArrayXf>(1<<18) );
+  CALL_SUBTEST_2( assign_parallel_stateful<ArrayXd>(1<<18) );
+}
@@ -178,6 +178,38 @@ void casting()
 }
 #endif
 
+// vectorized casts must match static_cast coefficient-wise, whatever the packet sizes
+template<typename SrcMatrix, typename TgtScalar>
+void castingCoeffwise(const SrcMatrix& m)
+{
+  typedef typename SrcMatrix::Index Index;
+  typedef typename SrcMatrix::Scalar SrcScalar;
+  typedef Matrix<TgtScalar,Dynamic,Dynamic,SrcMatrix::Options> TgtMatrix;
+  Index rows = m.rows(), cols = m.cols();
+
+  SrcMatrix src(rows, cols);
+  for(Index j = 0; j < cols; ++j)
+    for(Index i = 0; i < rows; ++i)
+      src(i,j) = internal::random<SrcScalar>(SrcScalar(-1000), SrcScalar(1000));
+  TgtMatrix tgt = src.template cast<TgtScalar>();
+  for(Index j = 0; j < cols; ++j)
+    for(Index i = 0; i < rows; ++i)
+      VERIFY_IS_EQUAL(tgt(i,j), static_cast<TgtScalar>(src(i,j)));
+
+  Index r = internal::random<Index>(0, rows-1), c = internal::random<Index>(0, cols-1);
+  TgtMatrix blk = src.block(r, c, rows-r, cols-c).template cast<TgtScalar>();
+  for(Index j = 0; j < cols-c; ++j)
+    for(Index i = 0; i < rows-r; ++i)
+      VERIFY_IS_EQUAL(blk(i,j), static_cast<TgtScalar>(src(r+i,c+j)));
+
+  TgtMatrix other = TgtMatrix::Random(rows, cols);
+  TgtMatrix sum = src.template cast<TgtScalar>() + other;
+  for(Index j = 0; j < cols; ++j)
+    for(Index i = 0; i < rows; ++i)
+      VERIFY_IS_EQUAL(sum(i,j), TgtScalar(static_cast<TgtScalar>(src(i,j)) + other(i,j)));
+  VERIFY_IS_APPROX(src.template cast<TgtScalar>().sum(), tgt.sum());
+}
+
 template <typename Scalar>
 void fixedSizeMatrixConstruction()
 {
@@ -212,4 +244,16 @@ void test_basicstuff()
   CALL_SUBTEST_1(fixedSizeMatrixConstruction<double>());
 
   CALL_SUBTEST_2(casting());
+
+  for(int i = 0; i < g_repeat; i++) {
+    int rows = internal::random<int>(1,EIGEN_TEST_MAX_SIZE), cols = internal::random<int>(1,EIGEN_TEST_MAX_SIZE);
+    CALL_SUBTEST_8(( castingCoeffwise<MatrixXd,float>(MatrixXd(rows,cols)) ));
+    CALL_SUBTEST_8(( castingCoeffwise<MatrixXf,double>(MatrixXf(rows,cols)) ));
+    CALL_SUBTEST_8(( castingCoeffwise<MatrixXi,float>(MatrixXi(rows,cols)) ));
+    CALL_SUBTEST_8(( castingCoeffwise<MatrixXf,int>(MatrixXf(rows,cols)) ));
+    CALL_SUBTEST_8(( castingCoeffwise<MatrixXi,double>(MatrixXi(rows,cols)) ));
+    CALL_SUBTEST_8(( castingCoeffwise<MatrixXd,int>(MatrixXd(rows,cols)) ));
+    CALL_SUBTEST_8(( castingCoeffwise<Matrix<double,Dynamic,Dynamic,RowMajor>,float>(Matrix<double,Dynamic,Dynamic,RowMajor>(rows,cols)) ));
+    CALL_SUBTEST_8(( castingCoeffwise<Matrix<float,Dynamic,Dynamic,RowMajor>,double>(Matrix<float,Dynamic,Dynamic,RowMajor>(rows,cols)) ));
+  }
 }
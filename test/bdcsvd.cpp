@@ -0,0 +1,245 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "main.h"
+#include <Eigen/SVD>
+
+template<typename MatrixType>
+void bdcsvd_check_full(const MatrixType& m, const BDCSVD<MatrixType>& svd)
+{
+  typedef typename MatrixType::Index Index;
+  Index rows = m.rows();
+  Index cols = m.cols();
+
+  enum {
+    RowsAtCompileTime = MatrixType::RowsAtCompileTime,
+    ColsAtCompileTime = MatrixType::ColsAtCompileTime
+  };
+
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, RowsAtCompileTime, RowsAtCompileTime> MatrixUType;
+  typedef Matrix<Scalar, ColsAtCompileTime, ColsAtCompileTime> MatrixVType;
+
+  MatrixType sigma = MatrixType::Zero(rows,cols);
+  sigma.diagonal() = svd.singularValues().template cast<Scalar>();
+  MatrixUType u = svd.matrixU();
+  MatrixVType v = svd.matrixV();
+
+  VERIFY_IS_APPROX(m, u * sigma * v.adjoint());
+  VERIFY_IS_UNITARY(u);
+  VERIFY_IS_UNITARY(v);
+  for(Index i = 1; i < svd.singularValues().size(); ++i)
+    VERIFY(svd.singularValues().coeff(i-1) >= svd.singularValues().coeff(i));
+}
+
+template<typename MatrixType>
+void bdcsvd_compare_to_full(const MatrixType& m,
+                            unsigned int computationOptions,
+                            const BDCSVD<MatrixType>& referenceSvd)
+{
+  typedef typename MatrixType::Index Index;
+  Index rows = m.rows();
+  Index cols = m.cols();
+  Index diagSize = (std::min)(rows, cols);
+
+  BDCSVD<MatrixType> svd(m, computationOptions);
+
+  VERIFY_IS_APPROX(svd.singularValues(), referenceSvd.singularValues());
+  if(computationOptions & ComputeFullU)
+    VERIFY_IS_APPROX(svd.matrixU(), referenceSvd.matrixU());
+  if(computationOptions & ComputeThinU)
+    VERIFY_IS_APPROX(svd.matrixU(), referenceSvd.matrixU().leftCols(diagSize));
+  if(computationOptions & ComputeFullV)
+    VERIFY_IS_APPROX(svd.matrixV(), referenceSvd.matrixV());
+  if(computationOptions & ComputeThinV)
+    VERIFY_IS_APPROX(svd.matrixV(), referenceSvd.matrixV().leftCols(diagSize));
+}
+
+template<typename MatrixType>
+void bdcsvd_solve(const MatrixType& m, unsigned int computationOptions)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  Index rows = m.rows();
+  Index cols = m.cols();
+
+  enum {
+    RowsAtCompileTime = MatrixType::RowsAtCompileTime,
+    ColsAtCompileTime = MatrixType::ColsAtCompileTime
+  };
+
+  typedef Matrix<Scalar, RowsAtCompileTime, Dynamic> RhsType;
+  typedef Matrix<Scalar, ColsAtCompileTime, Dynamic> SolutionType;
+
+  RhsType rhs = RhsType::Random(rows, internal::random<Index>(1, cols));
+  BDCSVD<MatrixType> svd(m, computationOptions);
+  SolutionType x = svd.solve(rhs);
+  // evaluate normal equation which works also for least-squares solutions
+  VERIFY_IS_APPROX(m.adjoint()*m*x,m.adjoint()*rhs);
+}
+
+template<typename MatrixType>
+void bdcsvd_test_all_computation_options(const MatrixType& m)
+{
+  BDCSVD<MatrixType> fullSvd(m, ComputeFullU|ComputeFullV);
+
+  bdcsvd_check_full(m, fullSvd);
+  bdcsvd_solve(m, ComputeFullU | ComputeFullV);
+
+  // the singular values are those of JacobiSVD
+  VERIFY_IS_APPROX(fullSvd.singularValues(), m.jacobiSvd().singularValues());
+
+  bdcsvd_compare_to_full(m, ComputeFullU, fullSvd);
+  bdcsvd_compare_to_full(m, ComputeFullV, fullSvd);
+  bdcsvd_compare_to_full(m, 0, fullSvd);
+
+  if (MatrixType::ColsAtCompileTime == Dynamic) {
+    // thin U/V are only available with dynamic number of columns
+    bdcsvd_compare_to_full(m, ComputeFullU|ComputeThinV, fullSvd);
+    bdcsvd_compare_to_full(m,              ComputeThinV, fullSvd);
+    bdcsvd_compare_to_full(m, ComputeThinU|ComputeFullV, fullSvd);
+    bdcsvd_compare_to_full(m, ComputeThinU             , fullSvd);
+    bdcsvd_compare_to_full(m, ComputeThinU|ComputeThinV, fullSvd);
+    bdcsvd_solve(m, ComputeThinU | ComputeThinV);
+
+    // test reconstruction
+    typedef typename MatrixType::Index Index;
+    Index diagSize = (std::min)(m.rows(), m.cols());
+    BDCSVD<MatrixType> svd(m, ComputeThinU | ComputeThinV);
+    VERIFY_IS_APPROX(m, svd.matrixU().leftCols(diagSize) * svd.singularValues().asDiagonal() * svd.matrixV().leftCols(diagSize).adjoint());
+  }
+}
+
+template<typename MatrixType>
+void bdcsvd(const MatrixType& a = MatrixType(), bool pickrandom = true)
+{
+  MatrixType m = pickrandom ? MatrixType::Random(a.rows(), a.cols()) : a;
+  bdcsvd_test_all_computation_options<MatrixType>(m);
+}
+
+// singular values which are repeated, clustered or zero, such that the divide and conquer deflates
+template<typename MatrixType>
+void bdcsvd_deflation(int rows, int cols)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::RealScalar RealScalar;
+  typedef Matrix<Scalar, Dynamic, Dynamic> SquareMatrixType;
+  typedef Matrix<RealScalar, Dynamic, 1> RealVectorType;
+
+  int diagSize = (std::min)(rows, cols);
+  SquareMatrixType U = SquareMatrixType::Random(rows,rows).householderQr().householderQ();
+  SquareMatrixType V = SquareMatrixType::Random(cols,cols).householderQr().householderQ();
+  RealVectorType s(diagSize);
+  for(int i = 0; i < diagSize; ++i)
+    s(i) = i%3==0 ? RealScalar(1) : i%5==0 ? RealScalar(0) : RealScalar(i%7) + RealScalar(i)*NumTraits<RealScalar>::epsilon();
+  MatrixType sigma = MatrixType::Zero(rows,cols);
+  sigma.diagonal() = s.template cast<Scalar>();
+  MatrixType m = U * sigma * V.adjoint();
+
+  BDCSVD<MatrixType> svd(m, ComputeThinU|ComputeThinV);
+  std::sort(s.data(), s.data()+diagSize);
+  VERIFY_IS_APPROX(svd.singularValues(), RealVectorType(s.reverse()));
+  VERIFY_IS_APPROX(m, svd.matrixU() * svd.singularValues().asDiagonal() * svd.matrixV().adjoint());
+  VERIFY_IS_UNITARY(svd.matrixU());
+  VERIFY_IS_UNITARY(svd.matrixV());
+
+  // an exactly bidiagonal matrix with zeros on its diagonal
+  MatrixType b = MatrixType::Zero(rows,cols);
+  for(int i = 0; i < diagSize; ++i)
+  {
+    b(i,i) = i%4==0 ? Scalar(0) : internal::random<Scalar>();
+    if(i+1 < cols)
+      b(i,i+1) = internal::random<Scalar>();
+  }
+  bdcsvd_check_full(b, BDCSVD<MatrixType>(b, ComputeFullU|ComputeFullV));
+  bdcsvd_check_full(MatrixType(MatrixType::Zero(rows,cols)), BDCSVD<MatrixType>(MatrixType::Zero(rows,cols), ComputeFullU|ComputeFullV));
+}
+
+template<typename MatrixType> void bdcsvd_verify_assert(const MatrixType& m)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  Index rows = m.rows();
+  Index cols = m.cols();
+
+  typedef Matrix<Scalar, MatrixType::RowsAtCompileTime, 1> RhsType;
+
+  RhsType rhs(rows);
+
+  BDCSVD<MatrixType> svd;
+  VERIFY_RAISES_ASSERT(svd.matrixU())
+  VERIFY_RAISES_ASSERT(svd.singularValues())
+  VERIFY_RAISES_ASSERT(svd.matrixV())
+  VERIFY_RAISES_ASSERT(svd.solve(rhs))
+
+  MatrixType a = MatrixType::Zero(rows, cols);
+  svd.compute(a, 0);
+  VERIFY_RAISES_ASSERT(svd.matrixU())
+  VERIFY_RAISES_ASSERT(svd.matrixV())
+  svd.singularValues();
+  VERIFY_RAISES_ASSERT(svd.solve(rhs))
+
+  if (MatrixType::ColsAtCompileTime == Dynamic)
+  {
+    svd.compute(a, ComputeThinU);
+    svd.matrixU();
+    VERIFY_RAISES_ASSERT(svd.matrixV())
+    VERIFY_RAISES_ASSERT(svd.solve(rhs))
+  }
+  else
+  {
+    VERIFY_RAISES_ASSERT(svd.compute(a, ComputeThinU))
+    VERIFY_RAISES_ASSERT(svd.compute(a, ComputeThinV))
+  }
+}
+
+template<typename MatrixType>
+void bdcsvd_method()
+{
+  enum { Size = MatrixType::RowsAtCompileTime };
+  typedef typename MatrixType::RealScalar RealScalar;
+  typedef Matrix<RealScalar, Size, 1> RealVecType;
+  MatrixType m = MatrixType::Identity();
+  VERIFY_IS_APPROX(m.bdcSvd().singularValues(), RealVecType::Ones());
+  VERIFY_RAISES_ASSERT(m.bdcSvd().matrixU());
+  VERIFY_RAISES_ASSERT(m.bdcSvd().matrixV());
+  VERIFY_IS_APPROX(m.bdcSvd(ComputeFullU|ComputeFullV).solve(m), m);
+}
+
+void test_bdcsvd()
+{
+  CALL_SUBTEST_1(( bdcsvd_verify_assert(Matrix3f()) ));
+  CALL_SUBTEST_2(( bdcsvd_verify_assert(MatrixXd(40,30)) ));
+
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1(( bdcsvd<Matrix3f>() ));
+    CALL_SUBTEST_1(( bdcsvd<Matrix<double,Dynamic,2> >(Matrix<double,Dynamic,2>(10,2)) ));
+
+    int r = internal::random<int>(1, EIGEN_TEST_MAX_SIZE/2),
+        c = internal::random<int>(1, EIGEN_TEST_MAX_SIZE/2);
+    CALL_SUBTEST_2(( bdcsvd<MatrixXd>(MatrixXd(r,c)) ));
+    CALL_SUBTEST_3(( bdcsvd<MatrixXf>(MatrixXf(r,c)) ));
+    CALL_SUBTEST_4(( bdcsvd<MatrixXcd>(MatrixXcd(r,c)) ));
+    CALL_SUBTEST_5(( bdcsvd<Matrix<double,Dynamic,Dynamic,RowMajor> >(Matrix<double,Dynamic,Dynamic,RowMajor>(c,r)) ));
+    (void) r;
+    (void) c;
+
+    r = internal::random<int>(EIGEN_BDCSVD_THRESHOLD+1, EIGEN_TEST_MAX_SIZE);
+    c = internal::random<int>(EIGEN_BDCSVD_THRESHOLD+1, EIGEN_TEST_MAX_SIZE);
+    CALL_SUBTEST_6(( bdcsvd_deflation<MatrixXd>(r,c) ));
+    CALL_SUBTEST_6(( bdcsvd_deflation<MatrixXcf>(c,r) ));
+  }
+
+  CALL_SUBTEST_2(( bdcsvd<MatrixXd>(MatrixXd(internal::random<int>(EIGEN_TEST_MAX_SIZE/2, EIGEN_TEST_MAX_SIZE), internal::random<int>(EIGEN_TEST_MAX_SIZE/2, EIGEN_TEST_MAX_SIZE))) ));
+
+  // test matrixbase method
+  CALL_SUBTEST_1(( bdcsvd_method<Matrix3f>() ));
+  CALL_SUBTEST_2(( bdcsvd_method<Matrix<double,40,40> >() ));
+
+  // Test problem size constructors
+  CALL_SUBTEST_3( BDCSVD<MatrixXf>(10,10) );
+}
@@ -0,0 +1,164 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "main.h"
+
+typedef Matrix<bfloat16,Dynamic,Dynamic> MatrixXbf;
+typedef Matrix<bfloat16,Dynamic,Dynamic,RowMajor> RowMatrixXbf;
+typedef Matrix<bfloat16,Dynamic,1> VectorXbf;
+
+namespace Eigen {
+inline bool test_isApprox(const bfloat16& a, const bfloat16& b)
+{ return internal::isApprox(a, b, test_precision<bfloat16>()); }
+}
+
+float float_from_bits(unsigned int u)
+{
+  float f;
+  std::memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+void bfloat16_conversions()
+{
+  // every bfloat16 is exactly representable as a float
+  for(int bits = 0; bits < 0x10000; ++bits)
+  {
+    bfloat16 h = bfloat16::fromBits(static_cast<unsigned short>(bits));
+    if((bits & 0x7f80) != 0x7f80 || (bits & 0x7f) == 0)
+      VERIFY_IS_EQUAL(bfloat16(float(h)).x, h.x);
+  }
+
+  VERIFY_IS_EQUAL(bfloat16(1.f).x, 0x3f80);
+  VERIFY_IS_EQUAL(bfloat16(-2.f).x, 0xc000);
+  VERIFY_IS_EQUAL(bfloat16(65536.f).x, 0x4780);
+  VERIFY_IS_EQUAL(bfloat16(-0.f).x, 0x8000);
+  VERIFY_IS_EQUAL(bfloat16(float_from_bits(0x7f7fffff)).x, 0x7f80);
+  VERIFY_IS_EQUAL(bfloat16(float_from_bits(0x7f800001)).x & 0x7fc0, 0x7fc0);
+  VERIFY_IS_EQUAL(bfloat16::truncate(float_from_bits(0x7f800001)).x & 0x7fc0, 0x7fc0);
+  // ties are rounded to even, truncation rounds toward zero
+  VERIFY_IS_EQUAL(bfloat16(float_from_bits(0x3f808000)).x, 0x3f80);
+  VERIFY_IS_EQUAL(bfloat16(float_from_bits(0x3f818000)).x, 0x3f82);
+  VERIFY_IS_EQUAL(bfloat16(float_from_bits(0x3f80c000)).x, 0x3f81);
+  VERIFY_IS_EQUAL(bfloat16::truncate(float_from_bits(0x3f80ffff)).x, 0x3f80);
+  // a double is rounded once: through the nearest float, this would be a tie rounded down
+  VERIFY_IS_EQUAL(bfloat16(1. + 1./256. + 1e-12).x, 0x3f81);
+  VERIFY_IS_EQUAL(bfloat16(1. + 1./256.).x, 0x3f80);
+  VERIFY_IS_EQUAL(bfloat16::truncate(float_from_bits(0xbf80ffff)).x, 0xbf80);
+
+  // the exponent range is the one of float
+  VERIFY_IS_EQUAL(float(bfloat16(1e30f)) * 0.f, 0.f);
+  VERIFY_IS_APPROX(bfloat16(1e30f), bfloat16(1.0009e30f));
+  VERIFY_IS_EQUAL(float(NumTraits<bfloat16>::epsilon()), 1.f/128.f);
+  VERIFY_IS_EQUAL(float((std::numeric_limits<bfloat16>::min)()), (std::numeric_limits<float>::min)());
+  VERIFY(float(std::numeric_limits<bfloat16>::infinity()) > (std::numeric_limits<float>::max)());
+
+  // the vectorized conversions round like the scalar ones
+  const int n = 4096;
+  Matrix<float,Dynamic,1> f(n);
+  for(int k = 0; k < n; ++k)
+    f(k) = float_from_bits(internal::random<unsigned int>(0u, 0xffffffffu));
+  VectorXbf h = f.cast<bfloat16>();
+  for(int k = 0; k < n; ++k)
+    VERIFY_IS_EQUAL(h(k).x, bfloat16(f(k)).x);
+  Matrix<float,Dynamic,1> g = h.cast<float>();
+  for(int k = 0; k < n; ++k)
+    VERIFY_IS_EQUAL(internal::float_to_bfloat16_truncate(g(k)), h(k).x);
+}
+
+void bfloat16_arithmetic()
+{
+  bfloat16 a(1.5f), b(-0.25f);
+  VERIFY_IS_EQUAL(float(a+b), 1.25f);
+  VERIFY_IS_EQUAL(float(a-b), 1.75f);
+  VERIFY_IS_EQUAL(float(a*b), -0.375f);
+  VERIFY_IS_EQUAL(float(a/b), -6.f);
+  VERIFY_IS_EQUAL(float(-a), -1.5f);
+  VERIFY(b < a && a > b && a != b && a == bfloat16(1.5f));
+  a *= b;
+  VERIFY_IS_EQUAL(float(a), -0.375f);
+  VERIFY_IS_EQUAL(float(internal::abs(b)), 0.25f);
+  VERIFY_IS_EQUAL(float(internal::sqrt(bfloat16(4.f))), 2.f);
+  VERIFY_IS_APPROX(internal::exp(bfloat16(1.f)), bfloat16(2.71828f));
+
+  for(int k = 0; k < 100; ++k)
+  {
+    bfloat16 r = internal::random<bfloat16>();
+    VERIFY(float(r) >= -1.f && float(r) <= 1.f);
+  }
+}
+
+template<typename MatrixType> void bfloat16_cwise(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef Matrix<float,MatrixType::RowsAtCompileTime,MatrixType::ColsAtCompileTime,MatrixType::Options> MatrixF;
+  Index rows = m.rows(), cols = m.cols();
+
+  MatrixType a = MatrixType::Random(rows,cols), b = MatrixType::Random(rows,cols);
+  MatrixF af = a.template cast<float>(), bf = b.template cast<float>();
+
+  // each coefficient is computed in float and rounded once
+  VERIFY_IS_EQUAL(MatrixType(a+b), MatrixType((af+bf).template cast<bfloat16>()));
+  VERIFY_IS_EQUAL(MatrixType(a-b), MatrixType((af-bf).template cast<bfloat16>()));
+  VERIFY_IS_EQUAL(MatrixType(a.cwiseProduct(b)), MatrixType(af.cwiseProduct(bf).template cast<bfloat16>()));
+  VERIFY_IS_EQUAL(MatrixType(-a), MatrixType((-af).template cast<bfloat16>()));
+  VERIFY_IS_EQUAL(MatrixType(a.cwiseAbs()), MatrixType(af.cwiseAbs().template cast<bfloat16>()));
+  VERIFY_IS_EQUAL(MatrixType(a.cwiseMin(b)), MatrixType(af.cwiseMin(bf).template cast<bfloat16>()));
+  VERIFY_IS_EQUAL(MatrixType(a*bfloat16(3.f)), MatrixType((af*3.f).template cast<bfloat16>()));
+  VERIFY_IS_APPROX(a.array().abs().sqrt().matrix(), af.array().abs().sqrt().matrix().template cast<bfloat16>());
+  VERIFY_IS_APPROX(a.array().exp().matrix(), af.array().exp().matrix().template cast<bfloat16>());
+  // reductions accumulate in bfloat16, hence only check small ones
+  Index r = (std::min)(rows,Index(4)), c = (std::min)(cols,Index(4));
+  VERIFY_IS_APPROX(a.cwiseAbs().topLeftCorner(r,c).sum(), bfloat16(af.cwiseAbs().topLeftCorner(r,c).sum()));
+  VERIFY_IS_EQUAL(a.minCoeff(), bfloat16(af.minCoeff()));
+  VERIFY_IS_EQUAL(MatrixF(a.template cast<float>()), af);
+}
+
+template<typename MatrixType> void bfloat16_product(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef Matrix<float,Dynamic,Dynamic> MatrixXf_;
+  Index rows = m.rows(), cols = m.cols(), depth = internal::random<Index>(1,EIGEN_TEST_MAX_SIZE);
+
+  MatrixType a = MatrixType::Random(rows,depth), b = MatrixType::Random(depth,cols);
+  VectorXbf v = VectorXbf::Random(depth), w = VectorXbf::Random(rows);
+  MatrixXf_ af = a.template cast<float>(), bf = b.template cast<float>();
+
+  // large products accumulate in float, so that they match the float product rounded once
+  MatrixXbf c = MatrixXbf::Zero(rows,cols);
+  c.noalias() += a * b;
+  VERIFY_IS_APPROX(c, MatrixXbf((af*bf).cast<bfloat16>()));
+  VERIFY_IS_APPROX(MatrixXbf(a.adjoint() * a), MatrixXbf((af.adjoint()*af).cast<bfloat16>()));
+
+#ifdef EIGEN_HAS_OPENMP
+  // a product computed by several threads gives the same result
+  int threads = nbThreads();
+  setNbThreads(4);
+  c.noalias() = a * b;
+  setNbThreads(threads);
+  VERIFY_IS_APPROX(c, MatrixXbf((af*bf).cast<bfloat16>()));
+#endif
+
+  VectorXbf r = w;
+  r.noalias() += a * v;
+  VERIFY_IS_APPROX(r, VectorXbf((w.cast<float>() + af*v.cast<float>()).cast<bfloat16>()));
+  VectorXbf s = v;
+  s.noalias() -= a.transpose() * w;
+  VERIFY_IS_APPROX(s, VectorXbf((v.cast<float>() - af.transpose()*w.cast<float>()).cast<bfloat16>()));
+}
+
+void test_bfloat16_float()
+{
+  CALL_SUBTEST_1( bfloat16_conversions() );
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( bfloat16_arithmetic() );
+    CALL_SUBTEST_2( bfloat16_cwise(Matrix<bfloat16,4,4>()) );
+    CALL_SUBTEST_2( bfloat16_cwise(MatrixXbf(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_3( bfloat16_product(MatrixXbf(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_3( bfloat16_product(RowMatrixXbf(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+  }
+}
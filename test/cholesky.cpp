@@ -62,7 +62,7 @@ template<typename MatrixType> void cholesky(const MatrixType& m)
 {
   typedef typename MatrixType::Index Index;
   /* this test covers the following files:
-     LLT.h LDLT.h
+     LLT.h LDLT.h BunchKaufman.h
   */
   Index rows = m.rows();
   Index cols = m.cols();
@@ -246,6 +246,102 @@ template<typename MatrixType> void cholesky_cplx(const MatrixType& m)
   }
 }
 
+template<typename MatrixType> void cholesky_blocked(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, MatrixType::RowsAtCompileTime, 1> VectorType;
+  typedef Transpositions<MatrixType::RowsAtCompileTime> TranspositionType;
+  Index size = m.rows();
+
+  MatrixType a = MatrixType::Random(size,size);
+  MatrixType symm = a * a.adjoint() + MatrixType::Identity(size,size);
+  if(internal::random<int>()%2)
+    symm = -symm;
+
+  // the blocked LDLT chooses the same pivots as the unblocked one
+  MatrixType m1 = symm.template triangularView<Lower>(), m2 = m1;
+  TranspositionType t1(size), t2(size);
+  VectorType temp(size);
+  int sign1, sign2;
+  internal::ldlt_inplace<Lower>::unblocked(m1, t1, temp, &sign1);
+  internal::ldlt_inplace<Lower>::blocked(m2, t2, temp, &sign2);
+  VERIFY(t1.indices() == t2.indices());
+  VERIFY_IS_EQUAL(sign1, sign2);
+  VERIFY_IS_APPROX(MatrixType(m1.template triangularView<Lower>()), MatrixType(m2.template triangularView<Lower>()));
+
+  LDLT<MatrixType,Upper> ldltup(symm);
+  VERIFY_IS_APPROX(symm, ldltup.reconstructedMatrix());
+
+  // the tiled LLT computes the same factor as the blocked one, whatever the tile size
+  typedef internal::llt_inplace<Scalar,Lower> LltLower;
+  typedef internal::llt_inplace<Scalar,Upper> LltUpper;
+  MatrixType spd = a * a.adjoint() + MatrixType::Identity(size,size);
+  Index tileSize = internal::random<Index>(1,size);
+  m1 = spd;
+  m2 = spd;
+  VERIFY(LltLower::blocked(m1)==-1);
+  VERIFY(LltLower::tiled(m2, tileSize)==-1);
+  VERIFY_IS_APPROX(MatrixType(m1.template triangularView<Lower>()), MatrixType(m2.template triangularView<Lower>()));
+  m2 = spd;
+  VERIFY(LltUpper::tiled(m2, tileSize)==-1);
+  VERIFY_IS_APPROX(MatrixType(m1.template triangularView<Lower>().adjoint()), MatrixType(m2.template triangularView<Upper>()));
+
+  // and it reports the first non positive pivot
+  Index k = internal::random<Index>(0,size-1);
+  spd.row(k).setZero();
+  spd.col(k).setZero();
+  m1 = spd;
+  m2 = spd;
+  VERIFY(LltLower::blocked(m1)==k);
+  VERIFY(LltLower::tiled(m2, tileSize)==k);
+}
+
+template<typename MatrixType> void cholesky_indefinite(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef Matrix<Scalar, MatrixType::RowsAtCompileTime, 1> VectorType;
+  Index size = m.rows();
+
+  // a selfadjoint matrix with a small diagonal requires 2x2 pivots
+  MatrixType symm = MatrixType::Random(size,size);
+  symm = (symm + symm.adjoint()).eval();
+  symm.diagonal() = (RealScalar(0.01) * symm.diagonal().real()).template cast<Scalar>();
+  VectorType vecB = VectorType::Random(size), vecX(size);
+  MatrixType matB = MatrixType::Random(size,size), matX(size,size);
+
+  MatrixType symmLo = symm.template triangularView<Lower>();
+  MatrixType symmUp = symm.template triangularView<Upper>();
+
+  BunchKaufman<MatrixType,Lower> bklo(symmLo);
+  VERIFY_IS_APPROX(symm, bklo.reconstructedMatrix());
+  vecX = bklo.solve(vecB);
+  VERIFY_IS_APPROX(symm * vecX, vecB);
+  matX = bklo.solve(matB);
+  VERIFY_IS_APPROX(symm * matX, matB);
+  // the pivoting bounds the coefficients of L
+  VERIFY(bklo.matrixL().toDenseMatrix().cwiseAbs().maxCoeff() < RealScalar(10));
+
+  BunchKaufman<MatrixType,Upper> bkup(symmUp);
+  VERIFY_IS_APPROX(symm, bkup.reconstructedMatrix());
+  vecX = bkup.solve(vecB);
+  VERIFY_IS_APPROX(symm * vecX, vecB);
+  VERIFY_IS_APPROX(MatrixType(bkup.matrixU().adjoint()), MatrixType(bkup.matrixL()));
+
+  // the 2x2 blocks do not overlap
+  for(Index i = 0; i+1 < size; ++i)
+    VERIFY(bklo.subdiagonalD()(i) == Scalar(0) || bklo.subdiagonalD()(i+1) == Scalar(0));
+
+  // a positive definite matrix only needs 1x1 pivots
+  MatrixType a = MatrixType::Random(size,size);
+  symm = a * a.adjoint() + MatrixType::Identity(size,size);
+  bklo.compute(symm);
+  VERIFY_IS_APPROX(symm, bklo.reconstructedMatrix());
+  VERIFY(bklo.subdiagonalD().isZero());
+}
+
 // regression test for bug 241
 template<typename MatrixType> void cholesky_bug241(const MatrixType& m)
 {
@@ -280,6 +376,12 @@ template<typename MatrixType> void cholesky_verify_assert()
   VERIFY_RAISES_ASSERT(ldlt.isNegative())
   VERIFY_RAISES_ASSERT(ldlt.solve(tmp))
   VERIFY_RAISES_ASSERT(ldlt.solveInPlace(&tmp))
+
+  BunchKaufman<MatrixType> bk;
+  VERIFY_RAISES_ASSERT(bk.matrixL())
+  VERIFY_RAISES_ASSERT(bk.vectorD())
+  VERIFY_RAISES_ASSERT(bk.subdiagonalD())
+  VERIFY_RAISES_ASSERT(bk.solve(tmp))
 }
 
 void test_cholesky()
@@ -295,6 +397,16 @@ void test_cholesky()
     CALL_SUBTEST_2( cholesky(MatrixXd(s,s)) );
     s = internal::random<int>(1,EIGEN_TEST_MAX_SIZE/2);
     CALL_SUBTEST_6( cholesky_cplx(MatrixXcd(s,s)) );
+    s = internal::random<int>(32,EIGEN_TEST_MAX_SIZE);
+    CALL_SUBTEST_10( cholesky_blocked(MatrixXd(s,s)) );
+    s = internal::random<int>(32,EIGEN_TEST_MAX_SIZE/2);
+    CALL_SUBTEST_10( cholesky_blocked(MatrixXcf(s,s)) );
+    CALL_SUBTEST_11( cholesky_indefinite(Matrix4d()) );
+    s = internal::random<int>(1,EIGEN_TEST_MAX_SIZE);
+    CALL_SUBTEST_11( cholesky_indefinite(MatrixXd(s,s)) );
+    s = internal::random<int>(1,EIGEN_TEST_MAX_SIZE/2);
+    CALL_SUBTEST_12( cholesky_indefinite(MatrixXcd(s,s)) );
+    CALL_SUBTEST_12( cholesky_indefinite(Matrix<float,Dynamic,Dynamic,RowMajor>(s,s)) );
   }
 
   CALL_SUBTEST_4( cholesky_verify_assert<Matrix3f>() );
@@ -305,6 +417,7 @@ void test_cholesky()
   // Test problem size constructors
   CALL_SUBTEST_9( LLT<MatrixXf>(10) );
   CALL_SUBTEST_9( LDLT<MatrixXf>(10) );
+  CALL_SUBTEST_9( BunchKaufman<MatrixXf>(10) );
   
   EIGEN_UNUSED_VARIABLE(s)
 }
@@ -62,6 +62,53 @@ void check_aligned_stack_alloc()
   }
 }
 
+void check_large_allocation_policy()
+{
+  const int policy = largeAllocationPolicy();
+  const std::ptrdiff_t threshold = largeAllocationThreshold();
+
+  setLargeAllocationPolicy(HugePageAllocation|ParallelFirstTouch, 1<<16);
+  VERIFY_IS_EQUAL(largeAllocationPolicy(), int(HugePageAllocation|ParallelFirstTouch));
+  VERIFY_IS_EQUAL(largeAllocationThreshold(), std::ptrdiff_t(1<<16));
+
+  for(int i = (1<<16)-1000; i < (1<<22); i = 3*i+7)
+  {
+    char *p = (char*)internal::aligned_malloc(i);
+    VERIFY(size_t(p)%ALIGNMENT==0);
+#if EIGEN_HAS_MADV_HUGEPAGE
+    if(i >= (1<<16)) VERIFY(size_t(p)%EIGEN_HUGE_PAGE_SIZE==0);
+#endif
+    for(int j = 0; j < i; j++) p[j]=char(j);
+    p = (char*)internal::aligned_realloc(p,2*i,i);
+    VERIFY(size_t(p)%ALIGNMENT==0);
+#if EIGEN_HAS_MADV_HUGEPAGE
+    VERIFY(size_t(p)%EIGEN_HUGE_PAGE_SIZE==0);
+#endif
+    for(int j = 0; j < i; j++) VERIFY(p[j]==char(j));
+    for(int j = i; j < 2*i; j++) p[j]=0;
+    internal::aligned_free(p);
+  }
+
+  MatrixXd a = MatrixXd::Random(200,200), b = MatrixXd::Random(200,200);
+  MatrixXd c = a * b;
+  VERIFY_IS_APPROX(c, a.lazyProduct(b));
+  Matrix<double,Dynamic,Dynamic,RowMajor> d = a * b;
+  VERIFY_IS_APPROX(d, c);
+
+#ifdef EIGEN_HAS_OPENMP
+  // the blocks of rows of the threads cover the whole matrix
+  if(nbThreads()>1)
+  {
+    const int innerSize = 1003, outerSize = 7;
+    std::vector<double> data(innerSize*outerSize, 1.);
+    internal::parallel_first_touch(&data[0], sizeof(double), innerSize, outerSize);
+    VERIFY(std::count(data.begin(), data.end(), 0.) == innerSize*outerSize);
+  }
+#endif
+
+  setLargeAllocationPolicy(policy, threshold);
+  VERIFY_IS_EQUAL(largeAllocationPolicy(), policy);
+}
 
 // test compilation with both a struct and a class...
 struct MyStruct
@@ -93,6 +140,7 @@ void test_dynalloc()
   CALL_SUBTEST(check_aligned_malloc());
   CALL_SUBTEST(check_aligned_new());
   CALL_SUBTEST(check_aligned_stack_alloc());
+  CALL_SUBTEST(check_large_allocation_policy());
 
   for (int i=0; i<g_repeat*100; ++i)
   {
@@ -111,6 +111,144 @@ template<typename MatrixType> void selfadjointeigensolver(const MatrixType& m)
   }
 }
 
+template<typename MatrixType> void tridiagonalization_blocked(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef typename Tridiagonalization<MatrixType>::CoeffVectorType CoeffVectorType;
+  Index size = m.rows();
+
+  MatrixType a = MatrixType::Random(size,size);
+  MatrixType symmA = a.adjoint() * a;
+
+  MatrixType m1 = symmA, m2 = symmA;
+  CoeffVectorType h1(size-1), h2(size-1);
+  internal::tridiagonalization_inplace_unblocked(m1, h1);
+  internal::tridiagonalization_inplace_blocked(m2, h2);
+  VERIFY_IS_EQUAL(MatrixType(m2.template triangularView<StrictlyUpper>()), MatrixType(symmA.template triangularView<StrictlyUpper>()));
+  // the blocked reduction computes the same reflectors as the unblocked one, but the reflectors are not well
+  // conditioned functions of a^* a: in float, the different rounding of the two reductions is amplified beyond
+  // test_precision, so that only the factorization itself is checked
+  if(!internal::is_same<RealScalar,float>::value)
+  {
+    VERIFY_IS_APPROX(MatrixType(m1.template triangularView<Lower>()), MatrixType(m2.template triangularView<Lower>()));
+    VERIFY_IS_APPROX(h1, h2);
+  }
+
+  Tridiagonalization<MatrixType> tridiag(symmA);
+  MatrixType q = tridiag.matrixQ();
+  VERIFY_IS_UNITARY(q);
+  VERIFY_IS_APPROX(symmA, q * tridiag.matrixT().eval() * q.adjoint());
+}
+
+template<typename MatrixType> void selfadjointeigensolver_dc(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef Matrix<RealScalar,Dynamic,1> RealVectorType;
+  Index size = m.rows();
+
+  // random eigenvalues, some of them repeated or clustered, such that the merges deflate
+  MatrixType q = MatrixType::Random(size,size).householderQr().householderQ();
+  RealVectorType d = RealVectorType::Random(size);
+  for(Index i=0; i<size; i+=3)
+    d(i) = d(0);
+  for(Index i=1; i<size; i+=5)
+    d(i) = d(1) + RealScalar(i)*NumTraits<RealScalar>::epsilon();
+  MatrixType symmA = q * d.template cast<Scalar>().asDiagonal() * q.adjoint();
+
+  // the eigenvectors are computed by divide and conquer, and the eigenvalues only by QR iterations
+  SelfAdjointEigenSolver<MatrixType> eiSymm(symmA);
+  SelfAdjointEigenSolver<MatrixType> eiSymmNoEivecs(symmA, EigenvaluesOnly);
+  VERIFY_IS_EQUAL(eiSymm.info(), Success);
+  std::sort(d.data(), d.data()+size);
+  VERIFY_IS_APPROX(eiSymm.eigenvalues(), d);
+  VERIFY_IS_APPROX(eiSymm.eigenvalues(), eiSymmNoEivecs.eigenvalues());
+  VERIFY_IS_APPROX(symmA * eiSymm.eigenvectors(), eiSymm.eigenvectors() * eiSymm.eigenvalues().asDiagonal());
+  VERIFY_IS_UNITARY(eiSymm.eigenvectors());
+
+  // a tridiagonal matrix with a tiny off-diagonal entry, and one with close eigenvalues
+  RealVectorType diag = RealVectorType::Random(size), subdiag = RealVectorType::Random(size-1);
+  subdiag(size/2-1) = NumTraits<RealScalar>::epsilon();
+  for(Index k=0; k<2; ++k)
+  {
+    MatrixType t = MatrixType::Zero(size,size);
+    t.diagonal() = diag.template cast<Scalar>();
+    t.template diagonal<-1>() = subdiag.template cast<Scalar>();
+    t.template diagonal<1>() = subdiag.template cast<Scalar>();
+    SelfAdjointEigenSolver<MatrixType> eiT(t);
+    VERIFY_IS_APPROX(t * eiT.eigenvectors(), eiT.eigenvectors() * eiT.eigenvalues().asDiagonal());
+    VERIFY_IS_UNITARY(eiT.eigenvectors());
+    // Wilkinson's matrix
+    for(Index i=0; i<size; ++i)
+      diag(i) = abs(RealScalar(i-size/2));
+    subdiag.setOnes();
+  }
+}
+
+template<typename MatrixType> void selfadjointeigensolver_partial(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef Matrix<RealScalar,Dynamic,1> RealVectorType;
+  typedef Matrix<Scalar,Dynamic,Dynamic> SquareMatrixType;
+  Index size = m.rows();
+  RealScalar largerEps = 10*test_precision<RealScalar>();
+
+  MatrixType a = MatrixType::Random(size,size);
+  MatrixType symmA = a.adjoint() * a;
+  SelfAdjointEigenSolver<MatrixType> eiSymm(symmA, EigenvaluesOnly);
+  const RealVectorType& evs = eiSymm.eigenvalues();
+
+  // the k smallest and the k largest eigenpairs
+  Index k = internal::random<Index>(1,size);
+  SelfAdjointEigenSolver<MatrixType> eiPartial;
+  eiPartial.computeRange(symmA, 0, k);
+  VERIFY_IS_EQUAL(eiPartial.info(), Success);
+  VERIFY_IS_APPROX(eiPartial.eigenvalues(), evs.head(k));
+  VERIFY((symmA * eiPartial.eigenvectors()).isApprox(eiPartial.eigenvectors() * eiPartial.eigenvalues().asDiagonal(), largerEps));
+  VERIFY_IS_APPROX(SquareMatrixType(eiPartial.eigenvectors().adjoint() * eiPartial.eigenvectors()), SquareMatrixType::Identity(k,k));
+  eiPartial.computeRange(symmA, size-k, k);
+  VERIFY_IS_APPROX(eiPartial.eigenvalues(), evs.tail(k));
+  VERIFY((symmA * eiPartial.eigenvectors()).isApprox(eiPartial.eigenvectors() * eiPartial.eigenvalues().asDiagonal(), largerEps));
+  VERIFY_IS_APPROX(SquareMatrixType(eiPartial.eigenvectors().adjoint() * eiPartial.eigenvectors()), SquareMatrixType::Identity(k,k));
+  eiPartial.computeRange(symmA, size-k, k, EigenvaluesOnly);
+  VERIFY_IS_APPROX(eiPartial.eigenvalues(), evs.tail(k));
+
+  // the eigenvalues within an interval whose bounds lie between consecutive eigenvalues
+  Index first = internal::random<Index>(0,size-1), last = internal::random<Index>(first+1,size);
+  RealScalar lower = first==0 ? evs(0)-RealScalar(1) : RealScalar(0.5)*(evs(first-1)+evs(first));
+  RealScalar upper = last==size ? evs(size-1)+RealScalar(1) : RealScalar(0.5)*(evs(last-1)+evs(last));
+  eiPartial.computeInterval(symmA, lower, upper);
+  VERIFY_IS_EQUAL(eiPartial.eigenvalues().size(), last-first);
+  VERIFY_IS_APPROX(eiPartial.eigenvalues(), evs.segment(first,last-first));
+  VERIFY((symmA * eiPartial.eigenvectors()).isApprox(eiPartial.eigenvectors() * eiPartial.eigenvalues().asDiagonal(), largerEps));
+  eiPartial.computeInterval(symmA, evs(size-1)+RealScalar(1), evs(size-1)+RealScalar(2));
+  VERIFY_IS_EQUAL(eiPartial.eigenvalues().size(), 0);
+  VERIFY_IS_EQUAL(eiPartial.eigenvectors().cols(), 0);
+  eiPartial.computeRange(MatrixType(0,0), 0, 0);
+  VERIFY_IS_EQUAL(eiPartial.info(), Success);
+  VERIFY_IS_EQUAL(eiPartial.eigenvalues().size(), 0);
+
+  // repeated and clustered eigenvalues, whose eigenvectors are orthogonalized against each other
+  MatrixType q = MatrixType::Random(size,size).householderQr().householderQ();
+  RealVectorType d = RealVectorType::Random(size);
+  for(Index i=0; i<size; i+=3)
+    d(i) = d(0);
+  for(Index i=1; i<size; i+=5)
+    d(i) = d(1) + RealScalar(i)*NumTraits<RealScalar>::epsilon();
+  symmA = q * d.template cast<Scalar>().asDiagonal() * q.adjoint();
+  std::sort(d.data(), d.data()+size);
+  eiPartial.computeRange(symmA, 0, size);
+  VERIFY_IS_EQUAL(eiPartial.info(), Success);
+  VERIFY_IS_APPROX(eiPartial.eigenvalues(), d);
+  VERIFY((symmA * eiPartial.eigenvectors()).isApprox(eiPartial.eigenvectors() * eiPartial.eigenvalues().asDiagonal(), largerEps));
+  VERIFY_IS_UNITARY(eiPartial.eigenvectors());
+}
+
 void test_eigensolver_selfadjoint()
 {
   int s;
@@ -136,6 +274,24 @@ void test_eigensolver_selfadjoint()
     CALL_SUBTEST_7( selfadjointeigensolver(Matrix<double,2,2>()) );
   }
 
+  s = internal::random<int>(128,EIGEN_TEST_MAX_SIZE);
+  CALL_SUBTEST_10( tridiagonalization_blocked(MatrixXd(s,s)) );
+  s = internal::random<int>(128,EIGEN_TEST_MAX_SIZE);
+  CALL_SUBTEST_10( tridiagonalization_blocked(Matrix<std::complex<float>,Dynamic,Dynamic,RowMajor>(s,s)) );
+
+  s = internal::random<int>(EIGEN_SELFADJOINT_DC_THRESHOLD,EIGEN_TEST_MAX_SIZE);
+  CALL_SUBTEST_11( selfadjointeigensolver_dc(MatrixXd(s,s)) );
+  s = internal::random<int>(EIGEN_SELFADJOINT_DC_THRESHOLD,EIGEN_TEST_MAX_SIZE/2);
+  CALL_SUBTEST_11( selfadjointeigensolver_dc(MatrixXcf(s,s)) );
+  CALL_SUBTEST_11( selfadjointeigensolver_dc(Matrix<float,Dynamic,Dynamic,RowMajor>(s,s)) );
+
+  for(int i = 0; i < g_repeat; i++) {
+    s = internal::random<int>(1,EIGEN_TEST_MAX_SIZE/2);
+    CALL_SUBTEST_12( selfadjointeigensolver_partial(MatrixXd(s,s)) );
+    CALL_SUBTEST_12( selfadjointeigensolver_partial(MatrixXcf(s,s)) );
+    CALL_SUBTEST_12( selfadjointeigensolver_partial(Matrix<double,Dynamic,Dynamic,RowMajor>(s,s)) );
+  }
+
   // Test problem size constructors
   s = internal::random<int>(1,EIGEN_TEST_MAX_SIZE/4);
   CALL_SUBTEST_8(SelfAdjointEigenSolver<MatrixXf>(s));
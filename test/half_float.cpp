@@ -0,0 +1,151 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "main.h"
+
+typedef Matrix<half,Dynamic,Dynamic> MatrixXh;
+typedef Matrix<half,Dynamic,Dynamic,RowMajor> RowMatrixXh;
+typedef Matrix<half,Dynamic,1> VectorXh;
+
+namespace Eigen {
+inline bool test_isApprox(const half& a, const half& b)
+{ return internal::isApprox(a, b, test_precision<half>()); }
+}
+
+void half_conversions()
+{
+  // every finite half survives the round trip through float
+  for(int bits = 0; bits < 0x10000; ++bits)
+  {
+    half h = half::fromBits(static_cast<unsigned short>(bits));
+    if((bits & 0x7c00) != 0x7c00)
+      VERIFY_IS_EQUAL(half(float(h)).x, h.x);
+  }
+
+  VERIFY_IS_EQUAL(half(1.f).x, 0x3c00);
+  VERIFY_IS_EQUAL(half(-2.f).x, 0xc000);
+  VERIFY_IS_EQUAL(half(65504.f).x, 0x7bff);
+  VERIFY_IS_EQUAL(half(65536.f).x, 0x7c00);
+  VERIFY_IS_EQUAL(half(-1e10f).x, 0xfc00);
+  VERIFY_IS_EQUAL(half(std::numeric_limits<float>::quiet_NaN()).x & 0x7e00, 0x7e00);
+  VERIFY_IS_EQUAL(half(5.960464477539063e-8f).x, 0x0001);
+  VERIFY_IS_EQUAL(half(1e-10f).x, 0x0000);
+  VERIFY_IS_EQUAL(half(-0.f).x, 0x8000);
+  // ties are rounded to even
+  VERIFY_IS_EQUAL(half(1.f + 1.f/2048.f).x, 0x3c00);
+  VERIFY_IS_EQUAL(half(1.f + 3.f/2048.f).x, 0x3c02);
+  // a double is rounded once: through the nearest float, these would be ties rounded down
+  VERIFY_IS_EQUAL(half(1. + 1./2048. + 1e-9).x, 0x3c01);
+  VERIFY_IS_EQUAL(half(-1. - 1./2048. - 1e-9).x, 0xbc01);
+  VERIFY_IS_EQUAL(half(1. + 1./2048.).x, 0x3c00);
+  VERIFY_IS_EQUAL(half(1e300).x, 0x7c00);
+  VERIFY_IS_EQUAL(half(1e-300).x, 0x0000);
+  VERIFY_IS_EQUAL(half(std::numeric_limits<double>::quiet_NaN()).x & 0x7e00, 0x7e00);
+  VERIFY_IS_EQUAL(MatrixXd::Constant(2,2,1. + 1./2048. + 1e-9).cast<half>()(1,1).x, 0x3c01);
+
+  VERIFY_IS_EQUAL(float(half::fromBits(0x3555)), 0.333251953125f);
+  VERIFY_IS_EQUAL(float(NumTraits<half>::epsilon()), 1.f/1024.f);
+  VERIFY_IS_EQUAL(float(NumTraits<half>::highest()), 65504.f);
+  VERIFY_IS_EQUAL(float((std::numeric_limits<half>::min)()), 6.103515625e-5f);
+  VERIFY(float(std::numeric_limits<half>::infinity()) > 65504.f);
+}
+
+void half_arithmetic()
+{
+  half a(1.5f), b(-0.25f);
+  VERIFY_IS_EQUAL(float(a+b), 1.25f);
+  VERIFY_IS_EQUAL(float(a-b), 1.75f);
+  VERIFY_IS_EQUAL(float(a*b), -0.375f);
+  VERIFY_IS_EQUAL(float(a/b), -6.f);
+  VERIFY_IS_EQUAL(float(-a), -1.5f);
+  VERIFY(b < a && a > b && a != b && a == half(1.5f));
+  a += b;
+  VERIFY_IS_EQUAL(float(a), 1.25f);
+  VERIFY_IS_EQUAL(float(internal::abs(b)), 0.25f);
+  VERIFY_IS_EQUAL(float(internal::sqrt(half(4.f))), 2.f);
+  VERIFY_IS_APPROX(internal::exp(half(1.f)), half(2.71828f));
+  VERIFY_IS_APPROX(internal::log(half(2.71828f)), half(1.f));
+
+  for(int k = 0; k < 100; ++k)
+  {
+    half r = internal::random<half>();
+    VERIFY(float(r) >= -1.f && float(r) <= 1.f);
+  }
+}
+
+template<typename MatrixType> void half_cwise(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef Matrix<float,MatrixType::RowsAtCompileTime,MatrixType::ColsAtCompileTime,MatrixType::Options> MatrixF;
+  Index rows = m.rows(), cols = m.cols();
+
+  MatrixType a = MatrixType::Random(rows,cols), b = MatrixType::Random(rows,cols);
+  MatrixF af = a.template cast<float>(), bf = b.template cast<float>();
+
+  // each coefficient is computed in float and rounded once
+  VERIFY_IS_EQUAL(MatrixType(a+b), MatrixType((af+bf).template cast<half>()));
+  VERIFY_IS_EQUAL(MatrixType(a-b), MatrixType((af-bf).template cast<half>()));
+  VERIFY_IS_EQUAL(MatrixType(a.cwiseProduct(b)), MatrixType(af.cwiseProduct(bf).template cast<half>()));
+  VERIFY_IS_EQUAL(MatrixType(-a), MatrixType((-af).template cast<half>()));
+  VERIFY_IS_EQUAL(MatrixType(a.cwiseAbs()), MatrixType(af.cwiseAbs().template cast<half>()));
+  VERIFY_IS_EQUAL(MatrixType(a.cwiseMax(b)), MatrixType(af.cwiseMax(bf).template cast<half>()));
+  VERIFY_IS_EQUAL(MatrixType(a*half(2.f)), MatrixType((af*2.f).template cast<half>()));
+  VERIFY_IS_APPROX(a.array().abs().sqrt().matrix(), af.array().abs().sqrt().matrix().template cast<half>());
+  VERIFY_IS_APPROX(a.array().exp().matrix(), af.array().exp().matrix().template cast<half>());
+  // reductions accumulate in half, hence only check small ones
+  Index r = (std::min)(rows,Index(4)), c = (std::min)(cols,Index(4));
+  VERIFY_IS_APPROX(a.cwiseAbs().topLeftCorner(r,c).sum(), half(af.cwiseAbs().topLeftCorner(r,c).sum()));
+  VERIFY_IS_EQUAL(a.maxCoeff(), half(af.maxCoeff()));
+  VERIFY_IS_EQUAL(MatrixF(a.template cast<float>()), af);
+}
+
+template<typename MatrixType> void half_product(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef Matrix<float,Dynamic,Dynamic> MatrixXf_;
+  Index rows = m.rows(), cols = m.cols(), depth = internal::random<Index>(1,EIGEN_TEST_MAX_SIZE);
+
+  MatrixType a = MatrixType::Random(rows,depth), b = MatrixType::Random(depth,cols);
+  VectorXh v = VectorXh::Random(depth), w = VectorXh::Random(rows);
+  MatrixXf_ af = a.template cast<float>(), bf = b.template cast<float>();
+
+  // large products accumulate in float, so that they match the float product rounded once
+  MatrixXh c = MatrixXh::Zero(rows,cols);
+  c.noalias() += a * b;
+  VERIFY_IS_APPROX(c, MatrixXh((af*bf).cast<half>()));
+  c.noalias() = a.transpose().transpose() * b.adjoint().adjoint();
+  VERIFY_IS_APPROX(c, MatrixXh((af*bf).cast<half>()));
+  VERIFY_IS_APPROX(MatrixXh(a.adjoint() * a), MatrixXh((af.adjoint()*af).cast<half>()));
+
+#ifdef EIGEN_HAS_OPENMP
+  // a product computed by several threads gives the same result
+  int threads = nbThreads();
+  setNbThreads(4);
+  c.noalias() = a * b;
+  setNbThreads(threads);
+  VERIFY_IS_APPROX(c, MatrixXh((af*bf).cast<half>()));
+#endif
+
+  VectorXh r = w;
+  r.noalias() += a * v;
+  VERIFY_IS_APPROX(r, VectorXh((w.cast<float>() + af*v.cast<float>()).cast<half>()));
+  VectorXh s = v;
+  s.noalias() -= a.transpose() * w;
+  VERIFY_IS_APPROX(s, VectorXh((v.cast<float>() - af.transpose()*w.cast<float>()).cast<half>()));
+}
+
+void test_half_float()
+{
+  CALL_SUBTEST_1( half_conversions() );
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( half_arithmetic() );
+    CALL_SUBTEST_2( half_cwise(Matrix<half,4,4>()) );
+    CALL_SUBTEST_2( half_cwise(MatrixXh(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_3( half_product(MatrixXh(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_3( half_product(RowMatrixXh(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+  }
+}
@@ -49,6 +49,39 @@ template<typename Scalar,int Size> void hessenberg(int size = Size)
   // TODO: Add tests for packedMatrix() and householderCoefficients()
 }
 
+template<typename MatrixType> void hessenberg_blocked(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  Index size = m.rows();
+
+  // the reduction by panels matches the one reflector at a time
+  MatrixType A = MatrixType::Random(size,size);
+  MatrixType packed = A;
+  VectorType hCoeffs(size-1), temp(size);
+  for(Index i=0; i<size-1; ++i)
+  {
+    Index remainingSize = size-i-1;
+    RealScalar beta;
+    packed.col(i).tail(remainingSize).makeHouseholderInPlace(hCoeffs(i), beta);
+    packed(i+1,i) = beta;
+    packed.bottomRightCorner(remainingSize, remainingSize)
+          .applyHouseholderOnTheLeft(packed.col(i).tail(remainingSize-1), hCoeffs(i), temp.data());
+    packed.rightCols(remainingSize)
+          .applyHouseholderOnTheRight(packed.col(i).tail(remainingSize-1).conjugate(), internal::conj(hCoeffs(i)), temp.data());
+  }
+
+  HessenbergDecomposition<MatrixType> hess(A);
+  VERIFY_IS_APPROX(hess.packedMatrix(), packed);
+  VERIFY_IS_APPROX(hess.householderCoefficients(), hCoeffs);
+  MatrixType Q = hess.matrixQ();
+  MatrixType H = hess.matrixH();
+  VERIFY_IS_APPROX(A, Q * H * Q.adjoint());
+  VERIFY_IS_UNITARY(Q);
+}
+
 void test_hessenberg()
 {
   CALL_SUBTEST_1(( hessenberg<std::complex<double>,1>() ));
@@ -57,6 +90,12 @@ void test_hessenberg()
   CALL_SUBTEST_4(( hessenberg<float,Dynamic>(internal::random<int>(1,EIGEN_TEST_MAX_SIZE)) ));
   CALL_SUBTEST_5(( hessenberg<std::complex<double>,Dynamic>(internal::random<int>(1,EIGEN_TEST_MAX_SIZE)) ));
 
+  int s = internal::random<int>(128,EIGEN_TEST_MAX_SIZE);
+  CALL_SUBTEST_7( hessenberg_blocked(MatrixXd(s,s)) );
+  s = internal::random<int>(128,EIGEN_TEST_MAX_SIZE);
+  CALL_SUBTEST_7( hessenberg_blocked(Matrix<std::complex<float>,Dynamic,Dynamic,RowMajor>(s,s)) );
+  EIGEN_UNUSED_VARIABLE(s)
+
   // Test problem size constructors
   CALL_SUBTEST_6(HessenbergDecomposition<MatrixXf>(10));
 }
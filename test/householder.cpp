@@ -106,6 +106,14 @@ template<typename MatrixType> void householder(const MatrixType& m)
   VERIFY_IS_APPROX(rhseq * m5, m1); // test applying rhseq directly
   m3 = rhseq;
   VERIFY_IS_APPROX(m3 * m5, m1); // test evaluating rhseq to a dense matrix, then applying
+
+  // from the right and in their adjoints, the reflections are applied with conjugated vectors
+  VERIFY_IS_APPROX(m5.adjoint() * hseq.adjoint(), m1.adjoint());
+  VERIFY_IS_APPROX(m5.adjoint() * rhseq.adjoint(), m1.adjoint());
+  m3 = hseq.adjoint();
+  VERIFY_IS_APPROX(m3 * m1, m5);
+  m3 = rhseq.adjoint();
+  VERIFY_IS_APPROX(m3 * m1, m5);
 }
 
 void test_householder()
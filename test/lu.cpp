@@ -144,6 +144,53 @@ template<typename MatrixType> void lu_partial_piv()
   VERIFY_IS_APPROX(m1, plu.reconstructedMatrix());
 }
 
+template<typename MatrixType> void lu_partial_piv_blocked()
+{
+  typedef typename MatrixType::Index Index;
+  Index size = internal::random<Index>(17,EIGEN_TEST_MAX_SIZE);
+
+  // several panels, which are factorized recursively
+  MatrixType m1 = MatrixType::Random(size, size);
+  PartialPivLU<MatrixType> plu(m1);
+  VERIFY_IS_APPROX(m1, plu.reconstructedMatrix());
+  MatrixType m2 = MatrixType::Random(size, 3), m3 = plu.solve(m2);
+  VERIFY_IS_APPROX(m1*m3, m2);
+  VERIFY_IS_APPROX(plu.determinant(), m1.fullPivLu().determinant());
+
+  // a zero column gives a zero pivot, but still A = PLU
+  m1.col(internal::random<Index>(0,size-1)).setZero();
+  plu.compute(m1);
+  VERIFY_IS_APPROX(m1, plu.reconstructedMatrix());
+}
+
+template<typename MatrixType> void lu_partial_piv_blocked_vs_unblocked()
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename PartialPivLU<MatrixType>::TranspositionType TranspositionType;
+  typedef typename PartialPivLU<MatrixType>::PermutationType PermutationType;
+  typedef internal::partial_lu_impl<Scalar, MatrixType::Flags&RowMajorBit?RowMajor:ColMajor, typename TranspositionType::Index> Impl;
+  // the panels are 32 columns wide from this size on, so that they are factorized recursively
+  const int size = 300;
+
+  MatrixType m1 = MatrixType::Random(size, size);
+  MatrixType lu = m1;
+  TranspositionType transpositions(size);
+  typename TranspositionType::Index nb_transpositions;
+  typename Impl::MapLU lu1(lu.data(), size, size);
+  typename Impl::MatrixType lu2(lu1, 0, 0, size, size);
+  VERIFY(Impl::unblocked_lu(lu2, &transpositions.coeffRef(0), nb_transpositions) < 0);
+
+  // with several threads, the next panel is factorized while the remaining columns are updated
+  int threads = nbThreads();
+  setNbThreads(4);
+  PartialPivLU<MatrixType> plu(m1);
+  setNbThreads(threads);
+
+  VERIFY(PermutationType(transpositions).indices() == plu.permutationP().indices());
+  VERIFY_IS_APPROX(plu.matrixLU(), lu);
+  VERIFY_IS_APPROX(m1, plu.reconstructedMatrix());
+}
+
 template<typename MatrixType> void lu_verify_assert()
 {
   MatrixType tmp;
@@ -187,6 +234,8 @@ void test_lu()
     CALL_SUBTEST_4( lu_non_invertible<MatrixXd>() );
     CALL_SUBTEST_4( lu_invertible<MatrixXd>() );
     CALL_SUBTEST_4( lu_partial_piv<MatrixXd>() );
+    CALL_SUBTEST_4( lu_partial_piv_blocked<MatrixXd>() );
+    CALL_SUBTEST_4( lu_partial_piv_blocked_vs_unblocked<MatrixXd>() );
     CALL_SUBTEST_4( lu_verify_assert<MatrixXd>() );
 
     CALL_SUBTEST_5( lu_non_invertible<MatrixXcf>() );
@@ -196,9 +245,13 @@ void test_lu()
     CALL_SUBTEST_6( lu_non_invertible<MatrixXcd>() );
     CALL_SUBTEST_6( lu_invertible<MatrixXcd>() );
     CALL_SUBTEST_6( lu_partial_piv<MatrixXcd>() );
+    CALL_SUBTEST_6( lu_partial_piv_blocked<MatrixXcd>() );
+    CALL_SUBTEST_6( lu_partial_piv_blocked_vs_unblocked<MatrixXcd>() );
     CALL_SUBTEST_6( lu_verify_assert<MatrixXcd>() );
 
     CALL_SUBTEST_7(( lu_non_invertible<Matrix<float,Dynamic,16> >() ));
+    CALL_SUBTEST_7(( lu_partial_piv_blocked<Matrix<double,Dynamic,Dynamic,RowMajor> >() ));
+    CALL_SUBTEST_7(( lu_partial_piv_blocked_vs_unblocked<Matrix<double,Dynamic,Dynamic,RowMajor> >() ));
 
     // Test problem size constructors
     CALL_SUBTEST_9( PartialPivLU<MatrixXf>(10) );
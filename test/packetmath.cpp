@@ -96,6 +96,13 @@ struct packet_helper<false,Packet>
 #define REF_SUB(a,b) ((a)-(b))
 #define REF_MUL(a,b) ((a)*(b))
 #define REF_DIV(a,b) ((a)/(b))
+#define REF_AND(a,b) ((a)&(b))
+#define REF_OR(a,b)  ((a)|(b))
+#define REF_XOR(a,b) ((a)^(b))
+#define REF_SHIFT_LEFT(a)   ((a)<<5)
+#define REF_SHIFT_RIGHT(a)  ((a)>>5)
+#define REF_SHIFT_RIGHT0(a) ((a)>>0)
+#define REF_LSHIFT_RIGHT(a) (((a)>>5) & ((Scalar(1)<<(CHAR_BIT*sizeof(Scalar)-5))-1))
 
 template<typename Scalar> void packetmath()
 {
@@ -152,7 +159,7 @@ template<typename Scalar> void packetmath()
   CHECK_CWISE2(REF_SUB,  internal::psub);
   CHECK_CWISE2(REF_MUL,  internal::pmul);
   #ifndef EIGEN_VECTORIZE_ALTIVEC
-  if (!internal::is_same<Scalar,int>::value)
+  if (!NumTraits<Scalar>::IsInteger)
     CHECK_CWISE2(REF_DIV,  internal::pdiv);
   #endif
   CHECK_CWISE1(internal::negate, internal::pnegate);
@@ -267,6 +274,53 @@ template<typename Scalar> void packetmath_real()
   VERIFY(areApprox(ref, data2, PacketSize) && "internal::plset");
 }
 
+template<typename Scalar> void packetmath_integer()
+{
+  typedef typename internal::packet_traits<Scalar>::type Packet;
+  const int PacketSize = internal::packet_traits<Scalar>::size;
+
+  const int size = PacketSize*4;
+  EIGEN_ALIGN16 Scalar data1[internal::packet_traits<Scalar>::size*4];
+  EIGEN_ALIGN16 Scalar data2[internal::packet_traits<Scalar>::size*4];
+  EIGEN_ALIGN16 Scalar ref[internal::packet_traits<Scalar>::size*4];
+
+  // large enough for the products to overflow 32 bits, small enough not to overflow Scalar
+  const Scalar range = Scalar(1) << (4*sizeof(Scalar)-2);
+  for (int i=0; i<size; ++i)
+  {
+    data1[i] = internal::random<Scalar>(-range,range);
+    data2[i] = internal::random<Scalar>(-range,range);
+  }
+
+  CHECK_CWISE2(REF_MUL,  internal::pmul);
+  CHECK_CWISE2(REF_AND,  internal::pand);
+  CHECK_CWISE2(REF_OR,   internal::por);
+  CHECK_CWISE2(REF_XOR,  internal::pxor);
+  CHECK_CWISE1_IF(internal::packet_traits<Scalar>::HasShift, REF_SHIFT_LEFT,   internal::plogical_shift_left<5>);
+  CHECK_CWISE1_IF(internal::packet_traits<Scalar>::HasShift, REF_SHIFT_RIGHT,  internal::parithmetic_shift_right<5>);
+  CHECK_CWISE1_IF(internal::packet_traits<Scalar>::HasShift, REF_SHIFT_RIGHT0, internal::parithmetic_shift_right<0>);
+  CHECK_CWISE1_IF(internal::packet_traits<Scalar>::HasShift, REF_LSHIFT_RIGHT, internal::plogical_shift_right<5>);
+  CHECK_CWISE1(internal::abs, internal::pabs);
+  if(internal::packet_traits<Scalar>::HasMin)
+    CHECK_CWISE2((std::min), internal::pmin);
+  if(internal::packet_traits<Scalar>::HasMax)
+    CHECK_CWISE2((std::max), internal::pmax);
+
+  ref[0] = data1[0];
+  for (int i=0; i<PacketSize; ++i)
+    ref[0] = (std::min)(ref[0],data1[i]);
+  VERIFY(ref[0] == internal::predux_min(internal::pload<Packet>(data1)) && "internal::predux_min");
+  ref[0] = data1[0];
+  for (int i=0; i<PacketSize; ++i)
+    ref[0] = (std::max)(ref[0],data1[i]);
+  VERIFY(ref[0] == internal::predux_max(internal::pload<Packet>(data1)) && "internal::predux_max");
+
+  for (int i=0; i<PacketSize; ++i)
+    ref[i] = data1[0]+Scalar(i);
+  internal::pstore(data2, internal::plset(data1[0]));
+  VERIFY(areApprox(ref, data2, PacketSize) && "internal::plset");
+}
+
 template<typename Scalar,bool ConjLhs,bool ConjRhs> void test_conj_helper(Scalar* data1, Scalar* data2, Scalar* ref, Scalar* pval)
 {
   typedef typename internal::packet_traits<Scalar>::type Packet;
@@ -333,12 +387,16 @@ void test_packetmath()
     CALL_SUBTEST_1( packetmath<float>() );
     CALL_SUBTEST_2( packetmath<double>() );
     CALL_SUBTEST_3( packetmath<int>() );
+    CALL_SUBTEST_4( packetmath<std::ptrdiff_t>() );
     CALL_SUBTEST_1( packetmath<std::complex<float> >() );
     CALL_SUBTEST_2( packetmath<std::complex<double> >() );
 
     CALL_SUBTEST_1( packetmath_real<float>() );
     CALL_SUBTEST_2( packetmath_real<double>() );
 
+    CALL_SUBTEST_3( packetmath_integer<int>() );
+    CALL_SUBTEST_4( packetmath_integer<std::ptrdiff_t>() );
+
     CALL_SUBTEST_1( packetmath_complex<std::complex<float> >() );
     CALL_SUBTEST_2( packetmath_complex<std::complex<double> >() );
   }
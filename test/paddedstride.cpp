@@ -0,0 +1,103 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "main.h"
+#include <Eigen/LU>
+
+template<typename MatrixType>
+void paddedstride(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, Dynamic, Dynamic, MatrixType::Options & RowMajor> PlainMatrixType;
+  typedef Matrix<Scalar, Dynamic, 1> VectorType;
+  enum { PacketSize = internal::packet_traits<Scalar>::size };
+
+  Index rows = m.rows();
+  Index cols = m.cols();
+
+  PlainMatrixType ref = PlainMatrixType::Random(rows,cols);
+  MatrixType a(ref);
+
+  VERIFY(!(MatrixType::Flags & LinearAccessBit));
+  VERIFY(a.outerStride() >= a.innerSize());
+  VERIFY_IS_EQUAL(a.innerStride(), 1);
+  if(a.innerSize()>1)
+  {
+    VERIFY(a.outerStride() % PacketSize == 0);
+    VERIFY((a.outerStride()*sizeof(Scalar)) % EIGEN_PADDED_OUTER_STRIDE_ALIASING != 0);
+  }
+  VERIFY_IS_EQUAL(a, ref);
+  for(Index k=0; k<a.size(); ++k)
+    VERIFY_IS_EQUAL(a.coeff(k), ref.coeff(k));
+
+  // expressions, blocks and maps go through outerStride()
+  Index r = internal::random<Index>(0,rows-1), c = internal::random<Index>(0,cols-1);
+  VERIFY_IS_EQUAL(a(r,c), a.data()[MatrixType::IsRowMajor ? c + r*a.outerStride() : r + c*a.outerStride()]);
+  VERIFY_IS_APPROX(a.array() * 2 + 1, ref.array() * 2 + 1);
+  VERIFY_IS_APPROX(a.sum(), ref.sum());
+  VERIFY_IS_EQUAL(a.col(c), ref.col(c));
+  VERIFY_IS_EQUAL(a.row(r), ref.row(r));
+  VERIFY_IS_EQUAL(a.block(r/2,c/2,rows-r,cols-c), ref.block(r/2,c/2,rows-r,cols-c));
+  Map<PlainMatrixType, Unaligned, OuterStride<> > map(a.data(), rows, cols, OuterStride<>(a.outerStride()));
+  VERIFY_IS_EQUAL(map, ref);
+
+  a.setZero();
+  VERIFY(a.isZero());
+  a = ref.transpose().transpose();
+  VERIFY_IS_EQUAL(a, ref);
+
+  // products
+  VectorType v = VectorType::Random(cols);
+  VERIFY_IS_APPROX(a * v, ref * v);
+  VERIFY_IS_APPROX(a.adjoint() * ref, ref.adjoint() * ref);
+  MatrixType b(cols,cols);
+  b.noalias() = a.adjoint() * a;
+  VERIFY_IS_APPROX(b, (ref.adjoint() * ref).eval());
+
+  // square solves
+  MatrixType s = MatrixType::Random(rows,rows);
+  s.diagonal().array() += Scalar(rows);
+  VERIFY_IS_APPROX(s.template triangularView<Lower>().solve(a),
+                   (PlainMatrixType(s).template triangularView<Lower>().solve(ref)));
+  PlainMatrixType x = s.lu().solve(ref);
+  VERIFY_IS_APPROX(s * x, ref);
+
+  // resizing and swapping
+  MatrixType c1(a);
+  c1.conservativeResize(rows, cols+3);
+  VERIFY_IS_EQUAL(c1.leftCols(cols), ref);
+  c1.conservativeResize(rows+5, cols);
+  VERIFY_IS_EQUAL(c1.topRows(rows), ref);
+  c1.conservativeResize(rows/2+1, cols/2+1);
+  VERIFY_IS_EQUAL(c1, ref.topLeftCorner(rows/2+1, cols/2+1));
+  c1.swap(a);
+  VERIFY_IS_EQUAL(c1, ref);
+  VERIFY_IS_EQUAL(a, ref.topLeftCorner(rows/2+1, cols/2+1));
+  a.resize(1, cols);
+  a.setRandom();
+  for(Index k=0; k<cols; ++k)
+    VERIFY_IS_EQUAL(a(k), a(0,k));
+  a.resize(rows, 1);
+  a.setRandom();
+  for(Index k=0; k<rows; ++k)
+    VERIFY_IS_EQUAL(a(k), a(k,0));
+}
+
+void test_paddedstride()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( paddedstride(Matrix<float,Dynamic,Dynamic,PaddedOuterStride>(internal::random<int>(1,EIGEN_TEST_MAX_SIZE),internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_2( paddedstride(Matrix<double,Dynamic,Dynamic,PaddedOuterStride>(internal::random<int>(1,EIGEN_TEST_MAX_SIZE),internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_3( paddedstride(Matrix<double,Dynamic,Dynamic,PaddedOuterStride|RowMajor>(internal::random<int>(1,EIGEN_TEST_MAX_SIZE),internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_4( paddedstride(Matrix<std::complex<float>,Dynamic,Dynamic,PaddedOuterStride>(internal::random<int>(1,EIGEN_TEST_MAX_SIZE),internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+  }
+  // power-of-two leading dimensions are the ones which get padded
+  CALL_SUBTEST_2( paddedstride(Matrix<double,Dynamic,Dynamic,PaddedOuterStride>(256,31)) );
+  CALL_SUBTEST_3( paddedstride(Matrix<double,Dynamic,Dynamic,PaddedOuterStride|RowMajor>(33,128)) );
+  CALL_SUBTEST_5( paddedstride(Matrix<float,Dynamic,Dynamic,PaddedOuterStride>(512,64)) );
+}
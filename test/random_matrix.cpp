@@ -0,0 +1,131 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "main.h"
+
+template<typename MatrixType> void random_reproducible(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef Matrix<typename MatrixType::Scalar, Dynamic, Dynamic, MatrixType::Options & RowMajor> DynMatrix;
+  Index rows = m.rows(), cols = m.cols();
+  unsigned int seed = internal::random<unsigned int>(1, 1000000);
+
+  setRandomSeed(seed);
+  MatrixType a = MatrixType::Random(rows, cols);
+  MatrixType b = MatrixType::Random(rows, cols);
+  setRandomSeed(seed);
+  MatrixType c(rows, cols);
+  c.setRandom();
+  VERIFY_IS_EQUAL(a, c);
+  if(a.size()>4)
+    VERIFY(a != b);
+
+  // the coefficients do not depend on the traversal: compare the vectorized linear
+  // assignment with the coefficient-wise one of a block, and with the explicit loop
+  setRandomSeed(seed);
+  DynMatrix d(rows, cols);
+  d.block(0, 0, rows, cols) = MatrixType::Random(rows, cols);
+  VERIFY_IS_EQUAL(DynMatrix(a), d);
+  setRandomSeed(seed);
+  const CwiseNullaryOp<internal::scalar_random_op<typename MatrixType::Scalar>, MatrixType> x = MatrixType::Random(rows, cols);
+  for(Index j = 0; j < cols; ++j)
+    for(Index i = 0; i < rows; ++i)
+      VERIFY_IS_EQUAL(x.coeff(i, j), a(i, j));
+}
+
+template<typename Scalar> void random_uniform_distribution()
+{
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  const int n = 1 << 18;
+  VectorType v = VectorType::Random(n);
+  VERIFY(v.minCoeff() >= Scalar(-1) && v.maxCoeff() < Scalar(1));
+  VERIFY(v.minCoeff() < Scalar(-0.99) && v.maxCoeff() > Scalar(0.99));
+  // mean 0 and variance 1/3, with 6 standard deviations of margin
+  VERIFY(internal::abs(v.mean()) < Scalar(6) * internal::sqrt(Scalar(1)/Scalar(3*n)));
+  VERIFY(internal::abs(v.squaredNorm()/Scalar(n) - Scalar(1)/Scalar(3)) < Scalar(6) * internal::sqrt(Scalar(4)/Scalar(45*n)));
+  // consecutive coefficients are not correlated
+  VERIFY(internal::abs(v.head(n-1).dot(v.tail(n-1)))/Scalar(n) < Scalar(6)/Scalar(3) / internal::sqrt(Scalar(n)));
+
+  // the histogram of 16 bins is flat
+  Matrix<int,16,1> hist = Matrix<int,16,1>::Zero();
+  for(int k = 0; k < n; ++k)
+    hist(int((v(k)+Scalar(1))*Scalar(8)))++;
+  VERIFY((hist.array() > n/16 - n/128).all() && (hist.array() < n/16 + n/128).all());
+}
+
+template<typename Scalar> void random_normal_distribution()
+{
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+  typedef Matrix<Scalar,Dynamic,Dynamic> MatrixType;
+  const int n = 1 << 18;
+  VectorType v = VectorType::RandomNormal(n);
+  Scalar mean = v.mean();
+  Scalar var = (v.array() - mean).square().sum() / Scalar(n);
+  VERIFY(internal::abs(mean) < Scalar(6) / internal::sqrt(Scalar(n)));
+  VERIFY(internal::abs(var - Scalar(1)) < Scalar(6) * internal::sqrt(Scalar(2)/Scalar(n)));
+  // about 68.3% of the deviates are within one standard deviation
+  Scalar within = Scalar((v.array().abs() < Scalar(1)).count()) / Scalar(n);
+  VERIFY(internal::abs(within - Scalar(0.682689)) < Scalar(0.01));
+
+  // vectorized and coefficient-wise evaluations agree up to the accuracy of the packet math
+  unsigned int seed = internal::random<unsigned int>(1, 1000000);
+  setRandomSeed(seed);
+  MatrixType a = MatrixType::RandomNormal(33, 17);
+  setRandomSeed(seed);
+  MatrixType b(33, 17);
+  b.block(0, 0, 33, 17) = MatrixType::RandomNormal(33, 17);
+  VERIFY_IS_APPROX(a, b);
+  b.setRandomNormal();
+  VERIFY(a != b);
+}
+
+void random_integers()
+{
+  ArrayXi a = ArrayXi::Random(1 << 16);
+  VERIFY((a != a(0)).any());
+  VERIFY((a < 0).any() && (a > 0).any());
+  VERIFY((a.cast<double>().abs() <= double(1 << (internal::floor_log2<(unsigned int)(RAND_MAX)+1>::value-1))).all());
+
+  setRandomSeed(7);
+  MatrixXcd c = MatrixXcd::Random(5, 6);
+  VERIFY((c.real().array().abs() <= 1.).all() && (c.imag().array().abs() <= 1.).all());
+  VERIFY(c.real() != c.imag());
+  setRandomSeed(7);
+  VERIFY_IS_EQUAL(MatrixXcd(MatrixXcd::Random(5, 6)), c);
+}
+
+// must run before any call to setRandomSeed()
+void random_follows_srand()
+{
+  std::srand(12345);
+  MatrixXd a = MatrixXd::Random(9, 7);
+  ArrayXf b = ArrayXf::RandomNormal(33);
+  std::srand(12345);
+  VERIFY_IS_EQUAL(MatrixXd(MatrixXd::Random(9, 7)), a);
+  VERIFY((ArrayXf::RandomNormal(33) == b).all());
+  std::srand(54321);
+  VERIFY(MatrixXd(MatrixXd::Random(9, 7)) != a);
+}
+
+void test_random_matrix()
+{
+  CALL_SUBTEST_7( random_follows_srand() );
+  for(int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1( random_reproducible(MatrixXf(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_1( random_reproducible(Matrix4f()) );
+    CALL_SUBTEST_2( random_reproducible(MatrixXd(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_2( random_reproducible(Matrix<double,Dynamic,Dynamic,RowMajor>(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_3( random_reproducible(MatrixXi(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_3( random_reproducible(MatrixXcf(internal::random<int>(1,EIGEN_TEST_MAX_SIZE), internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+    CALL_SUBTEST_3( random_reproducible(RowVectorXd(internal::random<int>(1,EIGEN_TEST_MAX_SIZE))) );
+  }
+  CALL_SUBTEST_4( random_uniform_distribution<float>() );
+  CALL_SUBTEST_4( random_uniform_distribution<double>() );
+  CALL_SUBTEST_5( random_normal_distribution<float>() );
+  CALL_SUBTEST_5( random_normal_distribution<double>() );
+  CALL_SUBTEST_6( random_integers() );
+}
@@ -128,6 +128,54 @@ template<typename VectorType> void vectorRedux(const VectorType& w)
   VERIFY_RAISES_ASSERT(v.head(0).maxCoeff());
 }
 
+// Large reductions are split into chunks which may be distributed among threads:
+// check them on integer values, for which the result is exact, and check the result
+// does not depend on the number of threads.
+template<typename VectorType> void largeVectorRedux(const VectorType& w)
+{
+  typedef typename VectorType::Index Index;
+  typedef typename VectorType::Scalar Scalar;
+  Index size = w.size();
+
+  VectorType v(size), u(size);
+  for(Index i = 0; i < size; ++i)
+  {
+    v[i] = Scalar(internal::random<int>(-4,4));
+    u[i] = Scalar(internal::random<int>(-4,4));
+  }
+  Scalar s(0), d(0), n(0), minc(v[0]), maxc(v[0]);
+  for(Index i = 0; i < size; ++i)
+  {
+    s += v[i];
+    d += v[i]*u[i];
+    n += v[i]*v[i];
+    minc = (std::min)(minc, v[i]);
+    maxc = (std::max)(maxc, v[i]);
+  }
+  VERIFY_IS_EQUAL(v.sum(), s);
+  VERIFY_IS_EQUAL(v.matrix().dot(u.matrix()), d);
+  VERIFY_IS_EQUAL(v.matrix().squaredNorm(), n);
+  VERIFY_IS_EQUAL(v.minCoeff(), minc);
+  VERIFY_IS_EQUAL(v.maxCoeff(), maxc);
+  VERIFY_IS_EQUAL(v.segment(1,size-2).sum(), s-v[0]-v[size-1]);
+
+  VectorType x = VectorType::Random(size);
+  const int threads = nbThreads();
+  setNbThreads(1);
+  Scalar ref_sum = x.sum(), ref_norm = x.matrix().squaredNorm(), ref_tail = x.tail(size-1).sum();
+  setNbThreads(threads);
+  VERIFY_IS_EQUAL(x.sum(), ref_sum);
+  VERIFY_IS_EQUAL(x.matrix().squaredNorm(), ref_norm);
+  VERIFY_IS_EQUAL(x.tail(size-1).sum(), ref_tail);
+
+  // the sequential LinSpaced keeps its position in the functor, it must never be split among threads
+  setNbThreads(1);
+  Scalar ref_linspaced = VectorType::LinSpaced(Sequential, 1<<20, Scalar(0), Scalar(1)).sum();
+  setNbThreads(4);
+  VERIFY_IS_EQUAL((VectorType::LinSpaced(Sequential, 1<<20, Scalar(0), Scalar(1)).sum()), ref_linspaced);
+  setNbThreads(threads);
+}
+
 void test_redux()
 {
   // the max size cannot be too large, otherwise reduxion operations obviously generate large errors.
@@ -155,4 +203,7 @@ void test_redux()
     CALL_SUBTEST_8( vectorRedux(VectorXf(internal::random<int>(1,maxsize))) );
     CALL_SUBTEST_8( vectorRedux(ArrayXf(internal::random<int>(1,maxsize))) );
   }
+  CALL_SUBTEST_5( largeVectorRedux(VectorXd(internal::random<int>(100000,400000))) );
+  CALL_SUBTEST_8( largeVectorRedux(VectorXf(internal::random<int>(100000,400000))) );
+  CALL_SUBTEST_8( largeVectorRedux(ArrayXf(internal::random<int>(100000,400000))) );
 }
@@ -47,6 +47,14 @@ template<typename MatrixType> void schur(int size = MatrixType::ColsAtCompileTim
   VERIFY_IS_EQUAL(cs1.matrixT(), cs2.matrixT());
   VERIFY_IS_EQUAL(cs1.matrixU(), cs2.matrixU());
 
+  // Test computation from the Hessenberg form
+  HessenbergDecomposition<MatrixType> hessOfA(A);
+  MatrixType H = hessOfA.matrixH(), Q = hessOfA.matrixQ();
+  ComplexSchur<MatrixType> cs3;
+  cs3.computeFromHessenberg(H, Q, true);
+  VERIFY_IS_EQUAL(cs1.matrixT(), cs3.matrixT());
+  VERIFY_IS_EQUAL(cs1.matrixU(), cs3.matrixU());
+
   // Test computation of only T, not U
   ComplexSchur<MatrixType> csOnlyT(A, false);
   VERIFY_IS_EQUAL(csOnlyT.info(), Success);
@@ -62,6 +70,52 @@ template<typename MatrixType> void schur(int size = MatrixType::ColsAtCompileTim
   }
 }
 
+template<typename MatrixType> void schur_multishift(int size)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef typename ComplexSchur<MatrixType>::ComplexScalar ComplexScalar;
+  typedef typename ComplexSchur<MatrixType>::ComplexMatrixType ComplexMatrixType;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+
+  // clustered eigenvalues, such that the aggressive early deflation reorders the Schur form of its window
+  MatrixType Q = MatrixType::Random(size,size).householderQr().householderQ();
+  VectorType d = VectorType::Random(size);
+  for(int i = 4; i < size; i += 4)
+    d(i) = d(0) + Scalar(RealScalar(i) * RealScalar(1e-3));
+  MatrixType A = Q * d.asDiagonal() * Q.adjoint();
+  A.template triangularView<StrictlyUpper>() += MatrixType::Random(size,size);
+
+  ComplexSchur<MatrixType> schurOfA(A);
+  VERIFY_IS_EQUAL(schurOfA.info(), Success);
+  ComplexMatrixType T = schurOfA.matrixT();
+  VERIFY((T.template triangularView<StrictlyLower>().toDenseMatrix().array() == ComplexScalar(0)).all());
+  VERIFY_IS_APPROX(A.template cast<ComplexScalar>(), schurOfA.matrixU() * T * schurOfA.matrixU().adjoint());
+  VERIFY_IS_UNITARY(schurOfA.matrixU());
+  VERIFY_IS_APPROX(T.trace(), ComplexScalar(A.trace()));
+}
+
+// a normal matrix whose eigenvalues are 1e-9 apart every third one: the bulges of the multishift sweeps built
+// from the nearly equal shifts nearly vanish, which happens with the many shifts used for large sizes
+template<typename MatrixType> void schur_clustered(int size)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+
+  MatrixType Q = MatrixType::Random(size,size).householderQr().householderQ();
+  VectorType d = VectorType::Random(size);
+  for(int i = 3; i < size; i += 3)
+    d(i) = d(0) + Scalar(RealScalar(i) * RealScalar(1e-9));
+  MatrixType A = Q * d.asDiagonal() * Q.adjoint();
+
+  ComplexSchur<MatrixType> schurOfA(A);
+  VERIFY_IS_EQUAL(schurOfA.info(), Success);
+  VERIFY_IS_APPROX(A, schurOfA.matrixU() * schurOfA.matrixT() * schurOfA.matrixU().adjoint());
+  VERIFY_IS_UNITARY(schurOfA.matrixU());
+  VERIFY_IS_APPROX(schurOfA.matrixT().trace(), A.trace());
+}
+
 void test_schur_complex()
 {
   CALL_SUBTEST_1(( schur<Matrix4cd>() ));
@@ -69,6 +123,10 @@ void test_schur_complex()
   CALL_SUBTEST_3(( schur<Matrix<std::complex<float>, 1, 1> >() ));
   CALL_SUBTEST_4(( schur<Matrix<float, 3, 3, Eigen::RowMajor> >() ));
 
+  CALL_SUBTEST_6(( schur_multishift<MatrixXcd>(internal::random<int>(EIGEN_COMPLEXSCHUR_MULTISHIFT_THRESHOLD,EIGEN_TEST_MAX_SIZE)) ));
+  CALL_SUBTEST_7(( schur_multishift<MatrixXd>(internal::random<int>(EIGEN_COMPLEXSCHUR_MULTISHIFT_THRESHOLD,EIGEN_TEST_MAX_SIZE)) ));
+  CALL_SUBTEST_6(( schur_clustered<MatrixXcd>(internal::random<int>(3*EIGEN_TEST_MAX_SIZE/4,EIGEN_TEST_MAX_SIZE)) ));
+
   // Test problem size constructors
   CALL_SUBTEST_5(ComplexSchur<MatrixXf>(10));
 }
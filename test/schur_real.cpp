@@ -66,13 +66,21 @@ template<typename MatrixType> void schur(int size = MatrixType::ColsAtCompileTim
   VERIFY_IS_EQUAL(rs1.matrixT(), rs2.matrixT());
   VERIFY_IS_EQUAL(rs1.matrixU(), rs2.matrixU());
 
+  // Test computation from the Hessenberg form
+  HessenbergDecomposition<MatrixType> hessOfA(A);
+  RealSchur<MatrixType> rs3;
+  rs3.computeFromHessenberg(hessOfA.matrixH(), hessOfA.matrixQ(), true);
+  VERIFY_IS_EQUAL(rs1.matrixT(), rs3.matrixT());
+  VERIFY_IS_EQUAL(rs1.matrixU(), rs3.matrixU());
+
   // Test computation of only T, not U
   RealSchur<MatrixType> rsOnlyT(A, false);
   VERIFY_IS_EQUAL(rsOnlyT.info(), Success);
   VERIFY_IS_EQUAL(rs1.matrixT(), rsOnlyT.matrixT());
   VERIFY_RAISES_ASSERT(rsOnlyT.matrixU());
 
-  if (size > 2)
+  // the NaN matrix runs to the iteration limit, which takes minutes on the multishift path
+  if (size > 2 && size < EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD)
   {
     // Test matrix with NaN
     A(0,0) = std::numeric_limits<typename MatrixType::Scalar>::quiet_NaN();
@@ -81,6 +89,59 @@ template<typename MatrixType> void schur(int size = MatrixType::ColsAtCompileTim
   }
 }
 
+template<typename MatrixType> void schur_multishift(int size)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+
+  // eigenvalues which are clustered, or complex with the same real part, such that the aggressive early
+  // deflation reorders the Schur form of its window (exactly repeated eigenvalues may be left in 2x2 blocks)
+  MatrixType Q = MatrixType::Random(size,size).householderQr().householderQ();
+  MatrixType D = MatrixType::Zero(size,size);
+  VectorType d = VectorType::Random(size);
+  for(int i = 0; i < size; ++i)
+  {
+    if(i%4 == 0)
+      d(i) = d(0) + Scalar(i) * Scalar(1e-3);
+    D(i,i) = d(i);
+    if(i%7 == 1 && i+1 < size)
+    {
+      D(i+1,i+1) = d(i);
+      D(i,i+1) = Scalar(0.5);
+      D(i+1,i) = Scalar(-1);
+      ++i;
+    }
+  }
+  MatrixType A = Q * D * Q.transpose();
+  RealSchur<MatrixType> schurOfA(A);
+  VERIFY_IS_EQUAL(schurOfA.info(), Success);
+  verifyIsQuasiTriangular(schurOfA.matrixT());
+  VERIFY_IS_APPROX(A, schurOfA.matrixU() * schurOfA.matrixT() * schurOfA.matrixU().transpose());
+  VERIFY_IS_UNITARY(schurOfA.matrixU());
+  VERIFY_IS_APPROX(schurOfA.matrixT().trace(), D.trace());
+}
+
+// a symmetric matrix whose eigenvalues are 1e-9 apart every third one: the bulges of the multishift sweeps built
+// from the nearly equal shifts nearly vanish, which happens with the many shifts used for large sizes
+template<typename MatrixType> void schur_clustered(int size)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar,Dynamic,1> VectorType;
+
+  MatrixType Q = MatrixType::Random(size,size).householderQr().householderQ();
+  VectorType d = VectorType::Random(size);
+  for(int i = 3; i < size; i += 3)
+    d(i) = d(0) + Scalar(i) * Scalar(1e-9);
+  MatrixType A = Q * d.asDiagonal() * Q.transpose();
+
+  RealSchur<MatrixType> schurOfA(A);
+  VERIFY_IS_EQUAL(schurOfA.info(), Success);
+  verifyIsQuasiTriangular(schurOfA.matrixT());
+  VERIFY_IS_APPROX(A, schurOfA.matrixU() * schurOfA.matrixT() * schurOfA.matrixU().transpose());
+  VERIFY_IS_UNITARY(schurOfA.matrixU());
+  VERIFY_IS_APPROX(schurOfA.matrixT().trace(), A.trace());
+}
+
 void test_schur_real()
 {
   CALL_SUBTEST_1(( schur<Matrix4f>() ));
@@ -88,6 +149,12 @@ void test_schur_real()
   CALL_SUBTEST_3(( schur<Matrix<float, 1, 1> >() ));
   CALL_SUBTEST_4(( schur<Matrix<double, 3, 3, Eigen::RowMajor> >() ));
 
+  CALL_SUBTEST_6(( schur<MatrixXd>(internal::random<int>(EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD,EIGEN_TEST_MAX_SIZE)) ));
+  CALL_SUBTEST_6(( schur_multishift<MatrixXd>(internal::random<int>(EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD,EIGEN_TEST_MAX_SIZE)) ));
+  CALL_SUBTEST_6(( schur_clustered<MatrixXd>(internal::random<int>(3*EIGEN_TEST_MAX_SIZE/4,EIGEN_TEST_MAX_SIZE)) ));
+  CALL_SUBTEST_7(( schur<Matrix<float,Dynamic,Dynamic,RowMajor> >(internal::random<int>(EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD,EIGEN_TEST_MAX_SIZE)) ));
+  CALL_SUBTEST_7(( schur_multishift<MatrixXf>(internal::random<int>(EIGEN_REALSCHUR_MULTISHIFT_THRESHOLD,EIGEN_TEST_MAX_SIZE)) ));
+
   // Test problem size constructors
   CALL_SUBTEST_5(RealSchur<MatrixXf>(10));
 }
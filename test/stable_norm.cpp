@@ -89,6 +89,24 @@ template<typename MatrixType> void stable_norm(const MatrixType& m)
   VERIFY_IS_APPROX(vsmall.blueNorm(),   internal::sqrt(size)*internal::abs(small));
   VERIFY_IS_APPROX(vsmall.hypotNorm(),  internal::sqrt(size)*internal::abs(small));
 
+  // coefficients on both sides of the bounds of the mid range of blueNorm, with an unaligned start
+  {
+    int ibeta = std::numeric_limits<RealScalar>::radix;
+    int it    = std::numeric_limits<RealScalar>::digits;
+    int iemin = std::numeric_limits<RealScalar>::min_exponent;
+    int iemax = std::numeric_limits<RealScalar>::max_exponent;
+    RealScalar bounds[2] = { std::pow(RealScalar(ibeta), RealScalar(-((1-iemin)/2))),
+                             std::pow(RealScalar(ibeta), RealScalar((iemax+1-it)/2)) / size };
+    for(int k=0; k<2; ++k)
+    {
+      MatrixType vmix = vrand * (bounds[k] * RealScalar(4));
+      VERIFY_IS_APPROX(vmix.blueNorm(), bounds[k] * (vmix/bounds[k]).norm());
+      VERIFY_IS_APPROX(vmix.stableNorm(), bounds[k] * (vmix/bounds[k]).norm());
+      Map<const Matrix<Scalar,Dynamic,1> > vtail(vmix.data()+1, vmix.size()-1);
+      VERIFY_IS_APPROX(vtail.blueNorm(), bounds[k] * (vtail/bounds[k]).norm());
+    }
+  }
+
 // Test compilation of cwise() version
   VERIFY_IS_APPROX(vrand.colwise().stableNorm(),      vrand.colwise().norm());
   VERIFY_IS_APPROX(vrand.colwise().blueNorm(),        vrand.colwise().norm());
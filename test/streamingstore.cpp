@@ -0,0 +1,61 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// make small destinations go through the non-temporal stores
+#define EIGEN_STREAMING_STORE_THRESHOLD 1024
+
+#include "main.h"
+
+template<typename ArrayType> void streamingstore(typename ArrayType::Index size)
+{
+  typedef typename ArrayType::Index Index;
+  typedef typename ArrayType::Scalar Scalar;
+
+  ArrayType a = ArrayType::Random(size), b = ArrayType::Random(size), r(size);
+  Scalar s = internal::random<Scalar>();
+
+  r.setZero();
+  for(Index i = 0; i < size; ++i)
+    VERIFY_IS_EQUAL(r(i), Scalar(0));
+  r.setConstant(s);
+  for(Index i = 0; i < size; ++i)
+    VERIFY_IS_EQUAL(r(i), s);
+  r = a * s + b;
+  for(Index i = 0; i < size; ++i)
+    VERIFY_IS_APPROX(r(i), a(i) * s + b(i));
+
+  // compound assignments and swaps read the destination
+  ArrayType c = r;
+  r += a;
+  for(Index i = 0; i < size; ++i)
+    VERIFY_IS_APPROX(r(i), c(i) + a(i));
+  c = r;
+  ArrayType d = a;
+  r.swap(a);
+  VERIFY((r == d).all());
+  VERIFY((a == c).all());
+
+  // unaligned destination
+  r.segment(1, size-2) = b.segment(1, size-2) * s;
+  for(Index i = 1; i < size-1; ++i)
+    VERIFY_IS_APPROX(r(i), b(i) * s);
+  Map<ArrayType> m(r.data()+1, size-1);
+  m = b.tail(size-1);
+  VERIFY((r.tail(size-1) == b.tail(size-1)).all());
+}
+
+void test_streamingstore()
+{
+  for(int i = 0; i < g_repeat; i++) {
+    int size = internal::random<int>(1000,20000);
+    CALL_SUBTEST_1( streamingstore<ArrayXf>(size) );
+    CALL_SUBTEST_2( streamingstore<ArrayXd>(size) );
+    CALL_SUBTEST_3( streamingstore<ArrayXi>(size) );
+    CALL_SUBTEST_4( streamingstore<ArrayXcf>(size) );
+    CALL_SUBTEST_5( streamingstore<ArrayXcd>(size) );
+  }
+}
@@ -25,6 +25,13 @@ template<typename MatrixType> void upperbidiag(const MatrixType& m)
   b.block(0,0,cols,cols) = ubd.bidiagonal();
   MatrixType c = ubd.householderU() * b * ubd.householderV().adjoint();
   VERIFY_IS_APPROX(a,c);
+
+  // the dense matrix V is the one which is applied by the products
+  Matrix<Scalar, MatrixType::ColsAtCompileTime, MatrixType::ColsAtCompileTime> v = ubd.householderV();
+  VERIFY_IS_UNITARY(v);
+  c = ubd.householderU() * b * v.adjoint();
+  VERIFY_IS_APPROX(a,c);
+  VERIFY_IS_APPROX(MatrixType(b * v.adjoint()), MatrixType(b * ubd.householderV().adjoint()));
 }
 
 void test_upperbidiagonalization()
@@ -37,5 +44,8 @@ void test_upperbidiagonalization()
    CALL_SUBTEST_5( upperbidiag(Matrix<float,6,4>()) );
    CALL_SUBTEST_6( upperbidiag(Matrix<float,5,5>()) );
    CALL_SUBTEST_7( upperbidiag(Matrix<double,4,3>()) );
+   // large enough to be reduced by panels
+   CALL_SUBTEST_8( upperbidiag(MatrixXd(160,130)) );
+   CALL_SUBTEST_9( upperbidiag(MatrixXcd(140,140)) );
   }
 }
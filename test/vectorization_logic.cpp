@@ -75,6 +75,16 @@ bool test_redux(const Xpr&, int traversal, int unrolling)
   return res;
 }
 
+template<typename Xpr>
+bool test_boolean_redux(const Xpr&, bool vectorized)
+{
+  typedef internal::cwise_mask<Xpr, typename internal::cwise_mask_scalar<Xpr>::type> Mask;
+  bool res = bool(Mask::PacketAccess)==vectorized;
+  if(!res)
+    std::cerr << " Expected boolean reduction vectorization == " << vectorized << "\n";
+  return res;
+}
+
 template<typename Scalar, bool Enable = internal::packet_traits<Scalar>::Vectorizable> struct vectorization_logic
 {
   enum {
@@ -194,6 +204,24 @@ template<typename Scalar, bool Enable = internal::packet_traits<Scalar>::Vectori
     VERIFY(test_redux(VectorX(10),
       LinearVectorizedTraversal,NoUnrolling));
 
+    // partial reductions across the storage order
+    VERIFY(test_assign(Matrix<Scalar,1,Dynamic>(10),Matrix<Scalar,Dynamic,Dynamic,RowMajor>(10,10).colwise().sum(),
+      LinearVectorizedTraversal,NoUnrolling));
+    VERIFY(test_assign(VectorX(10),MatrixXX(10,10).rowwise().sum(),
+      int(MatrixXX::Flags)&RowMajorBit ? LinearTraversal : LinearVectorizedTraversal,NoUnrolling));
+
+    if(internal::packet_traits<Scalar>::HasCmp && internal::packet_traits<Scalar>::HasBlend)
+    {
+      VERIFY(test_assign(MatrixXX(10,10),(MatrixXX(10,10).array()<MatrixXX(10,10).array()).select(MatrixXX(10,10),MatrixXX(10,10)),
+        LinearVectorizedTraversal,NoUnrolling));
+      VERIFY(test_assign(VectorX(10),(VectorX(10).array()>=Scalar(0)).select(VectorX(10),Scalar(0)),
+        LinearVectorizedTraversal,NoUnrolling));
+      VERIFY(test_boolean_redux(VectorX(10).array()!=VectorX(10).array(), true));
+      VERIFY(test_boolean_redux(MatrixXX(10,10).array()<Scalar(0) || MatrixXX(10,10).array()>Scalar(1), true));
+      VERIFY(test_boolean_redux(MatrixXX(10,10).block(1,1,4,4).array()==Scalar(0), true));
+      VERIFY(test_boolean_redux(MatrixXX(10,10).array()==MatrixXX(10,10).transpose().array(), false));
+    }
+
     
   }
 };
@@ -230,6 +258,16 @@ void test_vectorization_logic()
     VERIFY(test_redux(Matrix<double,7,3>(),
       DefaultTraversal,CompleteUnrolling));
   }
+
+  if(internal::type_casting_traits<double,float>::VectorizedCast)
+  {
+    VERIFY(test_assign(VectorXf(10),VectorXd(10).cast<float>(),
+      LinearVectorizedTraversal,NoUnrolling));
+    VERIFY(test_assign(VectorXd(10),VectorXf(10).cast<double>(),
+      LinearVectorizedTraversal,NoUnrolling));
+    VERIFY(test_assign(MatrixXf(10,10),MatrixXi(10,10).cast<float>(),
+      LinearVectorizedTraversal,NoUnrolling));
+  }
 #endif // EIGEN_VECTORIZE
 
 }
@@ -15,7 +15,6 @@ template<typename ArrayType> void vectorwiseop_array(const ArrayType& m)
 {
   typedef typename ArrayType::Index Index;
   typedef typename ArrayType::Scalar Scalar;
-  typedef typename NumTraits<Scalar>::Real RealScalar;
   typedef Array<Scalar, ArrayType::RowsAtCompileTime, 1> ColVectorType;
   typedef Array<Scalar, 1, ArrayType::ColsAtCompileTime> RowVectorType;
 
@@ -108,7 +107,6 @@ template<typename MatrixType> void vectorwiseop_matrix(const MatrixType& m)
 {
   typedef typename MatrixType::Index Index;
   typedef typename MatrixType::Scalar Scalar;
-  typedef typename NumTraits<Scalar>::Real RealScalar;
   typedef Matrix<Scalar, MatrixType::RowsAtCompileTime, 1> ColVectorType;
   typedef Matrix<Scalar, 1, MatrixType::ColsAtCompileTime> RowVectorType;
 
@@ -161,6 +159,54 @@ template<typename MatrixType> void vectorwiseop_matrix(const MatrixType& m)
   VERIFY_RAISES_ASSERT(m1.rowwise() - rowvec.transpose());
 }
 
+// The partial reductions across the storage order reduce packets of several subvectors at once,
+// check them against the reductions of each subvector.
+template<typename MatrixType> void vectorwiseop_redux(const MatrixType& m)
+{
+  typedef typename MatrixType::Index Index;
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, 1, MatrixType::ColsAtCompileTime> RowVectorType;
+
+  Index rows = m.rows();
+  Index cols = m.cols();
+  Index prodRows = (std::min)(rows, Index(8));
+
+  MatrixType m1 = MatrixType::Random(rows, cols);
+  m1.array() += Scalar(1);
+  RowVectorType sum(cols), mean(cols), prod(cols), minc(cols), maxc(cols), sqnorm(cols);
+  for(Index j = 0; j < cols; ++j)
+  {
+    sum(j) = m1.col(j).sum();
+    mean(j) = m1.col(j).mean();
+    prod(j) = m1.col(j).head(prodRows).prod();
+    minc(j) = m1.col(j).minCoeff();
+    maxc(j) = m1.col(j).maxCoeff();
+    sqnorm(j) = m1.col(j).squaredNorm();
+  }
+
+  VERIFY_IS_APPROX(m1.colwise().sum(), sum);
+  VERIFY_IS_APPROX(m1.colwise().mean(), mean);
+  VERIFY_IS_APPROX(m1.topRows(prodRows).colwise().prod(), prod);
+  VERIFY_IS_EQUAL(m1.colwise().minCoeff(), minc);
+  VERIFY_IS_EQUAL(m1.colwise().maxCoeff(), maxc);
+  VERIFY_IS_APPROX(m1.colwise().squaredNorm(), sqnorm);
+  VERIFY_IS_APPROX(m1.colwise().norm(), sqnorm.cwiseSqrt());
+  VERIFY_IS_APPROX(m1.colwise().redux(internal::scalar_sum_op<Scalar>()), sum);
+  VERIFY_IS_APPROX(m1.transpose().rowwise().sum(), sum.transpose());
+  VERIFY_IS_EQUAL(m1.transpose().rowwise().maxCoeff(), maxc.transpose());
+
+  // nested in an expression, and on an unaligned block
+  VERIFY_IS_APPROX((m1.colwise().sum() * Scalar(2)).eval(), sum * Scalar(2));
+  VERIFY_IS_APPROX(m1.colwise().sum().sum(), sum.sum());
+  if(rows>2 && cols>2)
+  {
+    Matrix<Scalar,1,Dynamic> blocksum(cols-2);
+    for(Index j = 0; j < cols-2; ++j)
+      blocksum(j) = m1.col(j+1).segment(1, rows-2).sum();
+    VERIFY_IS_APPROX(m1.block(1, 1, rows-2, cols-2).colwise().sum(), blocksum);
+  }
+}
+
 void test_vectorwiseop()
 {
   CALL_SUBTEST_1(vectorwiseop_array(Array22cd()));
@@ -169,4 +215,12 @@ void test_vectorwiseop()
   CALL_SUBTEST_4(vectorwiseop_matrix(Matrix4cf()));
   CALL_SUBTEST_5(vectorwiseop_matrix(Matrix<float,4,5>()));
   CALL_SUBTEST_6(vectorwiseop_matrix(MatrixXd(7,2)));
+  for(int i = 0; i < g_repeat; i++) {
+    int rows = internal::random<int>(1,EIGEN_TEST_MAX_SIZE), cols = internal::random<int>(1,EIGEN_TEST_MAX_SIZE);
+    CALL_SUBTEST_7(vectorwiseop_redux(Matrix<float,Dynamic,Dynamic,RowMajor>(rows, cols)));
+    CALL_SUBTEST_7(vectorwiseop_redux(Matrix<float,5,8,RowMajor>()));
+    CALL_SUBTEST_8(vectorwiseop_redux(Matrix<double,Dynamic,Dynamic,RowMajor>(rows, cols)));
+    EIGEN_UNUSED_VARIABLE(rows)
+    EIGEN_UNUSED_VARIABLE(cols)
+  }
 }
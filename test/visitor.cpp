@@ -99,6 +99,69 @@ template<typename VectorType> void vectorVisitor(const VectorType& w)
   VERIFY_IS_APPROX(maxc, v.maxCoeff());
 }
 
+// with many ties, the index of the first extremum in column-major order must be returned,
+// and NaN must be ignored unless it is the first coefficient
+template<typename MatrixType> void visitorTies(const MatrixType& p)
+{
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename MatrixType::Index Index;
+  Index rows = p.rows(), cols = p.cols();
+
+  MatrixType m(rows, cols);
+  for(Index j = 0; j < cols; j++)
+    for(Index i = 0; i < rows; i++)
+      m(i,j) = Scalar(internal::random<int>(-3,3));
+  if(!NumTraits<Scalar>::IsInteger && rows > 1)
+    m(internal::random<Index>(1,rows-1), internal::random<Index>(0,cols-1)) = std::numeric_limits<Scalar>::quiet_NaN();
+
+  Scalar minc = m(0,0), maxc = m(0,0);
+  Index minrow=0,mincol=0,maxrow=0,maxcol=0;
+  for(Index j = 0; j < cols; j++)
+  for(Index i = 0; i < rows; i++)
+  {
+    if(m(i,j) < minc) { minc = m(i,j); minrow = i; mincol = j; }
+    if(m(i,j) > maxc) { maxc = m(i,j); maxrow = i; maxcol = j; }
+  }
+  Index eigen_minrow, eigen_mincol, eigen_maxrow, eigen_maxcol;
+  VERIFY_IS_EQUAL(m.minCoeff(&eigen_minrow,&eigen_mincol), minc);
+  VERIFY_IS_EQUAL(m.maxCoeff(&eigen_maxrow,&eigen_maxcol), maxc);
+  VERIFY_IS_EQUAL(eigen_minrow, minrow);
+  VERIFY_IS_EQUAL(eigen_mincol, mincol);
+  VERIFY_IS_EQUAL(eigen_maxrow, maxrow);
+  VERIFY_IS_EQUAL(eigen_maxcol, maxcol);
+
+  Index minidx = 0, eigen_minidx;
+  for(Index i = 0; i < rows; i++)
+    if(m(i,0) < m(minidx,0)) minidx = i;
+  VERIFY_IS_EQUAL(m.col(0).minCoeff(&eigen_minidx), m(minidx,0));
+  VERIFY_IS_EQUAL(eigen_minidx, minidx);
+
+  if(!NumTraits<Scalar>::IsInteger)
+  {
+    m(0,0) = std::numeric_limits<Scalar>::quiet_NaN();
+    m.minCoeff(&eigen_minrow,&eigen_mincol);
+    VERIFY(eigen_minrow==0 && eigen_mincol==0);
+  }
+}
+
+// the lanes of the packets are combined at the end of each run of packets, whose length is bounded:
+// the first extremum must still be found when it crosses those boundaries
+template<typename VectorType> void visitorRuns()
+{
+  typedef typename VectorType::Scalar Scalar;
+  typedef typename VectorType::Index Index;
+  const Index size = 5*(1<<20) + internal::random<Index>(0,1000);
+  VectorType v = VectorType::Constant(size, Scalar(1));
+  Index minidx = internal::random<Index>(1,size-2), maxidx = internal::random<Index>(1,size-2);
+  v(minidx) = v(internal::random<Index>(minidx+1,size-1)) = Scalar(0);
+  v(maxidx) = v(internal::random<Index>(maxidx+1,size-1)) = Scalar(2);
+  Index eigen_minidx, eigen_maxidx;
+  VERIFY_IS_EQUAL(v.minCoeff(&eigen_minidx), Scalar(0));
+  VERIFY_IS_EQUAL(v.maxCoeff(&eigen_maxidx), Scalar(2));
+  VERIFY_IS_EQUAL(eigen_minidx, minidx);
+  VERIFY_IS_EQUAL(eigen_maxidx, maxidx);
+}
+
 void test_visitor()
 {
   for(int i = 0; i < g_repeat; i++) {
@@ -115,4 +178,17 @@ void test_visitor()
     CALL_SUBTEST_9( vectorVisitor(RowVectorXd(10)) );
     CALL_SUBTEST_10( vectorVisitor(VectorXf(33)) );
   }
+  for(int i = 0; i < g_repeat; i++) {
+    int rows = internal::random<int>(1,EIGEN_TEST_MAX_SIZE), cols = internal::random<int>(1,EIGEN_TEST_MAX_SIZE);
+    CALL_SUBTEST_11( visitorTies(MatrixXf(rows, cols)) );
+    CALL_SUBTEST_11( visitorTies(VectorXf(internal::random<int>(1,10000))) );
+    CALL_SUBTEST_12( visitorTies(MatrixXd(rows, cols)) );
+    CALL_SUBTEST_12( visitorTies(Matrix<double,Dynamic,Dynamic,RowMajor>(rows, cols)) );
+    CALL_SUBTEST_13( visitorTies(MatrixXi(rows, cols)) );
+    EIGEN_UNUSED_VARIABLE(rows)
+    EIGEN_UNUSED_VARIABLE(cols)
+  }
+  CALL_SUBTEST_11( visitorRuns<VectorXf>() );
+  CALL_SUBTEST_12( visitorRuns<RowVectorXd>() );
+  CALL_SUBTEST_13( visitorRuns<VectorXi>() );
 }